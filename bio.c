@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -13,10 +13,38 @@
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
 //
-// The implementation uses two state flags internally:
+// The cache starts with NBUF static buffers.  binit2() adds pages
+// of buffers from kalloc() up to a share of free memory, bget()
+// adds more back when memory allows, and kalloc() calls bshrink()
+// to take pages of unused buffers back when it runs out.
+//
+// Buffers are found by hashing (dev, inum, blockno) into chains
+// with their own locks, so lookups of different blocks do not
+// contend; bcache.lock only serializes recycling.  The table has
+// a bucket for every few buffers the cache can grow to.
+//
+// Recycling follows 2Q, so one pass over many blocks cannot flush
+// the blocks in steady use.  A block read for the first time joins
+// A1in, a FIFO.  Blocks pushed out of A1in are remembered for a
+// while in a ghost list, A1out, hashed for lookup; a block read
+// again while there joins Am, the hot blocks, recycled least
+// recently used first.  A1in gives up its oldest block once it
+// holds more than a quarter of the cache.
+//
+// Each queue keeps its unused buffers on a list, oldest first, so
+// choosing a victim takes the head of a list.  A lookup does not
+// touch the lists, to stay off bcache.lock: a buffer in use is
+// dropped from its list when the recycler comes across it, and
+// put back at the tail when it is released.  A lookup in Am sets
+// b->used instead of moving b, and the recycler gives such a
+// buffer a second pass.
+//
+// The implementation uses three state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_DELAY: the buffer holds block blockno of inode inum,
+//     which has no disk block yet (see bdelay).
 
 #include "types.h"
 #include "defs.h"
@@ -25,71 +53,491 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "mmu.h"
+
+#define NBUCKET (NBUFMAX/4 - 1)
+#define BHASH(dev, inum, blockno) (((dev) + (inum)*31 + (blockno)) % NBUCKET)
+
+// A hash chain of cached buffers, through prev/next.
+struct bucket {
+  struct spinlock lock;  // protects the chain and its bufs' refcnt
+  struct buf *head;
+  uint hits;
+};
+
+#define BCHAIN(b) (&bcache.bucket[BHASH((b)->dev, (b)->inum, (b)->blockno)])
+
+// 2Q queue of a buffer.
+#define BQ_NONE 0  // holds no block
+#define BQ_IN   1  // A1in
+#define BQ_HOT  2  // Am
+#define NBQ     3
+
+// Unused buffers of a queue, through lprev/lnext, oldest first.
+struct bqueue {
+  struct buf *head;
+  struct buf *tail;
+};
+
+#define BQUEUE(b) (&bcache.queue[(b)->queue])
+
+#define NGHOST (NBUFMAX/2)
+#define NGHASH (NGHOST/4 - 1)
+#define GHASH(dev, inum, blockno) (((dev) + (inum)*31 + (blockno)) % NGHASH)
+
+// A block remembered in A1out.
+struct ghost {
+  uint dev;
+  uint inum;
+  uint blockno;
+  uint seq;   // value of bcache.nghost when it was added
+  int next;   // next in its hash chain, or -1
+};
+
+#define BPERPAGE ((PGSIZE - sizeof(void*)) / sizeof(struct buf))
+#define BMEMSHARE 8     // binit2() uses 1/BMEMSHARE of free memory
+#define BRESERVE  64    // free pages bget() leaves others when growing
+
+// A page of buffers from kalloc().
+struct bpage {
+  struct bpage *next;
+  struct buf buf[BPERPAGE];
+};
 
 struct {
-  struct spinlock lock;
+  struct spinlock lock;  // one recycler at a time; protects below
   struct buf buf[NBUF];
+  struct bucket bucket[NBUCKET];
+  struct bpage *pages;   // buffers from kalloc()
+  int nbuf;              // buffers in the cache
+  int target;            // size to grow back to
+  struct bqueue queue[NBQ];
+  int nin;               // buffers in A1in
+  struct ghost ghost[NGHOST];  // A1out, a ring
+  int ghash[NGHASH];     // A1out hash chains, or -1
+  uint nghost;           // blocks ever added to A1out
+  int nahead;            // read-ahead bufs in flight
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  // Counters for bstats().
+  uint misses;
+  uint ghosthits;   // misses on blocks in A1out
+  uint evictin;     // blocks recycled from A1in
+  uint evicthot;    // blocks recycled from Am
+  uint readahead;   // blocks read ahead
 } bcache;
 
+// Unlink b from its hash chain k.  Caller holds k->lock.
+static void
+bunlink(struct bucket *k, struct buf *b)
+{
+  if(b->prev)
+    b->prev->next = b->next;
+  else
+    k->head = b->next;
+  if(b->next)
+    b->next->prev = b->prev;
+}
+
+// Add b to hash chain k.  Caller holds k->lock.
+static void
+blink(struct bucket *k, struct buf *b)
+{
+  b->next = k->head;
+  b->prev = 0;
+  if(k->head)
+    k->head->prev = b;
+  k->head = b;
+}
+
+// Return the buffer in chain k for the given block, or 0.
+// Caller holds k->lock.
+static struct buf*
+bfind(struct bucket *k, uint dev, uint inum, uint blockno)
+{
+  struct buf *b;
+
+  for(b = k->head; b; b = b->next){
+    if(b->dev == dev && b->inum == inum && b->blockno == blockno)
+      return b;
+  }
+  return 0;
+}
+
+// Add b at the tail of its queue's list.
+// Caller holds bcache.lock.
+static void
+bqadd(struct buf *b)
+{
+  struct bqueue *q = BQUEUE(b);
+
+  b->lnext = 0;
+  b->lprev = q->tail;
+  if(q->tail)
+    q->tail->lnext = b;
+  else
+    q->head = b;
+  q->tail = b;
+  b->listed = 1;
+}
+
+// Take b off its queue's list.  Caller holds bcache.lock.
+static void
+bqremove(struct buf *b)
+{
+  struct bqueue *q = BQUEUE(b);
+
+  if(b->lprev)
+    b->lprev->lnext = b->lnext;
+  else
+    q->head = b->lnext;
+  if(b->lnext)
+    b->lnext->lprev = b->lprev;
+  else
+    q->tail = b->lprev;
+  b->listed = 0;
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *k;
+
+  int i;
 
   initlock(&bcache.lock, "bcache");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
+  // Create empty hash chains, then add the buffers, holding no block.
+  for(k = bcache.bucket; k < bcache.bucket+NBUCKET; k++)
+    initlock(&k->lock, "bcache.bucket");
+  for(i = 0; i < NGHASH; i++)
+    bcache.ghash[i] = -1;
   for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    b->dev = -1;
+    blink(BCHAIN(b), b);
+    bqadd(b);
   }
+  bcache.nbuf = NBUF;
+  bcache.target = NBUF;
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
-static struct buf*
-bget(uint dev, uint blockno)
+// Add a page of buffers to the cache.
+// Returns 0 if free memory is short.
+static int
+bgrow(void)
 {
+  struct bpage *p;
   struct buf *b;
+  struct bucket *k;
+
+  if(kfreepages() < BRESERVE || (p = (struct bpage*)kalloc()) == 0)
+    return 0;
+  memset(p, 0, sizeof(*p));
+  for(b = p->buf; b < p->buf+BPERPAGE; b++){
+    initsleeplock(&b->lock, "buffer");
+    b->dev = -1;
+  }
 
   acquire(&bcache.lock);
+  k = BCHAIN(p->buf);
+  acquire(&k->lock);
+  for(b = p->buf; b < p->buf+BPERPAGE; b++){
+    blink(k, b);
+    bqadd(b);
+  }
+  release(&k->lock);
+  p->next = bcache.pages;
+  bcache.pages = p;
+  bcache.nbuf += BPERPAGE;
+  release(&bcache.lock);
+  return 1;
+}
 
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+// Size the cache once kinit2() has freed all physical memory.
+void
+binit2(void)
+{
+  int n;
+
+  n = kfreepages() / BMEMSHARE * BPERPAGE;
+  if(n > NBUFMAX)
+    n = NBUFMAX;
+  if(n > bcache.target)
+    bcache.target = n;
+  while(bcache.nbuf < bcache.target && bgrow())
+    ;
+  cprintf("bcache: %d buffers\n", bcache.nbuf);
+}
+
+// Give a page of unused buffers back to kalloc().
+// Returns 0 if there is none.  A buffer off its list may be about
+// to go back on it (see bput()), so only pages whose buffers are
+// all listed are given back.
+int
+bshrink(void)
+{
+  struct bpage *p, **pp;
+  struct buf *b;
+  int i;
+
+  acquire(&bcache.lock);
+  for(i = 0; i < NBUCKET; i++)
+    acquire(&bcache.bucket[i].lock);
+  for(pp = &bcache.pages; (p = *pp) != 0; pp = &p->next){
+    for(b = p->buf; b < p->buf+BPERPAGE; b++){
+      if(b->refcnt != 0 || (b->flags & B_DIRTY) || !b->listed)
+        break;
+    }
+    if(b == p->buf+BPERPAGE)
+      break;
+  }
+  if(p){
+    for(b = p->buf; b < p->buf+BPERPAGE; b++){
+      bunlink(BCHAIN(b), b);
+      bqremove(b);
+      if(b->queue == BQ_IN)
+        bcache.nin--;
     }
+    *pp = p->next;
+    bcache.nbuf -= BPERPAGE;
   }
+  for(i = NBUCKET-1; i >= 0; i--)
+    release(&bcache.bucket[i].lock);
+  release(&bcache.lock);
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  if(p == 0)
+    return 0;
+  kfree((char*)p);
+  return 1;
+}
+
+// Remember the block of b, pushed out of A1in, in A1out,
+// forgetting the oldest block there if the ring is full.
+// Caller holds bcache.lock.
+static void
+bghostadd(struct buf *b)
+{
+  struct ghost *g;
+  int i, *pp;
+
+  i = bcache.nghost % NGHOST;
+  g = &bcache.ghost[i];
+  if(bcache.nghost >= NGHOST){
+    pp = &bcache.ghash[GHASH(g->dev, g->inum, g->blockno)];
+    while(*pp != i)
+      pp = &bcache.ghost[*pp].next;
+    *pp = g->next;
+  }
+  g->dev = b->dev;
+  g->inum = b->inum;
+  g->blockno = b->blockno;
+  g->seq = bcache.nghost++;
+  pp = &bcache.ghash[GHASH(g->dev, g->inum, g->blockno)];
+  g->next = *pp;
+  *pp = i;
+}
+
+// Is the block in A1out?
+// Caller holds bcache.lock.
+static int
+bghost(uint dev, uint inum, uint blockno)
+{
+  struct ghost *g;
+  uint n;
+  int i;
+
+  // A1out remembers as many blocks as half the cache holds.
+  n = bcache.nbuf/2;
+  if(n > NGHOST)
+    n = NGHOST;
+  for(i = bcache.ghash[GHASH(dev, inum, blockno)]; i >= 0; i = g->next){
+    g = &bcache.ghost[i];
+    if(g->dev == dev && g->inum == inum && g->blockno == blockno)
+      return bcache.nghost - g->seq <= n;
+  }
+  return 0;
+}
+
+// Choose an unused buffer to recycle: one holding no block, else
+// the oldest in A1in if A1in is over its share, else the least
+// recently used in Am.  Returns 0 if every buffer is in use.
+// The buffer is taken off its list.
+// Caller holds bcache.lock, which keeps chains and keys from
+// changing, so refcnt can be read without the chain's lock.
+static struct buf*
+bvictim(void)
+{
+  struct bqueue *free, *in, *hot, *q;
+  struct buf *b;
+
+  free = &bcache.queue[BQ_NONE];
+  in = &bcache.queue[BQ_IN];
+  hot = &bcache.queue[BQ_HOT];
+  for(;;){
+    if(free->head)
+      q = free;
+    else if(in->head && (hot->head == 0 || bcache.nin > bcache.nbuf/4))
+      q = in;
+    else if(hot->head)
+      q = hot;
+    else
+      return 0;
+    b = q->head;
+    bqremove(b);
+    // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+    // because log.c has modified it but not yet committed it.
+    // Either way it goes back on the list when released.
+    if(b->refcnt != 0 || (b->flags & B_DIRTY))
+      continue;
+    if(b->used){
+      b->used = 0;
+      bqadd(b);  // used since it was last here: another pass
+      continue;
+    }
+    return b;
+  }
+}
+
+// Look through buffer cache for block on device dev, or for
+// file block blockno of inode inum if inum is not 0.
+// If not found, allocate a buffer; if every buffer is in use,
+// return 0 if mayfail is set, else panic.
+// Otherwise return locked buffer.
+static struct buf*
+bgetx(uint dev, uint inum, uint blockno, int mayfail)
+{
+  struct buf *b;
+  struct bucket *k, *v;
+
+  k = &bcache.bucket[BHASH(dev, inum, blockno)];
+
+  // Is the block already cached?
+  acquire(&k->lock);
+  if((b = bfind(k, dev, inum, blockno)) != 0){
+    b->refcnt++;
+    if(b->queue == BQ_HOT)
+      b->used = 1;
+    k->hits++;
+    release(&k->lock);
+    acquiresleep(&b->lock);
+    return b;
+  }
+  release(&k->lock);
+
+  // Not cached.  Win back buffers lost to memory pressure.
+  if(bcache.nbuf < bcache.target)
+    bgrow();
+
+  // Only a recycler adds buffers to a chain, so check again
+  // while holding bcache.lock.
+  acquire(&bcache.lock);
+  acquire(&k->lock);
+  if((b = bfind(k, dev, inum, blockno)) != 0){
+    b->refcnt++;
+    if(b->queue == BQ_HOT)
+      b->used = 1;
+    k->hits++;
+    release(&k->lock);
+    release(&bcache.lock);
+    acquiresleep(&b->lock);
+    return b;
+  }
+  release(&k->lock);
+
+  // Recycle a buffer, unless a lookup took it meanwhile;
+  // then it is back on its list once released.
+  for(;;){
+    if((b = bvictim()) == 0){
+      if(mayfail){
+        release(&bcache.lock);
+        return 0;
+      }
+      panic("bget: no buffers");
     }
+    v = BCHAIN(b);
+    acquire(&v->lock);
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+      break;
+    release(&v->lock);
+  }
+  bunlink(v, b);
+  release(&v->lock);
+
+  if(b->queue == BQ_IN){
+    bcache.nin--;
+    bcache.evictin++;
+    bghostadd(b);
+  } else if(b->queue == BQ_HOT){
+    bcache.evicthot++;
+  }
+  bcache.misses++;
+  if(bghost(dev, inum, blockno)){
+    bcache.ghosthits++;
+    b->queue = BQ_HOT;
+  } else {
+    bcache.nin++;
+    b->queue = BQ_IN;
+  }
+  b->used = 0;
+
+  b->dev = dev;
+  b->inum = inum;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  acquire(&k->lock);
+  blink(k, b);
+  release(&k->lock);
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
+}
+
+static struct buf*
+bget(uint dev, uint inum, uint blockno)
+{
+  return bgetx(dev, inum, blockno, 0);
+}
+
+// Drop a reference to b.  If b is now unused, put it back on
+// its queue's list if the recycler took it off, or recycle it if
+// bassign() dropped its block.
+static void
+bput(struct buf *b)
+{
+  struct bucket *k;
+  int relist, stale;
+
+  k = BCHAIN(b);
+  acquire(&k->lock);
+  b->refcnt--;
+  stale = b->refcnt == 0 && b->stale;
+  relist = b->refcnt == 0 && (b->flags & B_DIRTY) == 0 && !b->listed;
+  release(&k->lock);
+
+  if(stale){
+    // Nothing can find b now, so it holds no block.
+    acquire(&bcache.lock);
+    b->stale = 0;
+    b->dev = -1;
+    b->flags = 0;
+    if(b->queue == BQ_IN)
+      bcache.nin--;
+    b->queue = BQ_NONE;
+    bqadd(b);
+    k = BCHAIN(b);
+    acquire(&k->lock);
+    blink(k, b);
+    release(&k->lock);
+    release(&bcache.lock);
+  } else if(relist){
+    acquire(&bcache.lock);
+    if(!b->listed)
+      bqadd(b);
+    release(&bcache.lock);
   }
-  panic("bget: no buffers");
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -98,13 +546,132 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, 0, blockno);
   if((b->flags & B_VALID) == 0) {
     iderw(b);
   }
   return b; 
 }
 
+// Return a locked buf for file block bn of inode inum on dev,
+// for data whose disk block is chosen later (delayed allocation).
+// A new one is zeroed.  It stays pinned with B_DIRTY until
+// bassign() gives it a disk block.
+struct buf*
+bdelay(uint dev, uint inum, uint bn)
+{
+  struct buf *b;
+
+  b = bget(dev, inum, bn);
+  if((b->flags & B_VALID) == 0) {
+    memset(b->data, 0, BSIZE);
+    b->flags = B_VALID | B_DIRTY | B_DELAY;
+  }
+  return b;
+}
+
+// Bind delayed buffer b to disk block blockno.
+// Any other cached copy of blockno is stale and dropped.  One may
+// still be in use, e.g. by a read-ahead of the block's previous
+// file, which was freed earlier in the transaction; it comes off
+// its chain now and holds no block once released.
+void
+bassign(struct buf *b, uint blockno)
+{
+  struct buf *o;
+  struct bucket *k;
+
+  if(!holdingsleep(&b->lock) || (b->flags & B_DELAY) == 0)
+    panic("bassign");
+
+  acquire(&bcache.lock);  // no recycling while b changes chains
+  k = &bcache.bucket[BHASH(b->dev, b->inum, b->blockno)];
+  acquire(&k->lock);
+  bunlink(k, b);
+  release(&k->lock);
+
+  k = &bcache.bucket[BHASH(b->dev, 0, blockno)];
+  acquire(&k->lock);
+  if((o = bfind(k, b->dev, 0, blockno)) != 0){
+    bunlink(k, o);
+    b->flags |= o->flags & B_CKPT;  // b takes over its log entry
+    if(o->listed)
+      bqremove(o);
+  }
+  if(o && o->refcnt != 0){
+    o->stale = 1;  // bput() recycles it
+    o = 0;
+  } else if(o){
+    o->dev = -1;
+    o->flags = 0;
+    if(o->queue == BQ_IN)
+      bcache.nin--;
+    o->queue = BQ_NONE;
+    bqadd(o);
+  }
+  b->inum = 0;
+  b->blockno = blockno;
+  b->flags &= ~B_DELAY;
+  blink(k, b);
+  release(&k->lock);
+  if(o){
+    k = BCHAIN(o);
+    acquire(&k->lock);
+    blink(k, o);
+    release(&k->lock);
+  }
+  release(&bcache.lock);
+}
+
+// Start reading blocks blockno..blockno+n-1 of dev into the
+// cache without waiting for them.  Blocks already cached are
+// skipped, and read-ahead stops once its reads in flight hold a
+// quarter of the cache, or when no buffer is free.
+void
+bread_ahead(uint dev, uint blockno, uint n)
+{
+  struct buf *b;
+  struct bucket *k;
+
+  for(; n > 0; n--, blockno++){
+    if(bcache.nahead >= bcache.nbuf/4)
+      return;
+    k = &bcache.bucket[BHASH(dev, 0, blockno)];
+    acquire(&k->lock);
+    b = bfind(k, dev, 0, blockno);
+    release(&k->lock);
+    if(b)
+      continue;
+
+    if((b = bgetx(dev, 0, blockno, 1)) == 0)
+      return;
+    if(b->flags & B_VALID){
+      brelse(b);
+      continue;
+    }
+    acquire(&bcache.lock);
+    bcache.nahead++;
+    bcache.readahead++;
+    release(&bcache.lock);
+    b->done = bahead_done;
+    ide_submit(b);
+  }
+}
+
+// Completion hook for read-ahead: release b on behalf of the
+// process that started the read.
+void
+bahead_done(struct buf *b)
+{
+  releasesleep(&b->lock);
+
+  acquire(&bcache.lock);
+  bcache.nahead--;
+  release(&bcache.lock);
+
+  bput(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,8 +682,25 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Start writing b's contents to disk without waiting.
+// Must be locked, and the caller must bwait(b) before brelse(b).
+void
+bwrite_async(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bwrite_async");
+  b->flags |= B_DIRTY;
+  ide_submit(b);
+}
+
+// Wait for a bwrite_async() of b to finish.
+void
+bwait(struct buf *b)
+{
+  ide_wait(b);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
@@ -124,20 +708,24 @@ brelse(struct buf *b)
     panic("brelse");
 
   releasesleep(&b->lock);
+  bput(b);
+}
 
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
-  release(&bcache.lock);
+// Print buffer cache counters.
+void
+bstats(void)
+{
+  struct bucket *k;
+  uint hits;
+
+  hits = 0;
+  for(k = bcache.bucket; k < bcache.bucket+NBUCKET; k++)
+    hits += k->hits;
+  cprintf("bcache: %d bufs, %d in A1in; %d hits, %d misses, "
+          "%d A1out hits; recycled %d A1in, %d Am; %d read ahead\n",
+          bcache.nbuf, bcache.nin, hits, bcache.misses,
+          bcache.ghosthits, bcache.evictin, bcache.evicthot,
+          bcache.readahead);
 }
 //PAGEBREAK!
 // Blank page.
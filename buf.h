@@ -1,14 +1,26 @@
 struct buf {
   int flags;
   uint dev;
+  uint inum;    // B_DELAY: owning inode, and blockno is a file block
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  int queue;        // 2Q queue; see bio.c
+  int listed;       // on its queue's list?
+  int used;         // Am: used since it was last passed over
+  int stale;        // off its hash chain; see bassign()
+  struct buf *lprev; // queue list
+  struct buf *lnext;
+  struct buf *prev; // hash chain
   struct buf *next;
   struct buf *qnext; // disk queue
+  uint qtime;        // ticks when queued for the disk
+  int npass;         // times later requests went ahead of it
+  void (*done)(struct buf*); // if set, ideintr calls it when I/O is done
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_DELAY 0x8  // file block with no disk block yet
+#define B_CKPT  0x10 // committed to the log, not yet installed
 
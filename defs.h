@@ -12,9 +12,18 @@ struct superblock;
 
 // bio.c
 void            binit(void);
+void            binit2(void);
+int             bshrink(void);
+void            bstats(void);
+void            bread_ahead(uint, uint, uint);
+void            bahead_done(struct buf*);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bwrite_async(struct buf*);
+void            bwait(struct buf*);
+struct buf*     bdelay(uint, uint, uint);
+void            bassign(struct buf*, uint);
 
 // console.c
 void            consoleinit(void);
@@ -38,11 +47,14 @@ int             filewrite(struct file*, char*, int n);
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
+int             falloci(struct inode*, uint, uint);
+void            delalloc(void);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
+void            iputorphans(void);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
@@ -57,6 +69,9 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            ide_submit(struct buf*);
+void            ide_wait(struct buf*);
+void            idestats(void);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -68,6 +83,7 @@ char*           kalloc(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             kfreepages(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -84,13 +100,37 @@ void            microdelay(int);
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+void            log_delay(int);
+void            log_data(struct buf*);
+void            log_free(uint, uint);
+void            log_tick(void);
+uint            log_txn(void);
+void            log_sync(uint);
+int             log_committed(uint);
+void            logstats(void);
 void            begin_op();
+void            begin_opn(int);
 void            end_op();
 
+// virtio.c
+extern int      virtioirq;
+int             virtioinit(void);
+void            virtiointr(void);
+void            virtio_submit(struct buf*);
+void            virtio_wait(struct buf*);
+void            virtiostats(void);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pci.c
+uint            pciread(uint, int);
+void            pciwrite(uint, int, uint);
+uint            pcifind(uint, uint);
+uint            pcifindclass(uint, uint);
+void            pcienable(uint);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -120,6 +160,7 @@ void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
+void            kthread(char*, void (*)(void));
 int		printProcessTime(int);
 void	printProcessTable(int);
 
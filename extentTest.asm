@@ -0,0 +1,1653 @@
+
+_extentTest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "syscall.h"
+#include "fcntl.h"
+
+// start main()
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec cc 07 00 00    	sub    $0x7cc,%esp
+  17:	8b 59 04             	mov    0x4(%ecx),%ebx
+    // Text to periodically write to our new extent file:
+    const char *fileContentWrite1 = "CONTENT 1 START: ............................................................................................................................................................................................................................................................................................................................................................................................................CONTENT 1 END.";
+    const char *fileContentWrite2 = "CONTENT 2 START: ..............................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................CONTENT 2 END.";
+    const char *fileContentWrite3 = "CONTENT 3 START: ..................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................................CONTENT 3 END.";
+
+    printf(1, "\nCreating an extent file called: %s\n", argv[1]);
+  1a:	ff 73 04             	push   0x4(%ebx)
+  1d:	68 18 0c 00 00       	push   $0xc18
+  22:	6a 01                	push   $0x1
+  24:	e8 c7 08 00 00       	call   8f0 <printf>
+    // **** Creating the extent file **************************************************************************************
+    int fileDescriptor;
+    if((fileDescriptor = open(argv[1], O_EXTENT)) < 0) {
+  29:	58                   	pop    %eax
+  2a:	5a                   	pop    %edx
+  2b:	6a 04                	push   $0x4
+  2d:	ff 73 04             	push   0x4(%ebx)
+  30:	e8 5e 07 00 00       	call   793 <open>
+  35:	83 c4 10             	add    $0x10,%esp
+  38:	85 c0                	test   %eax,%eax
+  3a:	0f 88 ad 00 00 00    	js     ed <main+0xed>
+            printf(1, "testExtent failed: Cannot create extent: %s\n", argv[1]);
+            exit();
+    }
+    close(fileDescriptor);
+  40:	83 ec 0c             	sub    $0xc,%esp
+  43:	50                   	push   %eax
+  44:	e8 32 07 00 00       	call   77b <close>
+
+    printf(1, "Writing first chunk of content to new extent file: %s\n", argv[1]);
+  49:	83 c4 0c             	add    $0xc,%esp
+  4c:	ff 73 04             	push   0x4(%ebx)
+  4f:	68 70 0c 00 00       	push   $0xc70
+  54:	6a 01                	push   $0x1
+  56:	e8 95 08 00 00       	call   8f0 <printf>
+    // **** Write file content number 1 to our extent. **********************************************************************
+    int fileDescriptor2;
+    if((fileDescriptor2 = open(argv[1], O_WRONLY)) < 0) {
+  5b:	59                   	pop    %ecx
+  5c:	5e                   	pop    %esi
+  5d:	6a 01                	push   $0x1
+  5f:	ff 73 04             	push   0x4(%ebx)
+  62:	e8 2c 07 00 00       	call   793 <open>
+  67:	83 c4 10             	add    $0x10,%esp
+  6a:	89 c6                	mov    %eax,%esi
+  6c:	85 c0                	test   %eax,%eax
+  6e:	78 68                	js     d8 <main+0xd8>
+            printf(1, "testExtent failed: Cannot open extent %s\n", argv[1]);
+            exit();
+    }
+
+
+    printf(1, "\nwriting content 1. content 1 length: %d, size: %d\n", strlen(fileContentWrite1), sizeof(fileContentWrite1));
+  70:	83 ec 0c             	sub    $0xc,%esp
+  73:	68 d4 0c 00 00       	push   $0xcd4
+  78:	e8 23 05 00 00       	call   5a0 <strlen>
+  7d:	6a 04                	push   $0x4
+  7f:	50                   	push   %eax
+  80:	68 80 0e 00 00       	push   $0xe80
+  85:	6a 01                	push   $0x1
+  87:	e8 64 08 00 00       	call   8f0 <printf>
+    if (write(fileDescriptor2, fileContentWrite1, strlen(fileContentWrite1)) != strlen(fileContentWrite1)) {
+  8c:	83 c4 14             	add    $0x14,%esp
+  8f:	68 d4 0c 00 00       	push   $0xcd4
+  94:	e8 07 05 00 00       	call   5a0 <strlen>
+  99:	83 c4 0c             	add    $0xc,%esp
+  9c:	50                   	push   %eax
+  9d:	68 d4 0c 00 00       	push   $0xcd4
+  a2:	56                   	push   %esi
+  a3:	e8 cb 06 00 00       	call   773 <write>
+  a8:	c7 04 24 d4 0c 00 00 	movl   $0xcd4,(%esp)
+  af:	89 c7                	mov    %eax,%edi
+  b1:	e8 ea 04 00 00       	call   5a0 <strlen>
+  b6:	83 c4 10             	add    $0x10,%esp
+  b9:	39 c7                	cmp    %eax,%edi
+  bb:	74 45                	je     102 <main+0x102>
+        exit();
+    }
+
+    printf(1, "\nwriting content 3. content 3 length: %d, size: %d\n", strlen(fileContentWrite3), sizeof(fileContentWrite3));
+    if (write(fileDescriptorThree, fileContentWrite3, strlen(fileContentWrite3)) != strlen(fileContentWrite3)) {
+        printf(2, "testExtent failed: failed to write the content to the extent file.\n");
+  bd:	51                   	push   %ecx
+  be:	51                   	push   %ecx
+  bf:	68 b4 0e 00 00       	push   $0xeb4
+        printf(2, "testExtent failed: cannot seek to the end of the extent file.\n");
+  c4:	6a 02                	push   $0x2
+  c6:	e8 25 08 00 00       	call   8f0 <printf>
+        close(fileDescriptor4);
+  cb:	89 34 24             	mov    %esi,(%esp)
+  ce:	e8 a8 06 00 00       	call   77b <close>
+        exit();
+  d3:	e8 7b 06 00 00       	call   753 <exit>
+            printf(1, "testExtent failed: Cannot open extent %s\n", argv[1]);
+  d8:	50                   	push   %eax
+  d9:	ff 73 04             	push   0x4(%ebx)
+  dc:	68 a8 0c 00 00       	push   $0xca8
+  e1:	6a 01                	push   $0x1
+  e3:	e8 08 08 00 00       	call   8f0 <printf>
+            exit();
+  e8:	e8 66 06 00 00       	call   753 <exit>
+            printf(1, "testExtent failed: Cannot create extent: %s\n", argv[1]);
+  ed:	57                   	push   %edi
+  ee:	ff 73 04             	push   0x4(%ebx)
+  f1:	68 40 0c 00 00       	push   $0xc40
+  f6:	6a 01                	push   $0x1
+  f8:	e8 f3 07 00 00       	call   8f0 <printf>
+            exit();
+  fd:	e8 51 06 00 00       	call   753 <exit>
+    close(fileDescriptor2);
+ 102:	83 ec 0c             	sub    $0xc,%esp
+ 105:	56                   	push   %esi
+ 106:	8d b5 e8 f9 ff ff    	lea    -0x618(%ebp),%esi
+ 10c:	e8 6a 06 00 00       	call   77b <close>
+    printf(1, "Printing out extent file: %s\n\n", argv[1]);
+ 111:	83 c4 0c             	add    $0xc,%esp
+ 114:	ff 73 04             	push   0x4(%ebx)
+ 117:	68 f8 0e 00 00       	push   $0xef8
+ 11c:	6a 01                	push   $0x1
+ 11e:	e8 cd 07 00 00       	call   8f0 <printf>
+    if((fileDescriptor3 = open(argv[1], O_RDONLY)) < 0) {
+ 123:	58                   	pop    %eax
+ 124:	5a                   	pop    %edx
+ 125:	6a 00                	push   $0x0
+ 127:	ff 73 04             	push   0x4(%ebx)
+ 12a:	e8 64 06 00 00       	call   793 <open>
+ 12f:	83 c4 10             	add    $0x10,%esp
+ 132:	89 85 34 f8 ff ff    	mov    %eax,-0x7cc(%ebp)
+ 138:	85 c0                	test   %eax,%eax
+ 13a:	79 23                	jns    15f <main+0x15f>
+ 13c:	e9 f3 00 00 00       	jmp    234 <main+0x234>
+ 141:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        if (write(1, buf, n) != n)
+ 148:	83 ec 04             	sub    $0x4,%esp
+ 14b:	57                   	push   %edi
+ 14c:	56                   	push   %esi
+ 14d:	6a 01                	push   $0x1
+ 14f:	e8 1f 06 00 00       	call   773 <write>
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	39 f8                	cmp    %edi,%eax
+ 159:	0f 85 c2 00 00 00    	jne    221 <main+0x221>
+    while ((n = read(fileDescriptor3, buf, sizeof(buf))) > 0)
+ 15f:	83 ec 04             	sub    $0x4,%esp
+ 162:	68 00 02 00 00       	push   $0x200
+ 167:	56                   	push   %esi
+ 168:	ff b5 34 f8 ff ff    	push   -0x7cc(%ebp)
+ 16e:	e8 f8 05 00 00       	call   76b <read>
+ 173:	83 c4 10             	add    $0x10,%esp
+ 176:	89 c7                	mov    %eax,%edi
+ 178:	85 c0                	test   %eax,%eax
+ 17a:	7f cc                	jg     148 <main+0x148>
+    printf(1, "\n");
+ 17c:	51                   	push   %ecx
+ 17d:	51                   	push   %ecx
+ 17e:	68 bb 17 00 00       	push   $0x17bb
+ 183:	6a 01                	push   $0x1
+ 185:	e8 66 07 00 00       	call   8f0 <printf>
+    close(fileDescriptor3);
+ 18a:	5e                   	pop    %esi
+ 18b:	ff b5 34 f8 ff ff    	push   -0x7cc(%ebp)
+ 191:	e8 e5 05 00 00       	call   77b <close>
+    printf(1, "\nExtent file has been successfully created, written too, and read. Calling exec() on a child process to run the stat user program on our new extent file: %s\n\n", argv[1]);
+ 196:	83 c4 0c             	add    $0xc,%esp
+ 199:	ff 73 04             	push   0x4(%ebx)
+ 19c:	68 7c 0f 00 00       	push   $0xf7c
+ 1a1:	6a 01                	push   $0x1
+ 1a3:	e8 48 07 00 00       	call   8f0 <printf>
+    int pid = fork();
+ 1a8:	e8 9e 05 00 00       	call   74b <fork>
+    if (pid == 0) {
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	0f 84 91 00 00 00    	je     249 <main+0x249>
+    pid = wait();
+ 1b8:	e8 9e 05 00 00       	call   75b <wait>
+    printf(1, "\n\nWriting second chunk of content to new extent file to show we can grow it: %s\n", argv[1]);
+ 1bd:	50                   	push   %eax
+ 1be:	ff 73 04             	push   0x4(%ebx)
+ 1c1:	68 1c 10 00 00       	push   $0x101c
+ 1c6:	6a 01                	push   $0x1
+ 1c8:	e8 23 07 00 00       	call   8f0 <printf>
+    if((fileDescriptor4 = open(argv[1], O_WRONLY)) < 0) {
+ 1cd:	58                   	pop    %eax
+ 1ce:	5a                   	pop    %edx
+ 1cf:	6a 01                	push   $0x1
+ 1d1:	ff 73 04             	push   0x4(%ebx)
+ 1d4:	e8 ba 05 00 00       	call   793 <open>
+ 1d9:	83 c4 10             	add    $0x10,%esp
+ 1dc:	89 c6                	mov    %eax,%esi
+ 1de:	85 c0                	test   %eax,%eax
+ 1e0:	0f 88 f2 fe ff ff    	js     d8 <main+0xd8>
+    if(fstat(fileDescriptor4, &st2) < 0 || lseek(fileDescriptor4, st2.size) != st2.size) {
+ 1e6:	8d 85 48 f8 ff ff    	lea    -0x7b8(%ebp),%eax
+ 1ec:	57                   	push   %edi
+ 1ed:	57                   	push   %edi
+ 1ee:	50                   	push   %eax
+ 1ef:	56                   	push   %esi
+ 1f0:	e8 b6 05 00 00       	call   7ab <fstat>
+ 1f5:	83 c4 10             	add    $0x10,%esp
+ 1f8:	85 c0                	test   %eax,%eax
+ 1fa:	78 19                	js     215 <main+0x215>
+ 1fc:	51                   	push   %ecx
+ 1fd:	51                   	push   %ecx
+ 1fe:	ff b5 58 f8 ff ff    	push   -0x7a8(%ebp)
+ 204:	56                   	push   %esi
+ 205:	e8 19 06 00 00       	call   823 <lseek>
+ 20a:	83 c4 10             	add    $0x10,%esp
+ 20d:	3b 85 58 f8 ff ff    	cmp    -0x7a8(%ebp),%eax
+ 213:	74 67                	je     27c <main+0x27c>
+        printf(2, "testExtent failed: cannot seek to the end of the extent file.\n");
+ 215:	53                   	push   %ebx
+ 216:	53                   	push   %ebx
+ 217:	68 70 10 00 00       	push   $0x1070
+ 21c:	e9 a3 fe ff ff       	jmp    c4 <main+0xc4>
+            printf(1, "testExtent failed: Cannot write out extent file.\n");
+ 221:	57                   	push   %edi
+ 222:	57                   	push   %edi
+ 223:	68 48 0f 00 00       	push   $0xf48
+ 228:	6a 01                	push   $0x1
+ 22a:	e8 c1 06 00 00       	call   8f0 <printf>
+            exit();
+ 22f:	e8 1f 05 00 00       	call   753 <exit>
+    printf(1, "Printing out extent file: %s\n\n", argv[1]);
+    // **** Read and print out the contents of our extent file to prove we did it. ******************************************
+    int fileDescriptorThree2;
+
+    if((fileDescriptorThree2 = open(argv[1], O_RDONLY)) < 0) {
+            printf(1, "testExtent failed: Cannot open extent file %s\n", argv[1]);
+ 234:	50                   	push   %eax
+ 235:	ff 73 04             	push   0x4(%ebx)
+ 238:	68 18 0f 00 00       	push   $0xf18
+ 23d:	6a 01                	push   $0x1
+ 23f:	e8 ac 06 00 00       	call   8f0 <printf>
+            exit();
+ 244:	e8 0a 05 00 00       	call   753 <exit>
+        char *args[] = {"stat", argv[1], NULL}; // list of arguments for stat, the last arg must always be NULL
+ 249:	c7 85 e8 fd ff ff bd 	movl   $0x17bd,-0x218(%ebp)
+ 250:	17 00 00 
+ 253:	8b 43 04             	mov    0x4(%ebx),%eax
+ 256:	31 c9                	xor    %ecx,%ecx
+ 258:	89 8d f0 fd ff ff    	mov    %ecx,-0x210(%ebp)
+ 25e:	89 85 ec fd ff ff    	mov    %eax,-0x214(%ebp)
+        exec(args[0], args);
+ 264:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 26a:	53                   	push   %ebx
+ 26b:	53                   	push   %ebx
+ 26c:	50                   	push   %eax
+ 26d:	68 bd 17 00 00       	push   $0x17bd
+ 272:	e8 14 05 00 00       	call   78b <exec>
+        exit();
+ 277:	e8 d7 04 00 00       	call   753 <exit>
+    printf(1, "\nwriting content 2. content 2 length: %d, size: %d\n", strlen(fileContentWrite2), sizeof(fileContentWrite2));
+ 27c:	83 ec 0c             	sub    $0xc,%esp
+ 27f:	68 b0 10 00 00       	push   $0x10b0
+ 284:	e8 17 03 00 00       	call   5a0 <strlen>
+ 289:	6a 04                	push   $0x4
+ 28b:	50                   	push   %eax
+ 28c:	68 10 13 00 00       	push   $0x1310
+ 291:	6a 01                	push   $0x1
+ 293:	e8 58 06 00 00       	call   8f0 <printf>
+    if (write(fileDescriptor4, fileContentWrite2, strlen(fileContentWrite2)) != strlen(fileContentWrite2)) {
+ 298:	83 c4 14             	add    $0x14,%esp
+ 29b:	68 b0 10 00 00       	push   $0x10b0
+ 2a0:	e8 fb 02 00 00       	call   5a0 <strlen>
+ 2a5:	83 c4 0c             	add    $0xc,%esp
+ 2a8:	50                   	push   %eax
+ 2a9:	68 b0 10 00 00       	push   $0x10b0
+ 2ae:	56                   	push   %esi
+ 2af:	e8 bf 04 00 00       	call   773 <write>
+ 2b4:	c7 04 24 b0 10 00 00 	movl   $0x10b0,(%esp)
+ 2bb:	89 c7                	mov    %eax,%edi
+ 2bd:	e8 de 02 00 00       	call   5a0 <strlen>
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	39 c7                	cmp    %eax,%edi
+ 2c7:	0f 85 f0 fd ff ff    	jne    bd <main+0xbd>
+    close(fileDescriptor4);
+ 2cd:	83 ec 0c             	sub    $0xc,%esp
+ 2d0:	8d bd e8 fb ff ff    	lea    -0x418(%ebp),%edi
+ 2d6:	56                   	push   %esi
+ 2d7:	e8 9f 04 00 00       	call   77b <close>
+    printf(1, "Printing out extent file: %s\n\n", argv[1]);
+ 2dc:	83 c4 0c             	add    $0xc,%esp
+ 2df:	ff 73 04             	push   0x4(%ebx)
+ 2e2:	68 f8 0e 00 00       	push   $0xef8
+ 2e7:	6a 01                	push   $0x1
+ 2e9:	e8 02 06 00 00       	call   8f0 <printf>
+    if((fileDescriptor5 = open(argv[1], O_RDONLY)) < 0) {
+ 2ee:	58                   	pop    %eax
+ 2ef:	5a                   	pop    %edx
+ 2f0:	6a 00                	push   $0x0
+ 2f2:	ff 73 04             	push   0x4(%ebx)
+ 2f5:	e8 99 04 00 00       	call   793 <open>
+ 2fa:	83 c4 10             	add    $0x10,%esp
+ 2fd:	89 c6                	mov    %eax,%esi
+ 2ff:	85 c0                	test   %eax,%eax
+ 301:	79 26                	jns    329 <main+0x329>
+ 303:	e9 2c ff ff ff       	jmp    234 <main+0x234>
+        if (write(1, buf2, numberBytesRead) != numberBytesRead)
+ 308:	50                   	push   %eax
+ 309:	52                   	push   %edx
+ 30a:	89 95 34 f8 ff ff    	mov    %edx,-0x7cc(%ebp)
+ 310:	57                   	push   %edi
+ 311:	6a 01                	push   $0x1
+ 313:	e8 5b 04 00 00       	call   773 <write>
+ 318:	8b 95 34 f8 ff ff    	mov    -0x7cc(%ebp),%edx
+ 31e:	83 c4 10             	add    $0x10,%esp
+ 321:	39 d0                	cmp    %edx,%eax
+ 323:	0f 85 f8 fe ff ff    	jne    221 <main+0x221>
+    while ((numberBytesRead = read(fileDescriptor5, buf2, sizeof(buf2))) > 0)
+ 329:	50                   	push   %eax
+ 32a:	68 00 02 00 00       	push   $0x200
+ 32f:	57                   	push   %edi
+ 330:	56                   	push   %esi
+ 331:	e8 35 04 00 00       	call   76b <read>
+ 336:	83 c4 10             	add    $0x10,%esp
+ 339:	89 c2                	mov    %eax,%edx
+ 33b:	85 c0                	test   %eax,%eax
+ 33d:	7f c9                	jg     308 <main+0x308>
+    printf(1, "\n");
+ 33f:	57                   	push   %edi
+ 340:	57                   	push   %edi
+ 341:	68 bb 17 00 00       	push   $0x17bb
+ 346:	6a 01                	push   $0x1
+ 348:	e8 a3 05 00 00       	call   8f0 <printf>
+    close(fileDescriptor5);
+ 34d:	89 34 24             	mov    %esi,(%esp)
+ 350:	e8 26 04 00 00       	call   77b <close>
+    printf(1, "\n\nExtent file has been successfully extended, written, and read. Calling exec() on a child process to run the stat user program on our extent file to see updates: %s...\n", argv[1]);
+ 355:	83 c4 0c             	add    $0xc,%esp
+ 358:	ff 73 04             	push   0x4(%ebx)
+ 35b:	68 44 13 00 00       	push   $0x1344
+ 360:	6a 01                	push   $0x1
+ 362:	e8 89 05 00 00       	call   8f0 <printf>
+    int pid2 = fork();
+ 367:	e8 df 03 00 00       	call   74b <fork>
+    if (pid2 == 0) {
+ 36c:	83 c4 10             	add    $0x10,%esp
+ 36f:	85 c0                	test   %eax,%eax
+ 371:	0f 84 d2 fe ff ff    	je     249 <main+0x249>
+    pid2 = wait();
+ 377:	e8 df 03 00 00       	call   75b <wait>
+     printf(1, "\n\nWriting third chunk of content to new extent file to show we can grow it: %s\n", argv[1]);
+ 37c:	50                   	push   %eax
+ 37d:	ff 73 04             	push   0x4(%ebx)
+ 380:	68 f0 13 00 00       	push   $0x13f0
+ 385:	6a 01                	push   $0x1
+ 387:	e8 64 05 00 00       	call   8f0 <printf>
+    if((fileDescriptorThree = open(argv[1], O_WRONLY)) < 0) {
+ 38c:	58                   	pop    %eax
+ 38d:	5a                   	pop    %edx
+ 38e:	6a 01                	push   $0x1
+ 390:	ff 73 04             	push   0x4(%ebx)
+ 393:	e8 fb 03 00 00       	call   793 <open>
+ 398:	83 c4 10             	add    $0x10,%esp
+ 39b:	89 c6                	mov    %eax,%esi
+ 39d:	85 c0                	test   %eax,%eax
+ 39f:	0f 88 33 fd ff ff    	js     d8 <main+0xd8>
+    if(fstat(fileDescriptorThree, &st3) < 0 || lseek(fileDescriptorThree, st3.size) != st3.size) {
+ 3a5:	50                   	push   %eax
+ 3a6:	50                   	push   %eax
+ 3a7:	8d 85 18 f9 ff ff    	lea    -0x6e8(%ebp),%eax
+ 3ad:	50                   	push   %eax
+ 3ae:	56                   	push   %esi
+ 3af:	e8 f7 03 00 00       	call   7ab <fstat>
+ 3b4:	83 c4 10             	add    $0x10,%esp
+ 3b7:	85 c0                	test   %eax,%eax
+ 3b9:	0f 88 56 fe ff ff    	js     215 <main+0x215>
+ 3bf:	57                   	push   %edi
+ 3c0:	57                   	push   %edi
+ 3c1:	ff b5 28 f9 ff ff    	push   -0x6d8(%ebp)
+ 3c7:	56                   	push   %esi
+ 3c8:	e8 56 04 00 00       	call   823 <lseek>
+ 3cd:	83 c4 10             	add    $0x10,%esp
+ 3d0:	3b 85 28 f9 ff ff    	cmp    -0x6d8(%ebp),%eax
+ 3d6:	0f 85 39 fe ff ff    	jne    215 <main+0x215>
+    printf(1, "\nwriting content 3. content 3 length: %d, size: %d\n", strlen(fileContentWrite3), sizeof(fileContentWrite3));
+ 3dc:	83 ec 0c             	sub    $0xc,%esp
+ 3df:	68 40 14 00 00       	push   $0x1440
+ 3e4:	e8 b7 01 00 00       	call   5a0 <strlen>
+ 3e9:	6a 04                	push   $0x4
+ 3eb:	50                   	push   %eax
+ 3ec:	68 d4 16 00 00       	push   $0x16d4
+ 3f1:	6a 01                	push   $0x1
+ 3f3:	e8 f8 04 00 00       	call   8f0 <printf>
+    if (write(fileDescriptorThree, fileContentWrite3, strlen(fileContentWrite3)) != strlen(fileContentWrite3)) {
+ 3f8:	83 c4 14             	add    $0x14,%esp
+ 3fb:	68 40 14 00 00       	push   $0x1440
+ 400:	e8 9b 01 00 00       	call   5a0 <strlen>
+ 405:	83 c4 0c             	add    $0xc,%esp
+ 408:	50                   	push   %eax
+ 409:	68 40 14 00 00       	push   $0x1440
+ 40e:	56                   	push   %esi
+ 40f:	e8 5f 03 00 00       	call   773 <write>
+ 414:	c7 04 24 40 14 00 00 	movl   $0x1440,(%esp)
+ 41b:	89 c7                	mov    %eax,%edi
+ 41d:	e8 7e 01 00 00       	call   5a0 <strlen>
+ 422:	83 c4 10             	add    $0x10,%esp
+ 425:	39 c7                	cmp    %eax,%edi
+ 427:	0f 85 90 fc ff ff    	jne    bd <main+0xbd>
+    close(fileDescriptorThree);
+ 42d:	83 ec 0c             	sub    $0xc,%esp
+ 430:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 436:	56                   	push   %esi
+ 437:	e8 3f 03 00 00       	call   77b <close>
+    printf(1, "Printing out extent file: %s\n\n", argv[1]);
+ 43c:	83 c4 0c             	add    $0xc,%esp
+ 43f:	ff 73 04             	push   0x4(%ebx)
+ 442:	68 f8 0e 00 00       	push   $0xef8
+ 447:	6a 01                	push   $0x1
+ 449:	e8 a2 04 00 00       	call   8f0 <printf>
+    if((fileDescriptorThree2 = open(argv[1], O_RDONLY)) < 0) {
+ 44e:	58                   	pop    %eax
+ 44f:	5a                   	pop    %edx
+ 450:	6a 00                	push   $0x0
+ 452:	ff 73 04             	push   0x4(%ebx)
+ 455:	e8 39 03 00 00       	call   793 <open>
+ 45a:	83 c4 10             	add    $0x10,%esp
+ 45d:	89 c6                	mov    %eax,%esi
+ 45f:	85 c0                	test   %eax,%eax
+ 461:	79 26                	jns    489 <main+0x489>
+ 463:	e9 cc fd ff ff       	jmp    234 <main+0x234>
+    // reading and printing code below from xv6's cat.c file.
+    int numberBytesRead2;
+    while ((numberBytesRead2 = read(fileDescriptorThree2, buf3, sizeof(buf3))) > 0)
+    { 
+        // printf(1,"\n1 n2: %d", n2);
+        if (write(1, buf3, numberBytesRead2) != numberBytesRead2)
+ 468:	50                   	push   %eax
+ 469:	52                   	push   %edx
+ 46a:	89 95 34 f8 ff ff    	mov    %edx,-0x7cc(%ebp)
+ 470:	57                   	push   %edi
+ 471:	6a 01                	push   $0x1
+ 473:	e8 fb 02 00 00       	call   773 <write>
+ 478:	8b 95 34 f8 ff ff    	mov    -0x7cc(%ebp),%edx
+ 47e:	83 c4 10             	add    $0x10,%esp
+ 481:	39 d0                	cmp    %edx,%eax
+ 483:	0f 85 98 fd ff ff    	jne    221 <main+0x221>
+    while ((numberBytesRead2 = read(fileDescriptorThree2, buf3, sizeof(buf3))) > 0)
+ 489:	50                   	push   %eax
+ 48a:	68 00 02 00 00       	push   $0x200
+ 48f:	57                   	push   %edi
+ 490:	56                   	push   %esi
+ 491:	e8 d5 02 00 00       	call   76b <read>
+ 496:	83 c4 10             	add    $0x10,%esp
+ 499:	89 c2                	mov    %eax,%edx
+ 49b:	85 c0                	test   %eax,%eax
+ 49d:	7f c9                	jg     468 <main+0x468>
+            exit();
+        }
+    }
+            // printf(1,"\n2 n2: %d", n2);
+
+    printf(1, "\n");
+ 49f:	51                   	push   %ecx
+ 4a0:	51                   	push   %ecx
+ 4a1:	68 bb 17 00 00       	push   $0x17bb
+ 4a6:	6a 01                	push   $0x1
+ 4a8:	e8 43 04 00 00       	call   8f0 <printf>
+    close(fileDescriptorThree2);
+ 4ad:	89 34 24             	mov    %esi,(%esp)
+ 4b0:	e8 c6 02 00 00       	call   77b <close>
+
+
+    printf(1, "\n\nExtent file has been successfully extended, written, and read again :). Calling exec() on a child process to run the stat user program on our extent file to see updates: %s...\n", argv[1]);
+ 4b5:	83 c4 0c             	add    $0xc,%esp
+ 4b8:	ff 73 04             	push   0x4(%ebx)
+ 4bb:	68 08 17 00 00       	push   $0x1708
+ 4c0:	6a 01                	push   $0x1
+ 4c2:	e8 29 04 00 00       	call   8f0 <printf>
+    int pid3 = fork();
+ 4c7:	e8 7f 02 00 00       	call   74b <fork>
+    if (pid3 == 0) {
+ 4cc:	83 c4 10             	add    $0x10,%esp
+ 4cf:	85 c0                	test   %eax,%eax
+ 4d1:	75 33                	jne    506 <main+0x506>
+        // run the stat user program for our new file
+        char *args[] = {"stat", argv[1], NULL}; // list of arguments for stat, the last arg must always be NULL
+ 4d3:	c7 85 3c f8 ff ff bd 	movl   $0x17bd,-0x7c4(%ebp)
+ 4da:	17 00 00 
+ 4dd:	8b 43 04             	mov    0x4(%ebx),%eax
+ 4e0:	89 85 40 f8 ff ff    	mov    %eax,-0x7c0(%ebp)
+ 4e6:	31 c0                	xor    %eax,%eax
+ 4e8:	89 85 44 f8 ff ff    	mov    %eax,-0x7bc(%ebp)
+        exec(args[0], args);
+ 4ee:	8d 85 3c f8 ff ff    	lea    -0x7c4(%ebp),%eax
+ 4f4:	52                   	push   %edx
+ 4f5:	52                   	push   %edx
+ 4f6:	50                   	push   %eax
+ 4f7:	68 bd 17 00 00       	push   $0x17bd
+ 4fc:	e8 8a 02 00 00       	call   78b <exec>
+        exit();
+ 501:	e8 4d 02 00 00       	call   753 <exit>
+	}
+
+    pid3 = wait();
+ 506:	e8 50 02 00 00       	call   75b <wait>
+
+
+    exit();
+ 50b:	e8 43 02 00 00       	call   753 <exit>
+
+00000510 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 510:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 511:	31 c0                	xor    %eax,%eax
+{
+ 513:	89 e5                	mov    %esp,%ebp
+ 515:	53                   	push   %ebx
+ 516:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 519:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 520:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 524:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 527:	83 c0 01             	add    $0x1,%eax
+ 52a:	84 d2                	test   %dl,%dl
+ 52c:	75 f2                	jne    520 <strcpy+0x10>
+    ;
+  return os;
+}
+ 52e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 531:	89 c8                	mov    %ecx,%eax
+ 533:	c9                   	leave
+ 534:	c3                   	ret
+ 535:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+ 547:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 54a:	0f b6 02             	movzbl (%edx),%eax
+ 54d:	84 c0                	test   %al,%al
+ 54f:	75 17                	jne    568 <strcmp+0x28>
+ 551:	eb 3a                	jmp    58d <strcmp+0x4d>
+ 553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 557:	90                   	nop
+ 558:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 55c:	83 c2 01             	add    $0x1,%edx
+ 55f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 562:	84 c0                	test   %al,%al
+ 564:	74 1a                	je     580 <strcmp+0x40>
+    p++, q++;
+ 566:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 568:	0f b6 19             	movzbl (%ecx),%ebx
+ 56b:	38 c3                	cmp    %al,%bl
+ 56d:	74 e9                	je     558 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 56f:	29 d8                	sub    %ebx,%eax
+}
+ 571:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 574:	c9                   	leave
+ 575:	c3                   	ret
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 580:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 584:	31 c0                	xor    %eax,%eax
+ 586:	29 d8                	sub    %ebx,%eax
+}
+ 588:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 58b:	c9                   	leave
+ 58c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 58d:	0f b6 19             	movzbl (%ecx),%ebx
+ 590:	31 c0                	xor    %eax,%eax
+ 592:	eb db                	jmp    56f <strcmp+0x2f>
+ 594:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+
+000005a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5a9:	74 15                	je     5c0 <strlen+0x20>
+ 5ab:	31 c0                	xor    %eax,%eax
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 5b0:	83 c0 01             	add    $0x1,%eax
+ 5b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5b7:	89 c1                	mov    %eax,%ecx
+ 5b9:	75 f5                	jne    5b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 5bb:	89 c8                	mov    %ecx,%eax
+ 5bd:	5d                   	pop    %ebp
+ 5be:	c3                   	ret
+ 5bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 5c0:	31 c9                	xor    %ecx,%ecx
+}
+ 5c2:	5d                   	pop    %ebp
+ 5c3:	89 c8                	mov    %ecx,%eax
+ 5c5:	c3                   	ret
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 5d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5dd:	89 d7                	mov    %edx,%edi
+ 5df:	fc                   	cld
+ 5e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 5e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 5e5:	89 d0                	mov    %edx,%eax
+ 5e7:	c9                   	leave
+ 5e8:	c3                   	ret
+ 5e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5fa:	0f b6 10             	movzbl (%eax),%edx
+ 5fd:	84 d2                	test   %dl,%dl
+ 5ff:	75 12                	jne    613 <strchr+0x23>
+ 601:	eb 1d                	jmp    620 <strchr+0x30>
+ 603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 607:	90                   	nop
+ 608:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 60c:	83 c0 01             	add    $0x1,%eax
+ 60f:	84 d2                	test   %dl,%dl
+ 611:	74 0d                	je     620 <strchr+0x30>
+    if(*s == c)
+ 613:	38 d1                	cmp    %dl,%cl
+ 615:	75 f1                	jne    608 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 617:	5d                   	pop    %ebp
+ 618:	c3                   	ret
+ 619:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 620:	31 c0                	xor    %eax,%eax
+}
+ 622:	5d                   	pop    %ebp
+ 623:	c3                   	ret
+ 624:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+
+00000630 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 635:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 638:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 639:	31 db                	xor    %ebx,%ebx
+{
+ 63b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 63e:	eb 27                	jmp    667 <gets+0x37>
+    cc = read(0, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	6a 01                	push   $0x1
+ 645:	56                   	push   %esi
+ 646:	6a 00                	push   $0x0
+ 648:	e8 1e 01 00 00       	call   76b <read>
+    if(cc < 1)
+ 64d:	83 c4 10             	add    $0x10,%esp
+ 650:	85 c0                	test   %eax,%eax
+ 652:	7e 1d                	jle    671 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 654:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 658:	8b 55 08             	mov    0x8(%ebp),%edx
+ 65b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 65f:	3c 0a                	cmp    $0xa,%al
+ 661:	74 10                	je     673 <gets+0x43>
+ 663:	3c 0d                	cmp    $0xd,%al
+ 665:	74 0c                	je     673 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 667:	89 df                	mov    %ebx,%edi
+ 669:	83 c3 01             	add    $0x1,%ebx
+ 66c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 66f:	7c cf                	jl     640 <gets+0x10>
+ 671:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 673:	8b 45 08             	mov    0x8(%ebp),%eax
+ 676:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 67a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 67d:	5b                   	pop    %ebx
+ 67e:	5e                   	pop    %esi
+ 67f:	5f                   	pop    %edi
+ 680:	5d                   	pop    %ebp
+ 681:	c3                   	ret
+ 682:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 689:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <stat>:
+
+int stat(const char *n, struct stat *st)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	56                   	push   %esi
+ 694:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 695:	83 ec 08             	sub    $0x8,%esp
+ 698:	6a 00                	push   $0x0
+ 69a:	ff 75 08             	push   0x8(%ebp)
+ 69d:	e8 f1 00 00 00       	call   793 <open>
+  if(fd < 0)
+ 6a2:	83 c4 10             	add    $0x10,%esp
+ 6a5:	85 c0                	test   %eax,%eax
+ 6a7:	78 27                	js     6d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 6a9:	83 ec 08             	sub    $0x8,%esp
+ 6ac:	ff 75 0c             	push   0xc(%ebp)
+ 6af:	89 c3                	mov    %eax,%ebx
+ 6b1:	50                   	push   %eax
+ 6b2:	e8 f4 00 00 00       	call   7ab <fstat>
+  close(fd);
+ 6b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 6ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 6bc:	e8 ba 00 00 00       	call   77b <close>
+  return r;
+ 6c1:	83 c4 10             	add    $0x10,%esp
+}
+ 6c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 6c7:	89 f0                	mov    %esi,%eax
+ 6c9:	5b                   	pop    %ebx
+ 6ca:	5e                   	pop    %esi
+ 6cb:	5d                   	pop    %ebp
+ 6cc:	c3                   	ret
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 6d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6d5:	eb ed                	jmp    6c4 <stat+0x34>
+ 6d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6de:	66 90                	xchg   %ax,%ax
+
+000006e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	53                   	push   %ebx
+ 6e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 6e7:	0f be 02             	movsbl (%edx),%eax
+ 6ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6f5:	77 1e                	ja     715 <atoi+0x35>
+ 6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 700:	83 c2 01             	add    $0x1,%edx
+ 703:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 706:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 70a:	0f be 02             	movsbl (%edx),%eax
+ 70d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 710:	80 fb 09             	cmp    $0x9,%bl
+ 713:	76 eb                	jbe    700 <atoi+0x20>
+  return n;
+}
+ 715:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 718:	89 c8                	mov    %ecx,%eax
+ 71a:	c9                   	leave
+ 71b:	c3                   	ret
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	8b 45 10             	mov    0x10(%ebp),%eax
+ 728:	8b 55 08             	mov    0x8(%ebp),%edx
+ 72b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 72e:	85 c0                	test   %eax,%eax
+ 730:	7e 13                	jle    745 <memmove+0x25>
+ 732:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 734:	89 d7                	mov    %edx,%edi
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 740:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 741:	39 f8                	cmp    %edi,%eax
+ 743:	75 fb                	jne    740 <memmove+0x20>
+  return vdst;
+}
+ 745:	5e                   	pop    %esi
+ 746:	89 d0                	mov    %edx,%eax
+ 748:	5f                   	pop    %edi
+ 749:	5d                   	pop    %ebp
+ 74a:	c3                   	ret
+
+0000074b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 74b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <exit>:
+SYSCALL(exit)
+ 753:	b8 02 00 00 00       	mov    $0x2,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <wait>:
+SYSCALL(wait)
+ 75b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <pipe>:
+SYSCALL(pipe)
+ 763:	b8 04 00 00 00       	mov    $0x4,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <read>:
+SYSCALL(read)
+ 76b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <write>:
+SYSCALL(write)
+ 773:	b8 10 00 00 00       	mov    $0x10,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <close>:
+SYSCALL(close)
+ 77b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <kill>:
+SYSCALL(kill)
+ 783:	b8 06 00 00 00       	mov    $0x6,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <exec>:
+SYSCALL(exec)
+ 78b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <open>:
+SYSCALL(open)
+ 793:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <mknod>:
+SYSCALL(mknod)
+ 79b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <unlink>:
+SYSCALL(unlink)
+ 7a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <fstat>:
+SYSCALL(fstat)
+ 7ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <link>:
+SYSCALL(link)
+ 7b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <mkdir>:
+SYSCALL(mkdir)
+ 7bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <chdir>:
+SYSCALL(chdir)
+ 7c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <dup>:
+SYSCALL(dup)
+ 7cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <getpid>:
+SYSCALL(getpid)
+ 7d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <sbrk>:
+SYSCALL(sbrk)
+ 7db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <sleep>:
+SYSCALL(sleep)
+ 7e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <uptime>:
+SYSCALL(uptime)
+ 7eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <time_scheduled>:
+SYSCALL(time_scheduled)
+ 7f3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <set_sched_priority>:
+SYSCALL(set_sched_priority)
+ 7fb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <get_sched_priority>:
+SYSCALL(get_sched_priority)
+ 803:	b8 18 00 00 00       	mov    $0x18,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <fifo_position>:
+SYSCALL(fifo_position)
+ 80b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <printProcessTable>:
+SYSCALL(printProcessTable)
+ 813:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <symlink>:
+SYSCALL(symlink)
+ 81b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <lseek>:
+SYSCALL(lseek)
+ 823:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <fallocate>:
+SYSCALL(fallocate)
+ 82b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <iostats>:
+SYSCALL(iostats)
+ 833:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <fsync>:
+SYSCALL(fsync)
+ 83b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+ 843:	66 90                	xchg   %ax,%ax
+ 845:	66 90                	xchg   %ax,%ax
+ 847:	66 90                	xchg   %ax,%ax
+ 849:	66 90                	xchg   %ax,%ax
+ 84b:	66 90                	xchg   %ax,%ax
+ 84d:	66 90                	xchg   %ax,%ax
+ 84f:	90                   	nop
+
+00000850 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 858:	89 d1                	mov    %edx,%ecx
+{
+ 85a:	83 ec 3c             	sub    $0x3c,%esp
+ 85d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 860:	85 d2                	test   %edx,%edx
+ 862:	0f 89 80 00 00 00    	jns    8e8 <printint+0x98>
+ 868:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 86c:	74 7a                	je     8e8 <printint+0x98>
+    x = -xx;
+ 86e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 870:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 875:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 878:	31 f6                	xor    %esi,%esi
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 880:	89 c8                	mov    %ecx,%eax
+ 882:	31 d2                	xor    %edx,%edx
+ 884:	89 f7                	mov    %esi,%edi
+ 886:	f7 f3                	div    %ebx
+ 888:	8d 76 01             	lea    0x1(%esi),%esi
+ 88b:	0f b6 92 24 18 00 00 	movzbl 0x1824(%edx),%edx
+ 892:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 896:	89 ca                	mov    %ecx,%edx
+ 898:	89 c1                	mov    %eax,%ecx
+ 89a:	39 da                	cmp    %ebx,%edx
+ 89c:	73 e2                	jae    880 <printint+0x30>
+  if(neg)
+ 89e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8a1:	85 c0                	test   %eax,%eax
+ 8a3:	74 07                	je     8ac <printint+0x5c>
+    buf[i++] = '-';
+ 8a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8aa:	89 f7                	mov    %esi,%edi
+ 8ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8b2:	01 df                	add    %ebx,%edi
+ 8b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8bb:	83 ec 04             	sub    $0x4,%esp
+ 8be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8c4:	6a 01                	push   $0x1
+ 8c6:	50                   	push   %eax
+ 8c7:	56                   	push   %esi
+ 8c8:	e8 a6 fe ff ff       	call   773 <write>
+  while(--i >= 0)
+ 8cd:	89 f8                	mov    %edi,%eax
+ 8cf:	83 c4 10             	add    $0x10,%esp
+ 8d2:	83 ef 01             	sub    $0x1,%edi
+ 8d5:	39 d8                	cmp    %ebx,%eax
+ 8d7:	75 df                	jne    8b8 <printint+0x68>
+}
+ 8d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8dc:	5b                   	pop    %ebx
+ 8dd:	5e                   	pop    %esi
+ 8de:	5f                   	pop    %edi
+ 8df:	5d                   	pop    %ebp
+ 8e0:	c3                   	ret
+ 8e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8e8:	31 c0                	xor    %eax,%eax
+ 8ea:	eb 89                	jmp    875 <printint+0x25>
+ 8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	56                   	push   %esi
+ 8f5:	53                   	push   %ebx
+ 8f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 902:	83 c6 01             	add    $0x1,%esi
+ 905:	84 db                	test   %bl,%bl
+ 907:	74 67                	je     970 <printf+0x80>
+ 909:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 90c:	31 d2                	xor    %edx,%edx
+ 90e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 911:	eb 34                	jmp    947 <printf+0x57>
+ 913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 917:	90                   	nop
+ 918:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 91b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 920:	83 f8 25             	cmp    $0x25,%eax
+ 923:	74 18                	je     93d <printf+0x4d>
+  write(fd, &c, 1);
+ 925:	83 ec 04             	sub    $0x4,%esp
+ 928:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 92b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 92e:	6a 01                	push   $0x1
+ 930:	50                   	push   %eax
+ 931:	57                   	push   %edi
+ 932:	e8 3c fe ff ff       	call   773 <write>
+ 937:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 93a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 93d:	0f b6 1e             	movzbl (%esi),%ebx
+ 940:	83 c6 01             	add    $0x1,%esi
+ 943:	84 db                	test   %bl,%bl
+ 945:	74 29                	je     970 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 947:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 94a:	85 d2                	test   %edx,%edx
+ 94c:	74 ca                	je     918 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 94e:	83 fa 25             	cmp    $0x25,%edx
+ 951:	75 ea                	jne    93d <printf+0x4d>
+      if(c == 'd'){
+ 953:	83 f8 25             	cmp    $0x25,%eax
+ 956:	0f 84 24 01 00 00    	je     a80 <printf+0x190>
+ 95c:	83 e8 63             	sub    $0x63,%eax
+ 95f:	83 f8 15             	cmp    $0x15,%eax
+ 962:	77 1c                	ja     980 <printf+0x90>
+ 964:	ff 24 85 cc 17 00 00 	jmp    *0x17cc(,%eax,4)
+ 96b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 970:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 973:	5b                   	pop    %ebx
+ 974:	5e                   	pop    %esi
+ 975:	5f                   	pop    %edi
+ 976:	5d                   	pop    %ebp
+ 977:	c3                   	ret
+ 978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+  write(fd, &c, 1);
+ 980:	83 ec 04             	sub    $0x4,%esp
+ 983:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 986:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 98a:	6a 01                	push   $0x1
+ 98c:	52                   	push   %edx
+ 98d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 990:	57                   	push   %edi
+ 991:	e8 dd fd ff ff       	call   773 <write>
+ 996:	83 c4 0c             	add    $0xc,%esp
+ 999:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 99c:	6a 01                	push   $0x1
+ 99e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9a1:	52                   	push   %edx
+ 9a2:	57                   	push   %edi
+ 9a3:	e8 cb fd ff ff       	call   773 <write>
+        putc(fd, c);
+ 9a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9ab:	31 d2                	xor    %edx,%edx
+ 9ad:	eb 8e                	jmp    93d <printf+0x4d>
+ 9af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9b3:	83 ec 0c             	sub    $0xc,%esp
+ 9b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9bb:	8b 13                	mov    (%ebx),%edx
+ 9bd:	6a 00                	push   $0x0
+ 9bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9c4:	e8 87 fe ff ff       	call   850 <printint>
+        ap++;
+ 9c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9cf:	31 d2                	xor    %edx,%edx
+ 9d1:	e9 67 ff ff ff       	jmp    93d <printf+0x4d>
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9e5:	83 c0 04             	add    $0x4,%eax
+ 9e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9eb:	85 db                	test   %ebx,%ebx
+ 9ed:	0f 84 9d 00 00 00    	je     a90 <printf+0x1a0>
+        while(*s != 0){
+ 9f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9f8:	84 c0                	test   %al,%al
+ 9fa:	0f 84 3d ff ff ff    	je     93d <printf+0x4d>
+ a00:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a03:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a06:	89 de                	mov    %ebx,%esi
+ a08:	89 d3                	mov    %edx,%ebx
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a10:	83 ec 04             	sub    $0x4,%esp
+ a13:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a16:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a19:	6a 01                	push   $0x1
+ a1b:	53                   	push   %ebx
+ a1c:	57                   	push   %edi
+ a1d:	e8 51 fd ff ff       	call   773 <write>
+        while(*s != 0){
+ a22:	0f b6 06             	movzbl (%esi),%eax
+ a25:	83 c4 10             	add    $0x10,%esp
+ a28:	84 c0                	test   %al,%al
+ a2a:	75 e4                	jne    a10 <printf+0x120>
+      state = 0;
+ a2c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a2f:	31 d2                	xor    %edx,%edx
+ a31:	e9 07 ff ff ff       	jmp    93d <printf+0x4d>
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a4b:	8b 13                	mov    (%ebx),%edx
+ a4d:	6a 01                	push   $0x1
+ a4f:	e9 6b ff ff ff       	jmp    9bf <printf+0xcf>
+ a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a58:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a5b:	83 ec 04             	sub    $0x4,%esp
+ a5e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a61:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a63:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a66:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a69:	6a 01                	push   $0x1
+ a6b:	52                   	push   %edx
+ a6c:	57                   	push   %edi
+ a6d:	e8 01 fd ff ff       	call   773 <write>
+        ap++;
+ a72:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a75:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a78:	31 d2                	xor    %edx,%edx
+ a7a:	e9 be fe ff ff       	jmp    93d <printf+0x4d>
+ a7f:	90                   	nop
+  write(fd, &c, 1);
+ a80:	83 ec 04             	sub    $0x4,%esp
+ a83:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a86:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a89:	6a 01                	push   $0x1
+ a8b:	e9 11 ff ff ff       	jmp    9a1 <printf+0xb1>
+ a90:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a95:	bb c2 17 00 00       	mov    $0x17c2,%ebx
+ a9a:	e9 61 ff ff ff       	jmp    a00 <printf+0x110>
+ a9f:	90                   	nop
+
+00000aa0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ aa0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aa1:	a1 cc 1a 00 00       	mov    0x1acc,%eax
+{
+ aa6:	89 e5                	mov    %esp,%ebp
+ aa8:	57                   	push   %edi
+ aa9:	56                   	push   %esi
+ aaa:	53                   	push   %ebx
+ aab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ aae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ab8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ abc:	39 ca                	cmp    %ecx,%edx
+ abe:	73 30                	jae    af0 <free+0x50>
+ ac0:	39 c1                	cmp    %eax,%ecx
+ ac2:	72 04                	jb     ac8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ac4:	39 c2                	cmp    %eax,%edx
+ ac6:	72 f0                	jb     ab8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ac8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ acb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ ace:	39 f8                	cmp    %edi,%eax
+ ad0:	74 2e                	je     b00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ad2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ad5:	8b 42 04             	mov    0x4(%edx),%eax
+ ad8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ adb:	39 f1                	cmp    %esi,%ecx
+ add:	74 38                	je     b17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ adf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ae1:	5b                   	pop    %ebx
+  freep = p;
+ ae2:	89 15 cc 1a 00 00    	mov    %edx,0x1acc
+}
+ ae8:	5e                   	pop    %esi
+ ae9:	5f                   	pop    %edi
+ aea:	5d                   	pop    %ebp
+ aeb:	c3                   	ret
+ aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ af0:	39 c1                	cmp    %eax,%ecx
+ af2:	72 d0                	jb     ac4 <free+0x24>
+ af4:	eb c2                	jmp    ab8 <free+0x18>
+ af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b00:	03 70 04             	add    0x4(%eax),%esi
+ b03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b06:	8b 02                	mov    (%edx),%eax
+ b08:	8b 00                	mov    (%eax),%eax
+ b0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b0d:	8b 42 04             	mov    0x4(%edx),%eax
+ b10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b13:	39 f1                	cmp    %esi,%ecx
+ b15:	75 c8                	jne    adf <free+0x3f>
+    p->s.size += bp->s.size;
+ b17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b1a:	89 15 cc 1a 00 00    	mov    %edx,0x1acc
+    p->s.size += bp->s.size;
+ b20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b26:	89 0a                	mov    %ecx,(%edx)
+}
+ b28:	5b                   	pop    %ebx
+ b29:	5e                   	pop    %esi
+ b2a:	5f                   	pop    %edi
+ b2b:	5d                   	pop    %ebp
+ b2c:	c3                   	ret
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	57                   	push   %edi
+ b34:	56                   	push   %esi
+ b35:	53                   	push   %ebx
+ b36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b3c:	8b 15 cc 1a 00 00    	mov    0x1acc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b42:	8d 78 07             	lea    0x7(%eax),%edi
+ b45:	c1 ef 03             	shr    $0x3,%edi
+ b48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b4b:	85 d2                	test   %edx,%edx
+ b4d:	0f 84 8d 00 00 00    	je     be0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b55:	8b 48 04             	mov    0x4(%eax),%ecx
+ b58:	39 f9                	cmp    %edi,%ecx
+ b5a:	73 64                	jae    bc0 <malloc+0x90>
+  if(nu < 4096)
+ b5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b61:	39 df                	cmp    %ebx,%edi
+ b63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b6d:	eb 0a                	jmp    b79 <malloc+0x49>
+ b6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b72:	8b 48 04             	mov    0x4(%eax),%ecx
+ b75:	39 f9                	cmp    %edi,%ecx
+ b77:	73 47                	jae    bc0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b79:	89 c2                	mov    %eax,%edx
+ b7b:	39 05 cc 1a 00 00    	cmp    %eax,0x1acc
+ b81:	75 ed                	jne    b70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b83:	83 ec 0c             	sub    $0xc,%esp
+ b86:	56                   	push   %esi
+ b87:	e8 4f fc ff ff       	call   7db <sbrk>
+  if(p == (char*)-1)
+ b8c:	83 c4 10             	add    $0x10,%esp
+ b8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b92:	74 1c                	je     bb0 <malloc+0x80>
+  hp->s.size = nu;
+ b94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b97:	83 ec 0c             	sub    $0xc,%esp
+ b9a:	83 c0 08             	add    $0x8,%eax
+ b9d:	50                   	push   %eax
+ b9e:	e8 fd fe ff ff       	call   aa0 <free>
+  return freep;
+ ba3:	8b 15 cc 1a 00 00    	mov    0x1acc,%edx
+      if((p = morecore(nunits)) == 0)
+ ba9:	83 c4 10             	add    $0x10,%esp
+ bac:	85 d2                	test   %edx,%edx
+ bae:	75 c0                	jne    b70 <malloc+0x40>
+        return 0;
+  }
+}
+ bb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ bb3:	31 c0                	xor    %eax,%eax
+}
+ bb5:	5b                   	pop    %ebx
+ bb6:	5e                   	pop    %esi
+ bb7:	5f                   	pop    %edi
+ bb8:	5d                   	pop    %ebp
+ bb9:	c3                   	ret
+ bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ bc0:	39 cf                	cmp    %ecx,%edi
+ bc2:	74 4c                	je     c10 <malloc+0xe0>
+        p->s.size -= nunits;
+ bc4:	29 f9                	sub    %edi,%ecx
+ bc6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ bc9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bcc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ bcf:	89 15 cc 1a 00 00    	mov    %edx,0x1acc
+}
+ bd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ bd8:	83 c0 08             	add    $0x8,%eax
+}
+ bdb:	5b                   	pop    %ebx
+ bdc:	5e                   	pop    %esi
+ bdd:	5f                   	pop    %edi
+ bde:	5d                   	pop    %ebp
+ bdf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ be0:	c7 05 cc 1a 00 00 d0 	movl   $0x1ad0,0x1acc
+ be7:	1a 00 00 
+    base.s.size = 0;
+ bea:	b8 d0 1a 00 00       	mov    $0x1ad0,%eax
+    base.s.ptr = freep = prevp = &base;
+ bef:	c7 05 d0 1a 00 00 d0 	movl   $0x1ad0,0x1ad0
+ bf6:	1a 00 00 
+    base.s.size = 0;
+ bf9:	c7 05 d4 1a 00 00 00 	movl   $0x0,0x1ad4
+ c00:	00 00 00 
+    if(p->s.size >= nunits){
+ c03:	e9 54 ff ff ff       	jmp    b5c <malloc+0x2c>
+ c08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c10:	8b 08                	mov    (%eax),%ecx
+ c12:	89 0a                	mov    %ecx,(%edx)
+ c14:	eb b9                	jmp    bcf <malloc+0x9f>
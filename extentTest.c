@@ -91,6 +91,14 @@ int main(int argc, char *argv[])
             exit();
     }
 
+    // Writes land at the file offset, so seek to the end to append.
+    struct stat st2;
+    if(fstat(fileDescriptor4, &st2) < 0 || lseek(fileDescriptor4, st2.size) != st2.size) {
+        printf(2, "testExtent failed: cannot seek to the end of the extent file.\n");
+        close(fileDescriptor4);
+        exit();
+    }
+
     printf(1, "\nwriting content 2. content 2 length: %d, size: %d\n", strlen(fileContentWrite2), sizeof(fileContentWrite2));
     if (write(fileDescriptor4, fileContentWrite2, strlen(fileContentWrite2)) != strlen(fileContentWrite2)) {
         printf(2, "testExtent failed: failed to write the content to the extent file.\n");
@@ -148,6 +156,14 @@ int main(int argc, char *argv[])
             exit();
     }
 
+    // Writes land at the file offset, so seek to the end to append.
+    struct stat st3;
+    if(fstat(fileDescriptorThree, &st3) < 0 || lseek(fileDescriptorThree, st3.size) != st3.size) {
+        printf(2, "testExtent failed: cannot seek to the end of the extent file.\n");
+        close(fileDescriptorThree);
+        exit();
+    }
+
     printf(1, "\nwriting content 3. content 3 length: %d, size: %d\n", strlen(fileContentWrite3), sizeof(fileContentWrite3));
     if (write(fileDescriptorThree, fileContentWrite3, strlen(fileContentWrite3)) != strlen(fileContentWrite3)) {
         printf(2, "testExtent failed: failed to write the content to the extent file.\n");
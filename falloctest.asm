@@ -0,0 +1,1727 @@
+
+_falloctest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb fb 0c 00 00       	mov    $0xcfb,%ebx
+  15:	51                   	push   %ecx
+  16:	81 ec e8 00 00 00    	sub    $0xe8,%esp
+  char *name = argc > 1 ? argv[1] : "falloc.tmp";
+  1c:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1f:	8b 41 04             	mov    0x4(%ecx),%eax
+  char *name = argc > 1 ? argv[1] : "falloc.tmp";
+  22:	7e 03                	jle    27 <main+0x27>
+  24:	8b 58 04             	mov    0x4(%eax),%ebx
+  struct stat st;
+  int fd, i;
+
+  printf(1, "falloctest starting\n");
+  27:	83 ec 08             	sub    $0x8,%esp
+  2a:	68 06 0d 00 00       	push   $0xd06
+  2f:	6a 01                	push   $0x1
+  31:	e8 4a 09 00 00       	call   980 <printf>
+  unlink(name);
+  36:	89 1c 24             	mov    %ebx,(%esp)
+  39:	e8 f5 07 00 00       	call   833 <unlink>
+  if((fd = open(name, O_EXTENT)) < 0)
+  3e:	5e                   	pop    %esi
+  3f:	5f                   	pop    %edi
+  40:	6a 04                	push   $0x4
+  42:	53                   	push   %ebx
+  43:	e8 db 07 00 00       	call   823 <open>
+  48:	83 c4 10             	add    $0x10,%esp
+  4b:	85 c0                	test   %eax,%eax
+  4d:	78 6d                	js     bc <main+0xbc>
+    fail("cannot create extent file");
+  close(fd);
+  4f:	83 ec 0c             	sub    $0xc,%esp
+  52:	50                   	push   %eax
+  53:	e8 b3 07 00 00       	call   80b <close>
+  if((fd = open(name, O_RDWR)) < 0)
+  58:	5a                   	pop    %edx
+  59:	59                   	pop    %ecx
+  5a:	6a 02                	push   $0x2
+  5c:	53                   	push   %ebx
+  5d:	e8 c1 07 00 00       	call   823 <open>
+  62:	83 c4 10             	add    $0x10,%esp
+  65:	89 c6                	mov    %eax,%esi
+  67:	85 c0                	test   %eax,%eax
+  69:	78 44                	js     af <main+0xaf>
+    fail("cannot open extent file");
+
+  // A small reservation grows the file and reads as zeros.
+  if(fallocate(fd, 0, 3*BSIZE + 100) != 0)
+  6b:	50                   	push   %eax
+  6c:	68 64 06 00 00       	push   $0x664
+  71:	6a 00                	push   $0x0
+  73:	56                   	push   %esi
+  74:	e8 42 08 00 00       	call   8bb <fallocate>
+  79:	83 c4 10             	add    $0x10,%esp
+  7c:	85 c0                	test   %eax,%eax
+  7e:	75 49                	jne    c9 <main+0xc9>
+    fail("fallocate");
+  if(fstat(fd, &st) < 0 || st.size != 3*BSIZE + 100)
+  80:	8d bd 18 ff ff ff    	lea    -0xe8(%ebp),%edi
+  86:	50                   	push   %eax
+  87:	50                   	push   %eax
+  88:	57                   	push   %edi
+  89:	56                   	push   %esi
+  8a:	e8 ac 07 00 00       	call   83b <fstat>
+  8f:	83 c4 10             	add    $0x10,%esp
+  92:	85 c0                	test   %eax,%eax
+  94:	78 0c                	js     a2 <main+0xa2>
+  96:	81 bd 28 ff ff ff 64 	cmpl   $0x664,-0xd8(%ebp)
+  9d:	06 00 00 
+  a0:	74 34                	je     d6 <main+0xd6>
+    fail("size after fallocate");
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	68 4d 0d 00 00       	push   $0xd4d
+  aa:	e8 31 04 00 00       	call   4e0 <fail>
+    fail("cannot open extent file");
+  af:	83 ec 0c             	sub    $0xc,%esp
+  b2:	68 35 0d 00 00       	push   $0xd35
+  b7:	e8 24 04 00 00       	call   4e0 <fail>
+    fail("cannot create extent file");
+  bc:	83 ec 0c             	sub    $0xc,%esp
+  bf:	68 1b 0d 00 00       	push   $0xd1b
+  c4:	e8 17 04 00 00       	call   4e0 <fail>
+    fail("fallocate");
+  c9:	83 ec 0c             	sub    $0xc,%esp
+  cc:	68 da 0d 00 00       	push   $0xdda
+  d1:	e8 0a 04 00 00       	call   4e0 <fail>
+  checkzero(fd, 0, st.size);
+  d6:	50                   	push   %eax
+  d7:	68 64 06 00 00       	push   $0x664
+  dc:	6a 00                	push   $0x0
+  de:	56                   	push   %esi
+  df:	e8 1c 04 00 00       	call   500 <checkzero>
+
+  // Reserving inside the file leaves its size alone.
+  if(fallocate(fd, BSIZE, 10) != 0)
+  e4:	83 c4 0c             	add    $0xc,%esp
+  e7:	6a 0a                	push   $0xa
+  e9:	68 00 02 00 00       	push   $0x200
+  ee:	56                   	push   %esi
+  ef:	e8 c7 07 00 00       	call   8bb <fallocate>
+  f4:	83 c4 10             	add    $0x10,%esp
+  f7:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+  fd:	85 c0                	test   %eax,%eax
+  ff:	74 0d                	je     10e <main+0x10e>
+    fail("fallocate inside the file");
+ 101:	83 ec 0c             	sub    $0xc,%esp
+ 104:	68 62 0d 00 00       	push   $0xd62
+ 109:	e8 d2 03 00 00       	call   4e0 <fail>
+  if(fstat(fd, &st) < 0 || st.size != 3*BSIZE + 100)
+ 10e:	50                   	push   %eax
+ 10f:	50                   	push   %eax
+ 110:	57                   	push   %edi
+ 111:	56                   	push   %esi
+ 112:	e8 24 07 00 00       	call   83b <fstat>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	78 0c                	js     12a <main+0x12a>
+ 11e:	81 bd 28 ff ff ff 64 	cmpl   $0x664,-0xd8(%ebp)
+ 125:	06 00 00 
+ 128:	74 0d                	je     137 <main+0x137>
+    fail("fallocate inside the file changed its size");
+ 12a:	83 ec 0c             	sub    $0xc,%esp
+ 12d:	68 54 0e 00 00       	push   $0xe54
+ 132:	e8 a9 03 00 00       	call   4e0 <fail>
+
+  // Writing one reserved block leaves the blocks around it zero.
+  for(i = 0; i < BSIZE; i++)
+    buf[i] = 'a' + i % 26;
+ 137:	89 9d 10 ff ff ff    	mov    %ebx,-0xf0(%ebp)
+  for(i = 0; i < BSIZE; i++)
+ 13d:	31 c9                	xor    %ecx,%ecx
+    buf[i] = 'a' + i % 26;
+ 13f:	89 c8                	mov    %ecx,%eax
+ 141:	bb 1a 00 00 00       	mov    $0x1a,%ebx
+  for(i = 0; i < BSIZE; i++)
+ 146:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+ 149:	99                   	cltd
+ 14a:	f7 fb                	idiv   %ebx
+ 14c:	83 c2 61             	add    $0x61,%edx
+ 14f:	88 91 3f 12 00 00    	mov    %dl,0x123f(%ecx)
+  for(i = 0; i < BSIZE; i++)
+ 155:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+ 15b:	75 e2                	jne    13f <main+0x13f>
+  if(lseek(fd, 2*BSIZE) != 2*BSIZE || write(fd, buf, BSIZE) != BSIZE)
+ 15d:	8b 9d 10 ff ff ff    	mov    -0xf0(%ebp),%ebx
+ 163:	50                   	push   %eax
+ 164:	50                   	push   %eax
+ 165:	68 00 04 00 00       	push   $0x400
+ 16a:	56                   	push   %esi
+ 16b:	e8 43 07 00 00       	call   8b3 <lseek>
+ 170:	83 c4 10             	add    $0x10,%esp
+ 173:	3d 00 04 00 00       	cmp    $0x400,%eax
+ 178:	74 0d                	je     187 <main+0x187>
+    fail("write into reserved block");
+ 17a:	83 ec 0c             	sub    $0xc,%esp
+ 17d:	68 7c 0d 00 00       	push   $0xd7c
+ 182:	e8 59 03 00 00       	call   4e0 <fail>
+  if(lseek(fd, 2*BSIZE) != 2*BSIZE || write(fd, buf, BSIZE) != BSIZE)
+ 187:	51                   	push   %ecx
+ 188:	68 00 02 00 00       	push   $0x200
+ 18d:	68 40 12 00 00       	push   $0x1240
+ 192:	56                   	push   %esi
+ 193:	e8 6b 06 00 00       	call   803 <write>
+ 198:	83 c4 10             	add    $0x10,%esp
+ 19b:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1a0:	75 d8                	jne    17a <main+0x17a>
+  checkzero(fd, 0, 2*BSIZE);
+ 1a2:	50                   	push   %eax
+ 1a3:	68 00 04 00 00       	push   $0x400
+ 1a8:	6a 00                	push   $0x0
+ 1aa:	56                   	push   %esi
+ 1ab:	e8 50 03 00 00       	call   500 <checkzero>
+  if(lseek(fd, 2*BSIZE) != 2*BSIZE || read(fd, buf, BSIZE) != BSIZE)
+ 1b0:	58                   	pop    %eax
+ 1b1:	5a                   	pop    %edx
+ 1b2:	68 00 04 00 00       	push   $0x400
+ 1b7:	56                   	push   %esi
+ 1b8:	e8 f6 06 00 00       	call   8b3 <lseek>
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	3d 00 04 00 00       	cmp    $0x400,%eax
+ 1c5:	74 0d                	je     1d4 <main+0x1d4>
+    fail("read back written block");
+ 1c7:	83 ec 0c             	sub    $0xc,%esp
+ 1ca:	68 96 0d 00 00       	push   $0xd96
+ 1cf:	e8 0c 03 00 00       	call   4e0 <fail>
+  if(lseek(fd, 2*BSIZE) != 2*BSIZE || read(fd, buf, BSIZE) != BSIZE)
+ 1d4:	50                   	push   %eax
+ 1d5:	68 00 02 00 00       	push   $0x200
+ 1da:	68 40 12 00 00       	push   $0x1240
+ 1df:	56                   	push   %esi
+ 1e0:	e8 16 06 00 00       	call   7fb <read>
+ 1e5:	83 c4 10             	add    $0x10,%esp
+ 1e8:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1ed:	75 d8                	jne    1c7 <main+0x1c7>
+  for(i = 0; i < BSIZE; i++)
+    if(buf[i] != 'a' + i % 26)
+ 1ef:	89 9d 10 ff ff ff    	mov    %ebx,-0xf0(%ebp)
+ 1f5:	8b 8d 14 ff ff ff    	mov    -0xec(%ebp),%ecx
+ 1fb:	eb 0b                	jmp    208 <main+0x208>
+  for(i = 0; i < BSIZE; i++)
+ 1fd:	83 c1 01             	add    $0x1,%ecx
+ 200:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+ 206:	74 2f                	je     237 <main+0x237>
+    if(buf[i] != 'a' + i % 26)
+ 208:	0f be 81 40 12 00 00 	movsbl 0x1240(%ecx),%eax
+ 20f:	bb 1a 00 00 00       	mov    $0x1a,%ebx
+ 214:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+ 21a:	89 c8                	mov    %ecx,%eax
+ 21c:	99                   	cltd
+ 21d:	f7 fb                	idiv   %ebx
+ 21f:	83 c2 61             	add    $0x61,%edx
+ 222:	39 95 14 ff ff ff    	cmp    %edx,-0xec(%ebp)
+ 228:	74 d3                	je     1fd <main+0x1fd>
+      fail("written block has wrong data");
+ 22a:	83 ec 0c             	sub    $0xc,%esp
+ 22d:	68 ae 0d 00 00       	push   $0xdae
+ 232:	e8 a9 02 00 00       	call   4e0 <fail>
+  checkzero(fd, 3*BSIZE, 100);
+ 237:	8b 9d 10 ff ff ff    	mov    -0xf0(%ebp),%ebx
+ 23d:	50                   	push   %eax
+ 23e:	6a 64                	push   $0x64
+ 240:	68 00 06 00 00       	push   $0x600
+ 245:	56                   	push   %esi
+ 246:	e8 b5 02 00 00       	call   500 <checkzero>
+
+  // A reservation bigger than one bitmap block's worth of blocks
+  // is allocated as several runs.
+  if(fallocate(fd, 0, BIG) != 0)
+ 24b:	83 c4 0c             	add    $0xc,%esp
+ 24e:	68 00 e0 2e 00       	push   $0x2ee000
+ 253:	6a 00                	push   $0x0
+ 255:	56                   	push   %esi
+ 256:	e8 60 06 00 00       	call   8bb <fallocate>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	85 c0                	test   %eax,%eax
+ 260:	74 0d                	je     26f <main+0x26f>
+    fail("big fallocate");
+ 262:	83 ec 0c             	sub    $0xc,%esp
+ 265:	68 d6 0d 00 00       	push   $0xdd6
+ 26a:	e8 71 02 00 00       	call   4e0 <fail>
+  if(fstat(fd, &st) < 0 || st.size != BIG)
+ 26f:	50                   	push   %eax
+ 270:	50                   	push   %eax
+ 271:	57                   	push   %edi
+ 272:	56                   	push   %esi
+ 273:	e8 c3 05 00 00       	call   83b <fstat>
+ 278:	83 c4 10             	add    $0x10,%esp
+ 27b:	85 c0                	test   %eax,%eax
+ 27d:	78 0c                	js     28b <main+0x28b>
+ 27f:	81 bd 28 ff ff ff 00 	cmpl   $0x2ee000,-0xd8(%ebp)
+ 286:	e0 2e 00 
+ 289:	74 0d                	je     298 <main+0x298>
+    fail("size after big fallocate");
+ 28b:	83 ec 0c             	sub    $0xc,%esp
+ 28e:	68 cb 0d 00 00       	push   $0xdcb
+ 293:	e8 48 02 00 00       	call   4e0 <fail>
+  checkzero(fd, 3*BSIZE, BIG - 3*BSIZE);
+ 298:	57                   	push   %edi
+
+  // Scattered writes, last first, split the reservation without
+  // touching the blocks between them.
+  for(i = BIG/BSIZE - 10; i > 3; i -= STRIDE){
+ 299:	bf 66 17 00 00       	mov    $0x1766,%edi
+  checkzero(fd, 3*BSIZE, BIG - 3*BSIZE);
+ 29e:	68 00 da 2e 00       	push   $0x2eda00
+ 2a3:	68 00 06 00 00       	push   $0x600
+ 2a8:	56                   	push   %esi
+ 2a9:	e8 52 02 00 00       	call   500 <checkzero>
+ 2ae:	83 c4 10             	add    $0x10,%esp
+ 2b1:	eb 23                	jmp    2d6 <main+0x2d6>
+    memset(buf, 'A' + i % 26, BSIZE);
+    if(lseek(fd, i*BSIZE) != i*BSIZE || write(fd, buf, BSIZE) != BSIZE)
+ 2b3:	50                   	push   %eax
+ 2b4:	68 00 02 00 00       	push   $0x200
+ 2b9:	68 40 12 00 00       	push   $0x1240
+ 2be:	56                   	push   %esi
+ 2bf:	e8 3f 05 00 00       	call   803 <write>
+ 2c4:	83 c4 10             	add    $0x10,%esp
+ 2c7:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 2cc:	75 47                	jne    315 <main+0x315>
+  for(i = BIG/BSIZE - 10; i > 3; i -= STRIDE){
+ 2ce:	83 ef 25             	sub    $0x25,%edi
+ 2d1:	83 ff fc             	cmp    $0xfffffffc,%edi
+ 2d4:	74 4c                	je     322 <main+0x322>
+    memset(buf, 'A' + i % 26, BSIZE);
+ 2d6:	50                   	push   %eax
+ 2d7:	89 f8                	mov    %edi,%eax
+ 2d9:	b9 1a 00 00 00       	mov    $0x1a,%ecx
+ 2de:	99                   	cltd
+ 2df:	68 00 02 00 00       	push   $0x200
+ 2e4:	f7 f9                	idiv   %ecx
+ 2e6:	83 c2 41             	add    $0x41,%edx
+ 2e9:	52                   	push   %edx
+ 2ea:	68 40 12 00 00       	push   $0x1240
+ 2ef:	e8 6c 03 00 00       	call   660 <memset>
+    if(lseek(fd, i*BSIZE) != i*BSIZE || write(fd, buf, BSIZE) != BSIZE)
+ 2f4:	89 fa                	mov    %edi,%edx
+ 2f6:	58                   	pop    %eax
+ 2f7:	59                   	pop    %ecx
+ 2f8:	c1 e2 09             	shl    $0x9,%edx
+ 2fb:	52                   	push   %edx
+ 2fc:	89 95 14 ff ff ff    	mov    %edx,-0xec(%ebp)
+ 302:	56                   	push   %esi
+ 303:	e8 ab 05 00 00       	call   8b3 <lseek>
+ 308:	8b 95 14 ff ff ff    	mov    -0xec(%ebp),%edx
+ 30e:	83 c4 10             	add    $0x10,%esp
+ 311:	39 c2                	cmp    %eax,%edx
+ 313:	74 9e                	je     2b3 <main+0x2b3>
+      fail("scattered write");
+ 315:	83 ec 0c             	sub    $0xc,%esp
+ 318:	68 ee 0d 00 00       	push   $0xdee
+ 31d:	e8 be 01 00 00       	call   4e0 <fail>
+  }
+  for(i = BIG/BSIZE - 10; i > 3; i -= STRIDE){
+ 322:	bf 66 17 00 00       	mov    $0x1766,%edi
+ 327:	eb 4a                	jmp    373 <main+0x373>
+    if(i - STRIDE > 3)
+      checkzero(fd, (i - STRIDE + 1)*BSIZE, (STRIDE - 1)*BSIZE);
+    if(lseek(fd, i*BSIZE) != i*BSIZE || read(fd, buf, BSIZE) != BSIZE)
+ 329:	50                   	push   %eax
+ 32a:	68 00 02 00 00       	push   $0x200
+ 32f:	68 40 12 00 00       	push   $0x1240
+ 334:	56                   	push   %esi
+ 335:	e8 c1 04 00 00       	call   7fb <read>
+ 33a:	83 c4 10             	add    $0x10,%esp
+ 33d:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 342:	75 73                	jne    3b7 <main+0x3b7>
+      fail("read back scattered write");
+    if(buf[0] != 'A' + i % 26 || buf[BSIZE-1] != 'A' + i % 26)
+ 344:	89 f8                	mov    %edi,%eax
+ 346:	b9 1a 00 00 00       	mov    $0x1a,%ecx
+ 34b:	99                   	cltd
+ 34c:	f7 f9                	idiv   %ecx
+ 34e:	0f be 05 40 12 00 00 	movsbl 0x1240,%eax
+ 355:	83 c2 41             	add    $0x41,%edx
+ 358:	39 d0                	cmp    %edx,%eax
+ 35a:	0f 85 88 00 00 00    	jne    3e8 <main+0x3e8>
+ 360:	0f be 15 3f 14 00 00 	movsbl 0x143f,%edx
+ 367:	39 d0                	cmp    %edx,%eax
+ 369:	75 7d                	jne    3e8 <main+0x3e8>
+  for(i = BIG/BSIZE - 10; i > 3; i -= STRIDE){
+ 36b:	83 ef 25             	sub    $0x25,%edi
+ 36e:	83 ff fc             	cmp    $0xfffffffc,%edi
+ 371:	74 51                	je     3c4 <main+0x3c4>
+    if(i - STRIDE > 3)
+ 373:	83 ff 28             	cmp    $0x28,%edi
+ 376:	7e 1a                	jle    392 <main+0x392>
+      checkzero(fd, (i - STRIDE + 1)*BSIZE, (STRIDE - 1)*BSIZE);
+ 378:	50                   	push   %eax
+ 379:	89 f8                	mov    %edi,%eax
+ 37b:	c1 e0 09             	shl    $0x9,%eax
+ 37e:	68 00 48 00 00       	push   $0x4800
+ 383:	2d 00 48 00 00       	sub    $0x4800,%eax
+ 388:	50                   	push   %eax
+ 389:	56                   	push   %esi
+ 38a:	e8 71 01 00 00       	call   500 <checkzero>
+ 38f:	83 c4 10             	add    $0x10,%esp
+    if(lseek(fd, i*BSIZE) != i*BSIZE || read(fd, buf, BSIZE) != BSIZE)
+ 392:	89 fa                	mov    %edi,%edx
+ 394:	51                   	push   %ecx
+ 395:	c1 e2 09             	shl    $0x9,%edx
+ 398:	51                   	push   %ecx
+ 399:	52                   	push   %edx
+ 39a:	89 95 14 ff ff ff    	mov    %edx,-0xec(%ebp)
+ 3a0:	56                   	push   %esi
+ 3a1:	e8 0d 05 00 00       	call   8b3 <lseek>
+ 3a6:	8b 95 14 ff ff ff    	mov    -0xec(%ebp),%edx
+ 3ac:	83 c4 10             	add    $0x10,%esp
+ 3af:	39 c2                	cmp    %eax,%edx
+ 3b1:	0f 84 72 ff ff ff    	je     329 <main+0x329>
+      fail("read back scattered write");
+ 3b7:	83 ec 0c             	sub    $0xc,%esp
+ 3ba:	68 e4 0d 00 00       	push   $0xde4
+ 3bf:	e8 1c 01 00 00       	call   4e0 <fail>
+      fail("scattered write has wrong data");
+  }
+
+  // Writing at the end of the reservation keeps it readable.
+  if(lseek(fd, BIG - BSIZE) != BIG - BSIZE || write(fd, "end", 3) != 3)
+ 3c4:	50                   	push   %eax
+ 3c5:	50                   	push   %eax
+ 3c6:	68 00 de 2e 00       	push   $0x2ede00
+ 3cb:	56                   	push   %esi
+ 3cc:	e8 e2 04 00 00       	call   8b3 <lseek>
+ 3d1:	83 c4 10             	add    $0x10,%esp
+ 3d4:	3d 00 de 2e 00       	cmp    $0x2ede00,%eax
+ 3d9:	74 1a                	je     3f5 <main+0x3f5>
+    fail("write at the end of the reservation");
+ 3db:	83 ec 0c             	sub    $0xc,%esp
+ 3de:	68 a0 0e 00 00       	push   $0xea0
+ 3e3:	e8 f8 00 00 00       	call   4e0 <fail>
+      fail("scattered write has wrong data");
+ 3e8:	83 ec 0c             	sub    $0xc,%esp
+ 3eb:	68 80 0e 00 00       	push   $0xe80
+ 3f0:	e8 eb 00 00 00       	call   4e0 <fail>
+  if(lseek(fd, BIG - BSIZE) != BIG - BSIZE || write(fd, "end", 3) != 3)
+ 3f5:	50                   	push   %eax
+ 3f6:	6a 03                	push   $0x3
+ 3f8:	68 fe 0d 00 00       	push   $0xdfe
+ 3fd:	56                   	push   %esi
+ 3fe:	e8 00 04 00 00       	call   803 <write>
+ 403:	83 c4 10             	add    $0x10,%esp
+ 406:	83 f8 03             	cmp    $0x3,%eax
+ 409:	75 d0                	jne    3db <main+0x3db>
+  if(lseek(fd, BIG - BSIZE) != BIG - BSIZE || read(fd, buf, 3) != 3 ||
+ 40b:	50                   	push   %eax
+ 40c:	50                   	push   %eax
+ 40d:	68 00 de 2e 00       	push   $0x2ede00
+ 412:	56                   	push   %esi
+ 413:	e8 9b 04 00 00       	call   8b3 <lseek>
+ 418:	83 c4 10             	add    $0x10,%esp
+ 41b:	3d 00 de 2e 00       	cmp    $0x2ede00,%eax
+ 420:	74 0d                	je     42f <main+0x42f>
+     buf[0] != 'e' || buf[2] != 'd')
+    fail("read back the end of the reservation");
+ 422:	83 ec 0c             	sub    $0xc,%esp
+ 425:	68 c4 0e 00 00       	push   $0xec4
+ 42a:	e8 b1 00 00 00       	call   4e0 <fail>
+  if(lseek(fd, BIG - BSIZE) != BIG - BSIZE || read(fd, buf, 3) != 3 ||
+ 42f:	50                   	push   %eax
+ 430:	6a 03                	push   $0x3
+ 432:	68 40 12 00 00       	push   $0x1240
+ 437:	56                   	push   %esi
+ 438:	e8 be 03 00 00       	call   7fb <read>
+ 43d:	83 c4 10             	add    $0x10,%esp
+ 440:	83 f8 03             	cmp    $0x3,%eax
+ 443:	75 dd                	jne    422 <main+0x422>
+ 445:	80 3d 40 12 00 00 65 	cmpb   $0x65,0x1240
+ 44c:	75 d4                	jne    422 <main+0x422>
+     buf[0] != 'e' || buf[2] != 'd')
+ 44e:	80 3d 42 12 00 00 64 	cmpb   $0x64,0x1242
+ 455:	75 cb                	jne    422 <main+0x422>
+  close(fd);
+ 457:	83 ec 0c             	sub    $0xc,%esp
+ 45a:	56                   	push   %esi
+ 45b:	e8 ab 03 00 00       	call   80b <close>
+
+  // Only extent files can be preallocated.
+  if((fd = open("falloc.reg", O_CREATE|O_RDWR)) < 0)
+ 460:	5e                   	pop    %esi
+ 461:	5f                   	pop    %edi
+ 462:	68 02 02 00 00       	push   $0x202
+ 467:	68 02 0e 00 00       	push   $0xe02
+ 46c:	e8 b2 03 00 00       	call   823 <open>
+ 471:	83 c4 10             	add    $0x10,%esp
+ 474:	89 c6                	mov    %eax,%esi
+ 476:	85 c0                	test   %eax,%eax
+ 478:	78 23                	js     49d <main+0x49d>
+    fail("cannot create regular file");
+  if(fallocate(fd, 0, BSIZE) != -1)
+ 47a:	51                   	push   %ecx
+ 47b:	68 00 02 00 00       	push   $0x200
+ 480:	6a 00                	push   $0x0
+ 482:	50                   	push   %eax
+ 483:	e8 33 04 00 00       	call   8bb <fallocate>
+ 488:	83 c4 10             	add    $0x10,%esp
+ 48b:	83 c0 01             	add    $0x1,%eax
+ 48e:	74 1a                	je     4aa <main+0x4aa>
+    fail("fallocate on a regular file");
+ 490:	83 ec 0c             	sub    $0xc,%esp
+ 493:	68 28 0e 00 00       	push   $0xe28
+ 498:	e8 43 00 00 00       	call   4e0 <fail>
+    fail("cannot create regular file");
+ 49d:	83 ec 0c             	sub    $0xc,%esp
+ 4a0:	68 0d 0e 00 00       	push   $0xe0d
+ 4a5:	e8 36 00 00 00       	call   4e0 <fail>
+  close(fd);
+ 4aa:	83 ec 0c             	sub    $0xc,%esp
+ 4ad:	56                   	push   %esi
+ 4ae:	e8 58 03 00 00       	call   80b <close>
+  unlink("falloc.reg");
+ 4b3:	c7 04 24 02 0e 00 00 	movl   $0xe02,(%esp)
+ 4ba:	e8 74 03 00 00       	call   833 <unlink>
+
+  unlink(name);
+ 4bf:	89 1c 24             	mov    %ebx,(%esp)
+ 4c2:	e8 6c 03 00 00       	call   833 <unlink>
+  printf(1, "falloctest ok\n");
+ 4c7:	58                   	pop    %eax
+ 4c8:	5a                   	pop    %edx
+ 4c9:	68 44 0e 00 00       	push   $0xe44
+ 4ce:	6a 01                	push   $0x1
+ 4d0:	e8 ab 04 00 00       	call   980 <printf>
+  exit();
+ 4d5:	e8 09 03 00 00       	call   7e3 <exit>
+ 4da:	66 90                	xchg   %ax,%ax
+ 4dc:	66 90                	xchg   %ax,%ax
+ 4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <fail>:
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "falloctest failed: %s\n", msg);
+ 4e6:	ff 75 08             	push   0x8(%ebp)
+ 4e9:	68 a8 0c 00 00       	push   $0xca8
+ 4ee:	6a 01                	push   $0x1
+ 4f0:	e8 8b 04 00 00       	call   980 <printf>
+  exit();
+ 4f5:	e8 e9 02 00 00       	call   7e3 <exit>
+ 4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000500 <checkzero>:
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	53                   	push   %ebx
+ 506:	83 ec 14             	sub    $0x14,%esp
+ 509:	8b 75 08             	mov    0x8(%ebp),%esi
+ 50c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 50f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(lseek(fd, off) != off)
+ 512:	53                   	push   %ebx
+ 513:	56                   	push   %esi
+ 514:	e8 9a 03 00 00       	call   8b3 <lseek>
+ 519:	83 c4 10             	add    $0x10,%esp
+ 51c:	39 d8                	cmp    %ebx,%eax
+ 51e:	75 5b                	jne    57b <checkzero+0x7b>
+  for(; n > 0; n -= m){
+ 520:	85 ff                	test   %edi,%edi
+ 522:	7e 42                	jle    566 <checkzero+0x66>
+ 524:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    m = n < BSIZE ? n : BSIZE;
+ 528:	bb 00 02 00 00       	mov    $0x200,%ebx
+ 52d:	39 df                	cmp    %ebx,%edi
+ 52f:	0f 4e df             	cmovle %edi,%ebx
+    if(read(fd, buf, m) != m)
+ 532:	83 ec 04             	sub    $0x4,%esp
+ 535:	53                   	push   %ebx
+ 536:	68 40 12 00 00       	push   $0x1240
+ 53b:	56                   	push   %esi
+ 53c:	e8 ba 02 00 00       	call   7fb <read>
+ 541:	83 c4 10             	add    $0x10,%esp
+ 544:	39 c3                	cmp    %eax,%ebx
+ 546:	75 48                	jne    590 <checkzero+0x90>
+    for(i = 0; i < m; i++)
+ 548:	31 c0                	xor    %eax,%eax
+ 54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(buf[i] != 0)
+ 550:	80 b8 40 12 00 00 00 	cmpb   $0x0,0x1240(%eax)
+ 557:	75 15                	jne    56e <checkzero+0x6e>
+    for(i = 0; i < m; i++)
+ 559:	83 c0 01             	add    $0x1,%eax
+ 55c:	39 c3                	cmp    %eax,%ebx
+ 55e:	75 f0                	jne    550 <checkzero+0x50>
+  for(; n > 0; n -= m){
+ 560:	29 df                	sub    %ebx,%edi
+ 562:	85 ff                	test   %edi,%edi
+ 564:	7f c2                	jg     528 <checkzero+0x28>
+}
+ 566:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 569:	5b                   	pop    %ebx
+ 56a:	5e                   	pop    %esi
+ 56b:	5f                   	pop    %edi
+ 56c:	5d                   	pop    %ebp
+ 56d:	c3                   	ret
+        fail("reserved block not zero");
+ 56e:	83 ec 0c             	sub    $0xc,%esp
+ 571:	68 e3 0c 00 00       	push   $0xce3
+ 576:	e8 65 ff ff ff       	call   4e0 <fail>
+    fail("lseek");
+ 57b:	83 ec 0c             	sub    $0xc,%esp
+ 57e:	68 bf 0c 00 00       	push   $0xcbf
+ 583:	e8 58 ff ff ff       	call   4e0 <fail>
+ 588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+      fail("short read of reserved blocks");
+ 590:	83 ec 0c             	sub    $0xc,%esp
+ 593:	68 c5 0c 00 00       	push   $0xcc5
+ 598:	e8 43 ff ff ff       	call   4e0 <fail>
+ 59d:	66 90                	xchg   %ax,%ax
+ 59f:	90                   	nop
+
+000005a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 5a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 5a1:	31 c0                	xor    %eax,%eax
+{
+ 5a3:	89 e5                	mov    %esp,%ebp
+ 5a5:	53                   	push   %ebx
+ 5a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 5a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 5b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 5b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 5b7:	83 c0 01             	add    $0x1,%eax
+ 5ba:	84 d2                	test   %dl,%dl
+ 5bc:	75 f2                	jne    5b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 5be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5c1:	89 c8                	mov    %ecx,%eax
+ 5c3:	c9                   	leave
+ 5c4:	c3                   	ret
+ 5c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	53                   	push   %ebx
+ 5d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 5da:	0f b6 02             	movzbl (%edx),%eax
+ 5dd:	84 c0                	test   %al,%al
+ 5df:	75 17                	jne    5f8 <strcmp+0x28>
+ 5e1:	eb 3a                	jmp    61d <strcmp+0x4d>
+ 5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e7:	90                   	nop
+ 5e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 5ec:	83 c2 01             	add    $0x1,%edx
+ 5ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 5f2:	84 c0                	test   %al,%al
+ 5f4:	74 1a                	je     610 <strcmp+0x40>
+    p++, q++;
+ 5f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 5f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 5fb:	38 c3                	cmp    %al,%bl
+ 5fd:	74 e9                	je     5e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 5ff:	29 d8                	sub    %ebx,%eax
+}
+ 601:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 604:	c9                   	leave
+ 605:	c3                   	ret
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 610:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 614:	31 c0                	xor    %eax,%eax
+ 616:	29 d8                	sub    %ebx,%eax
+}
+ 618:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 61b:	c9                   	leave
+ 61c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 61d:	0f b6 19             	movzbl (%ecx),%ebx
+ 620:	31 c0                	xor    %eax,%eax
+ 622:	eb db                	jmp    5ff <strcmp+0x2f>
+ 624:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+
+00000630 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 636:	80 3a 00             	cmpb   $0x0,(%edx)
+ 639:	74 15                	je     650 <strlen+0x20>
+ 63b:	31 c0                	xor    %eax,%eax
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+ 640:	83 c0 01             	add    $0x1,%eax
+ 643:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 647:	89 c1                	mov    %eax,%ecx
+ 649:	75 f5                	jne    640 <strlen+0x10>
+    ;
+  return n;
+}
+ 64b:	89 c8                	mov    %ecx,%eax
+ 64d:	5d                   	pop    %ebp
+ 64e:	c3                   	ret
+ 64f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 650:	31 c9                	xor    %ecx,%ecx
+}
+ 652:	5d                   	pop    %ebp
+ 653:	89 c8                	mov    %ecx,%eax
+ 655:	c3                   	ret
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000660 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 667:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 66a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 66d:	89 d7                	mov    %edx,%edi
+ 66f:	fc                   	cld
+ 670:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 672:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 675:	89 d0                	mov    %edx,%eax
+ 677:	c9                   	leave
+ 678:	c3                   	ret
+ 679:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	8b 45 08             	mov    0x8(%ebp),%eax
+ 686:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 68a:	0f b6 10             	movzbl (%eax),%edx
+ 68d:	84 d2                	test   %dl,%dl
+ 68f:	75 12                	jne    6a3 <strchr+0x23>
+ 691:	eb 1d                	jmp    6b0 <strchr+0x30>
+ 693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 697:	90                   	nop
+ 698:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 69c:	83 c0 01             	add    $0x1,%eax
+ 69f:	84 d2                	test   %dl,%dl
+ 6a1:	74 0d                	je     6b0 <strchr+0x30>
+    if(*s == c)
+ 6a3:	38 d1                	cmp    %dl,%cl
+ 6a5:	75 f1                	jne    698 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 6a7:	5d                   	pop    %ebp
+ 6a8:	c3                   	ret
+ 6a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 6b0:	31 c0                	xor    %eax,%eax
+}
+ 6b2:	5d                   	pop    %ebp
+ 6b3:	c3                   	ret
+ 6b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+
+000006c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 6c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 6c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 6c9:	31 db                	xor    %ebx,%ebx
+{
+ 6cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 6ce:	eb 27                	jmp    6f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	6a 01                	push   $0x1
+ 6d5:	56                   	push   %esi
+ 6d6:	6a 00                	push   $0x0
+ 6d8:	e8 1e 01 00 00       	call   7fb <read>
+    if(cc < 1)
+ 6dd:	83 c4 10             	add    $0x10,%esp
+ 6e0:	85 c0                	test   %eax,%eax
+ 6e2:	7e 1d                	jle    701 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 6e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 6e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 6ef:	3c 0a                	cmp    $0xa,%al
+ 6f1:	74 10                	je     703 <gets+0x43>
+ 6f3:	3c 0d                	cmp    $0xd,%al
+ 6f5:	74 0c                	je     703 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 6f7:	89 df                	mov    %ebx,%edi
+ 6f9:	83 c3 01             	add    $0x1,%ebx
+ 6fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 6ff:	7c cf                	jl     6d0 <gets+0x10>
+ 701:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 703:	8b 45 08             	mov    0x8(%ebp),%eax
+ 706:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 70a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 70d:	5b                   	pop    %ebx
+ 70e:	5e                   	pop    %esi
+ 70f:	5f                   	pop    %edi
+ 710:	5d                   	pop    %ebp
+ 711:	c3                   	ret
+ 712:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 719:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <stat>:
+
+int stat(const char *n, struct stat *st)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	56                   	push   %esi
+ 724:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 725:	83 ec 08             	sub    $0x8,%esp
+ 728:	6a 00                	push   $0x0
+ 72a:	ff 75 08             	push   0x8(%ebp)
+ 72d:	e8 f1 00 00 00       	call   823 <open>
+  if(fd < 0)
+ 732:	83 c4 10             	add    $0x10,%esp
+ 735:	85 c0                	test   %eax,%eax
+ 737:	78 27                	js     760 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 739:	83 ec 08             	sub    $0x8,%esp
+ 73c:	ff 75 0c             	push   0xc(%ebp)
+ 73f:	89 c3                	mov    %eax,%ebx
+ 741:	50                   	push   %eax
+ 742:	e8 f4 00 00 00       	call   83b <fstat>
+  close(fd);
+ 747:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 74a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 74c:	e8 ba 00 00 00       	call   80b <close>
+  return r;
+ 751:	83 c4 10             	add    $0x10,%esp
+}
+ 754:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 757:	89 f0                	mov    %esi,%eax
+ 759:	5b                   	pop    %ebx
+ 75a:	5e                   	pop    %esi
+ 75b:	5d                   	pop    %ebp
+ 75c:	c3                   	ret
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 760:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 765:	eb ed                	jmp    754 <stat+0x34>
+ 767:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76e:	66 90                	xchg   %ax,%ax
+
+00000770 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	53                   	push   %ebx
+ 774:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 777:	0f be 02             	movsbl (%edx),%eax
+ 77a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 77d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 780:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 785:	77 1e                	ja     7a5 <atoi+0x35>
+ 787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 790:	83 c2 01             	add    $0x1,%edx
+ 793:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 796:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 79a:	0f be 02             	movsbl (%edx),%eax
+ 79d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 7a0:	80 fb 09             	cmp    $0x9,%bl
+ 7a3:	76 eb                	jbe    790 <atoi+0x20>
+  return n;
+}
+ 7a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7a8:	89 c8                	mov    %ecx,%eax
+ 7aa:	c9                   	leave
+ 7ab:	c3                   	ret
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 7b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 7be:	85 c0                	test   %eax,%eax
+ 7c0:	7e 13                	jle    7d5 <memmove+0x25>
+ 7c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 7c4:	89 d7                	mov    %edx,%edi
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 7d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 7d1:	39 f8                	cmp    %edi,%eax
+ 7d3:	75 fb                	jne    7d0 <memmove+0x20>
+  return vdst;
+}
+ 7d5:	5e                   	pop    %esi
+ 7d6:	89 d0                	mov    %edx,%eax
+ 7d8:	5f                   	pop    %edi
+ 7d9:	5d                   	pop    %ebp
+ 7da:	c3                   	ret
+
+000007db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 7db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <exit>:
+SYSCALL(exit)
+ 7e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <wait>:
+SYSCALL(wait)
+ 7eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <pipe>:
+SYSCALL(pipe)
+ 7f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <read>:
+SYSCALL(read)
+ 7fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <write>:
+SYSCALL(write)
+ 803:	b8 10 00 00 00       	mov    $0x10,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <close>:
+SYSCALL(close)
+ 80b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <kill>:
+SYSCALL(kill)
+ 813:	b8 06 00 00 00       	mov    $0x6,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <exec>:
+SYSCALL(exec)
+ 81b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <open>:
+SYSCALL(open)
+ 823:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <mknod>:
+SYSCALL(mknod)
+ 82b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <unlink>:
+SYSCALL(unlink)
+ 833:	b8 12 00 00 00       	mov    $0x12,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <fstat>:
+SYSCALL(fstat)
+ 83b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <link>:
+SYSCALL(link)
+ 843:	b8 13 00 00 00       	mov    $0x13,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <mkdir>:
+SYSCALL(mkdir)
+ 84b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <chdir>:
+SYSCALL(chdir)
+ 853:	b8 09 00 00 00       	mov    $0x9,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <dup>:
+SYSCALL(dup)
+ 85b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <getpid>:
+SYSCALL(getpid)
+ 863:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <sbrk>:
+SYSCALL(sbrk)
+ 86b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <sleep>:
+SYSCALL(sleep)
+ 873:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <uptime>:
+SYSCALL(uptime)
+ 87b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <time_scheduled>:
+SYSCALL(time_scheduled)
+ 883:	b8 16 00 00 00       	mov    $0x16,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <set_sched_priority>:
+SYSCALL(set_sched_priority)
+ 88b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <get_sched_priority>:
+SYSCALL(get_sched_priority)
+ 893:	b8 18 00 00 00       	mov    $0x18,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <fifo_position>:
+SYSCALL(fifo_position)
+ 89b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <printProcessTable>:
+SYSCALL(printProcessTable)
+ 8a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+000008ab <symlink>:
+SYSCALL(symlink)
+ 8ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <lseek>:
+SYSCALL(lseek)
+ 8b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+000008bb <fallocate>:
+SYSCALL(fallocate)
+ 8bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+000008c3 <iostats>:
+SYSCALL(iostats)
+ 8c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8c8:	cd 40                	int    $0x40
+ 8ca:	c3                   	ret
+
+000008cb <fsync>:
+SYSCALL(fsync)
+ 8cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8d0:	cd 40                	int    $0x40
+ 8d2:	c3                   	ret
+ 8d3:	66 90                	xchg   %ax,%ax
+ 8d5:	66 90                	xchg   %ax,%ax
+ 8d7:	66 90                	xchg   %ax,%ax
+ 8d9:	66 90                	xchg   %ax,%ax
+ 8db:	66 90                	xchg   %ax,%ax
+ 8dd:	66 90                	xchg   %ax,%ax
+ 8df:	90                   	nop
+
+000008e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8e8:	89 d1                	mov    %edx,%ecx
+{
+ 8ea:	83 ec 3c             	sub    $0x3c,%esp
+ 8ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8f0:	85 d2                	test   %edx,%edx
+ 8f2:	0f 89 80 00 00 00    	jns    978 <printint+0x98>
+ 8f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8fc:	74 7a                	je     978 <printint+0x98>
+    x = -xx;
+ 8fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 900:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 905:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 908:	31 f6                	xor    %esi,%esi
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 910:	89 c8                	mov    %ecx,%eax
+ 912:	31 d2                	xor    %edx,%edx
+ 914:	89 f7                	mov    %esi,%edi
+ 916:	f7 f3                	div    %ebx
+ 918:	8d 76 01             	lea    0x1(%esi),%esi
+ 91b:	0f b6 92 48 0f 00 00 	movzbl 0xf48(%edx),%edx
+ 922:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 926:	89 ca                	mov    %ecx,%edx
+ 928:	89 c1                	mov    %eax,%ecx
+ 92a:	39 da                	cmp    %ebx,%edx
+ 92c:	73 e2                	jae    910 <printint+0x30>
+  if(neg)
+ 92e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 931:	85 c0                	test   %eax,%eax
+ 933:	74 07                	je     93c <printint+0x5c>
+    buf[i++] = '-';
+ 935:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 93a:	89 f7                	mov    %esi,%edi
+ 93c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 93f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 942:	01 df                	add    %ebx,%edi
+ 944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 948:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 94b:	83 ec 04             	sub    $0x4,%esp
+ 94e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 951:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 954:	6a 01                	push   $0x1
+ 956:	50                   	push   %eax
+ 957:	56                   	push   %esi
+ 958:	e8 a6 fe ff ff       	call   803 <write>
+  while(--i >= 0)
+ 95d:	89 f8                	mov    %edi,%eax
+ 95f:	83 c4 10             	add    $0x10,%esp
+ 962:	83 ef 01             	sub    $0x1,%edi
+ 965:	39 d8                	cmp    %ebx,%eax
+ 967:	75 df                	jne    948 <printint+0x68>
+}
+ 969:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 96c:	5b                   	pop    %ebx
+ 96d:	5e                   	pop    %esi
+ 96e:	5f                   	pop    %edi
+ 96f:	5d                   	pop    %ebp
+ 970:	c3                   	ret
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 978:	31 c0                	xor    %eax,%eax
+ 97a:	eb 89                	jmp    905 <printint+0x25>
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000980 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 989:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 98c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 98f:	0f b6 1e             	movzbl (%esi),%ebx
+ 992:	83 c6 01             	add    $0x1,%esi
+ 995:	84 db                	test   %bl,%bl
+ 997:	74 67                	je     a00 <printf+0x80>
+ 999:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 99c:	31 d2                	xor    %edx,%edx
+ 99e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 9a1:	eb 34                	jmp    9d7 <printf+0x57>
+ 9a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9a7:	90                   	nop
+ 9a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 9ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9b0:	83 f8 25             	cmp    $0x25,%eax
+ 9b3:	74 18                	je     9cd <printf+0x4d>
+  write(fd, &c, 1);
+ 9b5:	83 ec 04             	sub    $0x4,%esp
+ 9b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9be:	6a 01                	push   $0x1
+ 9c0:	50                   	push   %eax
+ 9c1:	57                   	push   %edi
+ 9c2:	e8 3c fe ff ff       	call   803 <write>
+ 9c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9d0:	83 c6 01             	add    $0x1,%esi
+ 9d3:	84 db                	test   %bl,%bl
+ 9d5:	74 29                	je     a00 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9da:	85 d2                	test   %edx,%edx
+ 9dc:	74 ca                	je     9a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9de:	83 fa 25             	cmp    $0x25,%edx
+ 9e1:	75 ea                	jne    9cd <printf+0x4d>
+      if(c == 'd'){
+ 9e3:	83 f8 25             	cmp    $0x25,%eax
+ 9e6:	0f 84 24 01 00 00    	je     b10 <printf+0x190>
+ 9ec:	83 e8 63             	sub    $0x63,%eax
+ 9ef:	83 f8 15             	cmp    $0x15,%eax
+ 9f2:	77 1c                	ja     a10 <printf+0x90>
+ 9f4:	ff 24 85 f0 0e 00 00 	jmp    *0xef0(,%eax,4)
+ 9fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a03:	5b                   	pop    %ebx
+ a04:	5e                   	pop    %esi
+ a05:	5f                   	pop    %edi
+ a06:	5d                   	pop    %ebp
+ a07:	c3                   	ret
+ a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+  write(fd, &c, 1);
+ a10:	83 ec 04             	sub    $0x4,%esp
+ a13:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a16:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a1a:	6a 01                	push   $0x1
+ a1c:	52                   	push   %edx
+ a1d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a20:	57                   	push   %edi
+ a21:	e8 dd fd ff ff       	call   803 <write>
+ a26:	83 c4 0c             	add    $0xc,%esp
+ a29:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a2c:	6a 01                	push   $0x1
+ a2e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a31:	52                   	push   %edx
+ a32:	57                   	push   %edi
+ a33:	e8 cb fd ff ff       	call   803 <write>
+        putc(fd, c);
+ a38:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a3b:	31 d2                	xor    %edx,%edx
+ a3d:	eb 8e                	jmp    9cd <printf+0x4d>
+ a3f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a4b:	8b 13                	mov    (%ebx),%edx
+ a4d:	6a 00                	push   $0x0
+ a4f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a51:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a54:	e8 87 fe ff ff       	call   8e0 <printint>
+        ap++;
+ a59:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a5f:	31 d2                	xor    %edx,%edx
+ a61:	e9 67 ff ff ff       	jmp    9cd <printf+0x4d>
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a70:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a73:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a75:	83 c0 04             	add    $0x4,%eax
+ a78:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a7b:	85 db                	test   %ebx,%ebx
+ a7d:	0f 84 9d 00 00 00    	je     b20 <printf+0x1a0>
+        while(*s != 0){
+ a83:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a86:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a88:	84 c0                	test   %al,%al
+ a8a:	0f 84 3d ff ff ff    	je     9cd <printf+0x4d>
+ a90:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a93:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a96:	89 de                	mov    %ebx,%esi
+ a98:	89 d3                	mov    %edx,%ebx
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ aa0:	83 ec 04             	sub    $0x4,%esp
+ aa3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ aa6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ aa9:	6a 01                	push   $0x1
+ aab:	53                   	push   %ebx
+ aac:	57                   	push   %edi
+ aad:	e8 51 fd ff ff       	call   803 <write>
+        while(*s != 0){
+ ab2:	0f b6 06             	movzbl (%esi),%eax
+ ab5:	83 c4 10             	add    $0x10,%esp
+ ab8:	84 c0                	test   %al,%al
+ aba:	75 e4                	jne    aa0 <printf+0x120>
+      state = 0;
+ abc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ abf:	31 d2                	xor    %edx,%edx
+ ac1:	e9 07 ff ff ff       	jmp    9cd <printf+0x4d>
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ad0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ad3:	83 ec 0c             	sub    $0xc,%esp
+ ad6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ adb:	8b 13                	mov    (%ebx),%edx
+ add:	6a 01                	push   $0x1
+ adf:	e9 6b ff ff ff       	jmp    a4f <printf+0xcf>
+ ae4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ae8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ aeb:	83 ec 04             	sub    $0x4,%esp
+ aee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ af1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ af3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ af6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ af9:	6a 01                	push   $0x1
+ afb:	52                   	push   %edx
+ afc:	57                   	push   %edi
+ afd:	e8 01 fd ff ff       	call   803 <write>
+        ap++;
+ b02:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b05:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b08:	31 d2                	xor    %edx,%edx
+ b0a:	e9 be fe ff ff       	jmp    9cd <printf+0x4d>
+ b0f:	90                   	nop
+  write(fd, &c, 1);
+ b10:	83 ec 04             	sub    $0x4,%esp
+ b13:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b16:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b19:	6a 01                	push   $0x1
+ b1b:	e9 11 ff ff ff       	jmp    a31 <printf+0xb1>
+ b20:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b25:	bb e9 0e 00 00       	mov    $0xee9,%ebx
+ b2a:	e9 61 ff ff ff       	jmp    a90 <printf+0x110>
+ b2f:	90                   	nop
+
+00000b30 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b30:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b31:	a1 40 14 00 00       	mov    0x1440,%eax
+{
+ b36:	89 e5                	mov    %esp,%ebp
+ b38:	57                   	push   %edi
+ b39:	56                   	push   %esi
+ b3a:	53                   	push   %ebx
+ b3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b3e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b48:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b4a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b4c:	39 ca                	cmp    %ecx,%edx
+ b4e:	73 30                	jae    b80 <free+0x50>
+ b50:	39 c1                	cmp    %eax,%ecx
+ b52:	72 04                	jb     b58 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b54:	39 c2                	cmp    %eax,%edx
+ b56:	72 f0                	jb     b48 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b58:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b5b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b5e:	39 f8                	cmp    %edi,%eax
+ b60:	74 2e                	je     b90 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b62:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b65:	8b 42 04             	mov    0x4(%edx),%eax
+ b68:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b6b:	39 f1                	cmp    %esi,%ecx
+ b6d:	74 38                	je     ba7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b6f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b71:	5b                   	pop    %ebx
+  freep = p;
+ b72:	89 15 40 14 00 00    	mov    %edx,0x1440
+}
+ b78:	5e                   	pop    %esi
+ b79:	5f                   	pop    %edi
+ b7a:	5d                   	pop    %ebp
+ b7b:	c3                   	ret
+ b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b80:	39 c1                	cmp    %eax,%ecx
+ b82:	72 d0                	jb     b54 <free+0x24>
+ b84:	eb c2                	jmp    b48 <free+0x18>
+ b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b90:	03 70 04             	add    0x4(%eax),%esi
+ b93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b96:	8b 02                	mov    (%edx),%eax
+ b98:	8b 00                	mov    (%eax),%eax
+ b9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b9d:	8b 42 04             	mov    0x4(%edx),%eax
+ ba0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ba3:	39 f1                	cmp    %esi,%ecx
+ ba5:	75 c8                	jne    b6f <free+0x3f>
+    p->s.size += bp->s.size;
+ ba7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ baa:	89 15 40 14 00 00    	mov    %edx,0x1440
+    p->s.size += bp->s.size;
+ bb0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ bb3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ bb6:	89 0a                	mov    %ecx,(%edx)
+}
+ bb8:	5b                   	pop    %ebx
+ bb9:	5e                   	pop    %esi
+ bba:	5f                   	pop    %edi
+ bbb:	5d                   	pop    %ebp
+ bbc:	c3                   	ret
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bc0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	57                   	push   %edi
+ bc4:	56                   	push   %esi
+ bc5:	53                   	push   %ebx
+ bc6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bcc:	8b 15 40 14 00 00    	mov    0x1440,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bd2:	8d 78 07             	lea    0x7(%eax),%edi
+ bd5:	c1 ef 03             	shr    $0x3,%edi
+ bd8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bdb:	85 d2                	test   %edx,%edx
+ bdd:	0f 84 8d 00 00 00    	je     c70 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ be3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ be5:	8b 48 04             	mov    0x4(%eax),%ecx
+ be8:	39 f9                	cmp    %edi,%ecx
+ bea:	73 64                	jae    c50 <malloc+0x90>
+  if(nu < 4096)
+ bec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ bf1:	39 df                	cmp    %ebx,%edi
+ bf3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bf6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bfd:	eb 0a                	jmp    c09 <malloc+0x49>
+ bff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c00:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c02:	8b 48 04             	mov    0x4(%eax),%ecx
+ c05:	39 f9                	cmp    %edi,%ecx
+ c07:	73 47                	jae    c50 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c09:	89 c2                	mov    %eax,%edx
+ c0b:	39 05 40 14 00 00    	cmp    %eax,0x1440
+ c11:	75 ed                	jne    c00 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c13:	83 ec 0c             	sub    $0xc,%esp
+ c16:	56                   	push   %esi
+ c17:	e8 4f fc ff ff       	call   86b <sbrk>
+  if(p == (char*)-1)
+ c1c:	83 c4 10             	add    $0x10,%esp
+ c1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c22:	74 1c                	je     c40 <malloc+0x80>
+  hp->s.size = nu;
+ c24:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c27:	83 ec 0c             	sub    $0xc,%esp
+ c2a:	83 c0 08             	add    $0x8,%eax
+ c2d:	50                   	push   %eax
+ c2e:	e8 fd fe ff ff       	call   b30 <free>
+  return freep;
+ c33:	8b 15 40 14 00 00    	mov    0x1440,%edx
+      if((p = morecore(nunits)) == 0)
+ c39:	83 c4 10             	add    $0x10,%esp
+ c3c:	85 d2                	test   %edx,%edx
+ c3e:	75 c0                	jne    c00 <malloc+0x40>
+        return 0;
+  }
+}
+ c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c43:	31 c0                	xor    %eax,%eax
+}
+ c45:	5b                   	pop    %ebx
+ c46:	5e                   	pop    %esi
+ c47:	5f                   	pop    %edi
+ c48:	5d                   	pop    %ebp
+ c49:	c3                   	ret
+ c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c50:	39 cf                	cmp    %ecx,%edi
+ c52:	74 4c                	je     ca0 <malloc+0xe0>
+        p->s.size -= nunits;
+ c54:	29 f9                	sub    %edi,%ecx
+ c56:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c59:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c5c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c5f:	89 15 40 14 00 00    	mov    %edx,0x1440
+}
+ c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c68:	83 c0 08             	add    $0x8,%eax
+}
+ c6b:	5b                   	pop    %ebx
+ c6c:	5e                   	pop    %esi
+ c6d:	5f                   	pop    %edi
+ c6e:	5d                   	pop    %ebp
+ c6f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c70:	c7 05 40 14 00 00 44 	movl   $0x1444,0x1440
+ c77:	14 00 00 
+    base.s.size = 0;
+ c7a:	b8 44 14 00 00       	mov    $0x1444,%eax
+    base.s.ptr = freep = prevp = &base;
+ c7f:	c7 05 44 14 00 00 44 	movl   $0x1444,0x1444
+ c86:	14 00 00 
+    base.s.size = 0;
+ c89:	c7 05 48 14 00 00 00 	movl   $0x0,0x1448
+ c90:	00 00 00 
+    if(p->s.size >= nunits){
+ c93:	e9 54 ff ff ff       	jmp    bec <malloc+0x2c>
+ c98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ca0:	8b 08                	mov    (%eax),%ecx
+ ca2:	89 0a                	mov    %ecx,(%edx)
+ ca4:	eb b9                	jmp    c5f <malloc+0x9f>
@@ -0,0 +1,125 @@
+// Test fallocate() on extent files: reserved blocks read as
+// zeros, the file grows to cover them, a reservation too big
+// for one run of blocks is allocated a run at a time, and writes
+// into the middle of a reservation leave the rest of it zero.
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+
+#define BIG (6000*BSIZE)  // more than one bitmap block's worth
+#define STRIDE 37          // blocks between scattered writes
+
+char buf[BSIZE];
+
+void
+fail(char *msg)
+{
+  printf(1, "falloctest failed: %s\n", msg);
+  exit();
+}
+
+// Check that the n bytes at off read back as zeros.
+void
+checkzero(int fd, int off, int n)
+{
+  int i, m;
+
+  if(lseek(fd, off) != off)
+    fail("lseek");
+  for(; n > 0; n -= m){
+    m = n < BSIZE ? n : BSIZE;
+    if(read(fd, buf, m) != m)
+      fail("short read of reserved blocks");
+    for(i = 0; i < m; i++)
+      if(buf[i] != 0)
+        fail("reserved block not zero");
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *name = argc > 1 ? argv[1] : "falloc.tmp";
+  struct stat st;
+  int fd, i;
+
+  printf(1, "falloctest starting\n");
+  unlink(name);
+  if((fd = open(name, O_EXTENT)) < 0)
+    fail("cannot create extent file");
+  close(fd);
+  if((fd = open(name, O_RDWR)) < 0)
+    fail("cannot open extent file");
+
+  // A small reservation grows the file and reads as zeros.
+  if(fallocate(fd, 0, 3*BSIZE + 100) != 0)
+    fail("fallocate");
+  if(fstat(fd, &st) < 0 || st.size != 3*BSIZE + 100)
+    fail("size after fallocate");
+  checkzero(fd, 0, st.size);
+
+  // Reserving inside the file leaves its size alone.
+  if(fallocate(fd, BSIZE, 10) != 0)
+    fail("fallocate inside the file");
+  if(fstat(fd, &st) < 0 || st.size != 3*BSIZE + 100)
+    fail("fallocate inside the file changed its size");
+
+  // Writing one reserved block leaves the blocks around it zero.
+  for(i = 0; i < BSIZE; i++)
+    buf[i] = 'a' + i % 26;
+  if(lseek(fd, 2*BSIZE) != 2*BSIZE || write(fd, buf, BSIZE) != BSIZE)
+    fail("write into reserved block");
+  checkzero(fd, 0, 2*BSIZE);
+  if(lseek(fd, 2*BSIZE) != 2*BSIZE || read(fd, buf, BSIZE) != BSIZE)
+    fail("read back written block");
+  for(i = 0; i < BSIZE; i++)
+    if(buf[i] != 'a' + i % 26)
+      fail("written block has wrong data");
+  checkzero(fd, 3*BSIZE, 100);
+
+  // A reservation bigger than one bitmap block's worth of blocks
+  // is allocated as several runs.
+  if(fallocate(fd, 0, BIG) != 0)
+    fail("big fallocate");
+  if(fstat(fd, &st) < 0 || st.size != BIG)
+    fail("size after big fallocate");
+  checkzero(fd, 3*BSIZE, BIG - 3*BSIZE);
+
+  // Scattered writes, last first, split the reservation without
+  // touching the blocks between them.
+  for(i = BIG/BSIZE - 10; i > 3; i -= STRIDE){
+    memset(buf, 'A' + i % 26, BSIZE);
+    if(lseek(fd, i*BSIZE) != i*BSIZE || write(fd, buf, BSIZE) != BSIZE)
+      fail("scattered write");
+  }
+  for(i = BIG/BSIZE - 10; i > 3; i -= STRIDE){
+    if(i - STRIDE > 3)
+      checkzero(fd, (i - STRIDE + 1)*BSIZE, (STRIDE - 1)*BSIZE);
+    if(lseek(fd, i*BSIZE) != i*BSIZE || read(fd, buf, BSIZE) != BSIZE)
+      fail("read back scattered write");
+    if(buf[0] != 'A' + i % 26 || buf[BSIZE-1] != 'A' + i % 26)
+      fail("scattered write has wrong data");
+  }
+
+  // Writing at the end of the reservation keeps it readable.
+  if(lseek(fd, BIG - BSIZE) != BIG - BSIZE || write(fd, "end", 3) != 3)
+    fail("write at the end of the reservation");
+  if(lseek(fd, BIG - BSIZE) != BIG - BSIZE || read(fd, buf, 3) != 3 ||
+     buf[0] != 'e' || buf[2] != 'd')
+    fail("read back the end of the reservation");
+  close(fd);
+
+  // Only extent files can be preallocated.
+  if((fd = open("falloc.reg", O_CREATE|O_RDWR)) < 0)
+    fail("cannot create regular file");
+  if(fallocate(fd, 0, BSIZE) != -1)
+    fail("fallocate on a regular file");
+  close(fd);
+  unlink("falloc.reg");
+
+  unlink(name);
+  printf(1, "falloctest ok\n");
+  exit();
+}
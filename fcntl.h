@@ -4,3 +4,4 @@
 #define O_CREATE  0x200
 #define O_NOFOLLOW 0x003
 #define O_EXTENT 0x004
+#define O_SYNC    0x400  // write() returns once the data is committed
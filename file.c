@@ -108,15 +108,8 @@ fileread(struct file *f, char *addr, int n)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
     ilock(f->ip);
-
-    if(f->ip->type == T_EXTENT){
-        r = readi(f->ip, addr, f->off, n);
-    } else {
-        if((r = readi(f->ip, addr, f->off, n)) > 0) {
-          f->off += r;
-        }
-    }
-
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+      f->off += r;
     iunlock(f->ip);
     return r;
   }
@@ -157,15 +150,12 @@ filewrite(struct file *f, char *addr, int n)
 	begin_op();
 	ilock(f->ip);
 	
-	// Write the empty array
-	writei(f->ip, emptyBuffer, f->off, byteDiff);
+	// Write the empty array from the old end of file; writei grows the size
+	writei(f->ip, emptyBuffer, f->ip->size, byteDiff);
 
 	// Close the transaction
 	iunlock(f->ip);
 	end_op();
-
-	// Update the file size
-	f->ip->size += byteDiff;
   }
 
   if(f->type == FD_PIPE) {
@@ -173,23 +163,27 @@ filewrite(struct file *f, char *addr, int n)
   }
 
   if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // write as many blocks at a time as one op may
+    // reserve in the log: for each block, the block and
+    // an allocation block, plus map nodes and i-node
+    // (WRITEMETA), and 2 blocks of slop for non-aligned writes:
+    // 112 blocks (56 KB), so 1 MB takes 19 ops.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int max = ((MAXWRITEBLOCKS-WRITEMETA(MAXWRITEBLOCKS)-2) / 2) * BSIZE;
     int i = 0;
+    uint t = 0;
     while(i < n){
       int n1 = n - i;
       if(n1 > max)
         n1 = max;
 
-      begin_op();
+      int nb = (n1 + BSIZE - 1) / BSIZE;
+      begin_opn(2*nb + WRITEMETA(nb) + 2);
       ilock(f->ip);
       if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
         f->off += r;
+      t = f->ip->txn;
       iunlock(f->ip);
       end_op();
 
@@ -199,6 +193,8 @@ filewrite(struct file *f, char *addr, int n)
         panic("short filewrite");
       i += r;
     }
+    if(f->sync && t > 0)
+      log_sync(t);
     return i == n ? n : -1;
   }
   panic("filewrite");
@@ -3,16 +3,12 @@ struct file {
   int ref; // reference count
   char readable;
   char writable;
+  char sync;     // opened O_SYNC
   struct pipe *pipe;
   struct inode *ip;
   uint off;
 };
 
-struct extent {
-  uint length; 
-  uint startingAddress; 
-};
-
 // in-memory copy of an inode
 struct inode {
   uint dev;           // Device number
@@ -27,11 +23,16 @@ struct inode {
   short nlink;
   uint size;
   uint addrs[NDIRECT+2];  //Changed to allow for a double indirect block
-  struct extent extentz[NDIRECT];
-  uint numExtents;
+  struct extent extentz[NEXTENT_ROOT]; // root of the extent tree
+  uint numExtents;    // records in extentz
+  uint edepth;        // depth of the extent tree; 0 if extentz holds extents
+  int ebad;           // T_EXTENT whose extent root we cannot read
   int sisterblocks; // for continuous allocation and frag. reduction
-  int eOffset; 
-  int lOffset;
+  uint dstart;        // first delayed-write block
+  uint ndelay;        // delayed-write blocks from dstart; see delalloc()
+  uint ranext;        // block after the last one read
+  uint raend;         // block after the last one read ahead
+  uint txn;           // last log transaction to change it
 };
 
 
@@ -0,0 +1,2877 @@
+
+_find:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    }
+  }
+}
+
+// start main()
+int main(int argc, char *argv[]) {
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	81 ec 08 03 00 00    	sub    $0x308,%esp
+      17:	8b 01                	mov    (%ecx),%eax
+      19:	8b 79 04             	mov    0x4(%ecx),%edi
+    // Check for a valid number of arguments.
+	if(argc < 4 || argc == 5 || argc == 7 || argc > 8) {
+      1c:	89 c1                	mov    %eax,%ecx
+      1e:	83 e1 fd             	and    $0xfffffffd,%ecx
+      21:	83 f9 05             	cmp    $0x5,%ecx
+      24:	0f 84 f6 00 00 00    	je     120 <main+0x120>
+      2a:	8d 48 fc             	lea    -0x4(%eax),%ecx
+      2d:	83 f9 04             	cmp    $0x4,%ecx
+      30:	0f 87 ea 00 00 00    	ja     120 <main+0x120>
+
+    // Initialize findCommand struct to default values so we don't accidentally check an uninitialized value later on.
+    findCmd.oneFlag = FALSE;
+    findCmd.bothFlags = FALSE;
+    findCmd.noFlags = FALSE;
+    findCmd.type = NULLTYPE;
+      36:	c7 85 fc fc ff ff 85 	movl   $0x1b85,-0x304(%ebp)
+      3d:	1b 00 00 
+    findCmd.equalSize = NULLSIZE;
+      40:	c7 85 00 fd ff ff ff 	movl   $0xffffffff,-0x300(%ebp)
+      47:	ff ff ff 
+    findCmd.greaterThanSize = NULLSIZE;
+      4a:	c7 85 04 fd ff ff ff 	movl   $0xffffffff,-0x2fc(%ebp)
+      51:	ff ff ff 
+    findCmd.lessThanSize = NULLSIZE;
+      54:	c7 85 08 fd ff ff ff 	movl   $0xffffffff,-0x2f8(%ebp)
+      5b:	ff ff ff 
+
+    // Switch(argc) based on the number of arguments the user passed in, build the findCommand struct, open the first folder, and begin searching for matches.
+	switch(argc) {
+      5e:	83 f8 06             	cmp    $0x6,%eax
+      61:	0f 84 99 00 00 00    	je     100 <main+0x100>
+      67:	83 f8 08             	cmp    $0x8,%eax
+      6a:	0f 84 f7 00 00 00    	je     167 <main+0x167>
+      70:	83 f8 04             	cmp    $0x4,%eax
+      73:	0f 84 bf 00 00 00    	je     138 <main+0x138>
+      79:	31 c0                	xor    %eax,%eax
+      7b:	31 d2                	xor    %edx,%edx
+      7d:	31 f6                	xor    %esi,%esi
+      7f:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%ebp)
+      85:	89 95 f4 fc ff ff    	mov    %edx,-0x30c(%ebp)
+
+            findCmd.bothFlags = TRUE;
+		} break;
+	}
+
+    findCmd.fileName = argv[3];
+      8b:	8b 47 0c             	mov    0xc(%edi),%eax
+      8e:	89 85 ec fc ff ff    	mov    %eax,-0x314(%ebp)
+
+    // Check for a null file name.
+    if(findCmd.fileName == NULL){
+      94:	85 c0                	test   %eax,%eax
+      96:	0f 84 89 00 00 00    	je     125 <main+0x125>
+            printf(1, "find failed: Please enter a valid file or folder name to search for\n");
+            exit();
+    }
+
+    // Open the starting point folder path.
+    if((startingFileDescriptor = open(argv[1], 0)) < 0) {
+      9c:	50                   	push   %eax
+      9d:	50                   	push   %eax
+      9e:	6a 00                	push   $0x0
+      a0:	ff 77 04             	push   0x4(%edi)
+      a3:	e8 cb 13 00 00       	call   1473 <open>
+      a8:	83 c4 10             	add    $0x10,%esp
+      ab:	89 c3                	mov    %eax,%ebx
+      ad:	85 c0                	test   %eax,%eax
+      af:	0f 88 f9 02 00 00    	js     3ae <main+0x3ae>
+            printf(1, "find failed: Cannot open folder: %s, or folder does not exist.\n", argv[1]);
+            exit();
+    }
+
+    // Get the status information for the starting point folder path
+    if(fstat(startingFileDescriptor, &statObj) < 0) {
+      b5:	50                   	push   %eax
+      b6:	50                   	push   %eax
+      b7:	8d 85 18 fd ff ff    	lea    -0x2e8(%ebp),%eax
+      bd:	50                   	push   %eax
+      be:	53                   	push   %ebx
+      bf:	e8 c7 13 00 00       	call   148b <fstat>
+      c4:	83 c4 10             	add    $0x10,%esp
+      c7:	85 c0                	test   %eax,%eax
+      c9:	0f 88 0f 04 00 00    	js     4de <main+0x4de>
+            close(startingFileDescriptor);
+            exit();
+    }
+
+    // Begin traversing the folder for additional files or folders that may contain a match.
+    if(findCmd.noFlags == TRUE) {
+      cf:	83 bd f4 fc ff ff 01 	cmpl   $0x1,-0x30c(%ebp)
+      d6:	0f 84 96 03 00 00    	je     472 <main+0x472>
+        findNoFlags(findCmd, statObj, argv[1], startingFileDescriptor, bufferStr);
+    } else if(findCmd.oneFlag == TRUE) {
+      dc:	83 ee 01             	sub    $0x1,%esi
+      df:	0f 84 5c 05 00 00    	je     641 <main+0x641>
+        findOneFlag(findCmd, statObj, argv[1], startingFileDescriptor, bufferStr);
+    } else if(findCmd.bothFlags == TRUE) {
+      e5:	83 bd f0 fc ff ff 01 	cmpl   $0x1,-0x310(%ebp)
+      ec:	0f 84 bd 05 00 00    	je     6af <main+0x6af>
+        findBothFlags(findCmd, statObj, argv[1], startingFileDescriptor, bufferStr);       
+    }
+
+    close(startingFileDescriptor);
+      f2:	83 ec 0c             	sub    $0xc,%esp
+      f5:	53                   	push   %ebx
+      f6:	e8 60 13 00 00       	call   145b <close>
+	exit();
+      fb:	e8 33 13 00 00       	call   1433 <exit>
+			if(strcmp(argv[2],"-name") != 0 || (strcmp(argv[4],"-type") != 0 && strcmp(argv[4],"-size") != 0)) {
+     100:	56                   	push   %esi
+     101:	56                   	push   %esi
+     102:	68 87 1b 00 00       	push   $0x1b87
+     107:	ff 77 08             	push   0x8(%edi)
+     10a:	e8 11 11 00 00       	call   1220 <strcmp>
+     10f:	83 c4 10             	add    $0x10,%esp
+     112:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%ebp)
+     118:	85 c0                	test   %eax,%eax
+     11a:	0f 84 a3 02 00 00    	je     3c3 <main+0x3c3>
+		displayFormattingErrorMsg();
+     120:	e8 7b 08 00 00       	call   9a0 <displayFormattingErrorMsg>
+            printf(1, "find failed: Please enter a valid file or folder name to search for\n");
+     125:	50                   	push   %eax
+     126:	50                   	push   %eax
+     127:	68 08 1b 00 00       	push   $0x1b08
+     12c:	6a 01                	push   $0x1
+     12e:	e8 9d 14 00 00       	call   15d0 <printf>
+            exit();
+     133:	e8 fb 12 00 00       	call   1433 <exit>
+			if(strcmp(argv[2], "-name") != 0) {
+     138:	50                   	push   %eax
+     139:	50                   	push   %eax
+     13a:	68 87 1b 00 00       	push   $0x1b87
+     13f:	ff 77 08             	push   0x8(%edi)
+     142:	e8 d9 10 00 00       	call   1220 <strcmp>
+     147:	83 c4 10             	add    $0x10,%esp
+     14a:	89 c6                	mov    %eax,%esi
+     14c:	85 c0                	test   %eax,%eax
+     14e:	75 d0                	jne    120 <main+0x120>
+            findCmd.noFlags = TRUE;
+     150:	c7 85 f4 fc ff ff 01 	movl   $0x1,-0x30c(%ebp)
+     157:	00 00 00 
+    findCmd.bothFlags = FALSE;
+     15a:	31 c0                	xor    %eax,%eax
+     15c:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%ebp)
+     162:	e9 24 ff ff ff       	jmp    8b <main+0x8b>
+			if(strcmp(argv[2],"-name") != 0 || (strcmp(argv[4],"-type") != 0 && strcmp(argv[4],"-size") != 0) || (strcmp(argv[6],"-type") != 0 && strcmp(argv[6],"-size") != 0)) {
+     167:	50                   	push   %eax
+     168:	50                   	push   %eax
+     169:	68 87 1b 00 00       	push   $0x1b87
+     16e:	ff 77 08             	push   0x8(%edi)
+     171:	e8 aa 10 00 00       	call   1220 <strcmp>
+     176:	83 c4 10             	add    $0x10,%esp
+     179:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%ebp)
+     17f:	85 c0                	test   %eax,%eax
+     181:	75 9d                	jne    120 <main+0x120>
+     183:	50                   	push   %eax
+     184:	50                   	push   %eax
+     185:	68 8d 1b 00 00       	push   $0x1b8d
+     18a:	ff 77 10             	push   0x10(%edi)
+     18d:	e8 8e 10 00 00       	call   1220 <strcmp>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	74 1a                	je     1b3 <main+0x1b3>
+     199:	50                   	push   %eax
+     19a:	50                   	push   %eax
+     19b:	68 93 1b 00 00       	push   $0x1b93
+     1a0:	ff 77 10             	push   0x10(%edi)
+     1a3:	e8 78 10 00 00       	call   1220 <strcmp>
+     1a8:	83 c4 10             	add    $0x10,%esp
+     1ab:	85 c0                	test   %eax,%eax
+     1ad:	0f 85 6d ff ff ff    	jne    120 <main+0x120>
+     1b3:	50                   	push   %eax
+     1b4:	50                   	push   %eax
+     1b5:	68 8d 1b 00 00       	push   $0x1b8d
+     1ba:	ff 77 18             	push   0x18(%edi)
+     1bd:	e8 5e 10 00 00       	call   1220 <strcmp>
+     1c2:	83 c4 10             	add    $0x10,%esp
+     1c5:	85 c0                	test   %eax,%eax
+     1c7:	74 1a                	je     1e3 <main+0x1e3>
+     1c9:	56                   	push   %esi
+     1ca:	56                   	push   %esi
+     1cb:	68 93 1b 00 00       	push   $0x1b93
+     1d0:	ff 77 18             	push   0x18(%edi)
+     1d3:	e8 48 10 00 00       	call   1220 <strcmp>
+     1d8:	83 c4 10             	add    $0x10,%esp
+     1db:	85 c0                	test   %eax,%eax
+     1dd:	0f 85 3d ff ff ff    	jne    120 <main+0x120>
+			if(strcmp(argv[4], "-size") == 0) {
+     1e3:	53                   	push   %ebx
+     1e4:	53                   	push   %ebx
+     1e5:	68 93 1b 00 00       	push   $0x1b93
+     1ea:	ff 77 10             	push   0x10(%edi)
+     1ed:	e8 2e 10 00 00       	call   1220 <strcmp>
+     1f2:	83 c4 10             	add    $0x10,%esp
+     1f5:	85 c0                	test   %eax,%eax
+     1f7:	0f 85 fe 02 00 00    	jne    4fb <main+0x4fb>
+                    char indFlag = argv[5][0];
+     1fd:	8b 5f 14             	mov    0x14(%edi),%ebx
+                    if(strcmp(indFlag2, greater) == 0) {
+     200:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+                    char indFlag = argv[5][0];
+     206:	0f b6 03             	movzbl (%ebx),%eax
+     209:	88 85 e8 fd ff ff    	mov    %al,-0x218(%ebp)
+                    if(strcmp(indFlag2, greater) == 0) {
+     20f:	51                   	push   %ecx
+     210:	51                   	push   %ecx
+     211:	68 99 1b 00 00       	push   $0x1b99
+     216:	56                   	push   %esi
+     217:	e8 04 10 00 00       	call   1220 <strcmp>
+     21c:	83 c4 10             	add    $0x10,%esp
+     21f:	85 c0                	test   %eax,%eax
+     221:	0f 85 0f 05 00 00    	jne    736 <main+0x736>
+     227:	89 e6                	mov    %esp,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     229:	83 ec 0c             	sub    $0xc,%esp
+                    if(strcmp(indFlag2, greater) == 0) {
+     22c:	89 b5 f0 fc ff ff    	mov    %esi,-0x310(%ebp)
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     232:	53                   	push   %ebx
+     233:	e8 48 10 00 00       	call   1280 <strlen>
+     238:	89 f4                	mov    %esi,%esp
+     23a:	89 bd ec fc ff ff    	mov    %edi,-0x314(%ebp)
+     240:	8d 04 85 0b 00 00 00 	lea    0xb(,%eax,4),%eax
+     247:	83 e0 f0             	and    $0xfffffff0,%eax
+     24a:	29 c6                	sub    %eax,%esi
+     24c:	89 f4                	mov    %esi,%esp
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     24e:	be 01 00 00 00       	mov    $0x1,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     253:	89 e0                	mov    %esp,%eax
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     255:	89 f7                	mov    %esi,%edi
+     257:	89 c6                	mov    %eax,%esi
+     259:	eb 15                	jmp    270 <main+0x270>
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     25b:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+     25e:	52                   	push   %edx
+     25f:	52                   	push   %edx
+     260:	50                   	push   %eax
+     261:	ff 74 be fc          	push   -0x4(%esi,%edi,4)
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     265:	83 c7 01             	add    $0x1,%edi
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     268:	e8 83 0f 00 00       	call   11f0 <strcpy>
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     26d:	83 c4 10             	add    $0x10,%esp
+     270:	83 ec 0c             	sub    $0xc,%esp
+     273:	53                   	push   %ebx
+     274:	e8 07 10 00 00       	call   1280 <strlen>
+     279:	83 c4 10             	add    $0x10,%esp
+     27c:	39 c7                	cmp    %eax,%edi
+     27e:	72 db                	jb     25b <main+0x25b>
+                        findCmd.greaterThanSize = atoi(newSizeFlagString);
+     280:	83 ec 0c             	sub    $0xc,%esp
+     283:	8b bd ec fc ff ff    	mov    -0x314(%ebp),%edi
+     289:	53                   	push   %ebx
+     28a:	e8 31 11 00 00       	call   13c0 <atoi>
+     28f:	89 85 04 fd ff ff    	mov    %eax,-0x2fc(%ebp)
+     295:	8b a5 f0 fc ff ff    	mov    -0x310(%ebp),%esp
+            if(strcmp(argv[4], "-type") != 0 && (strcmp(argv[4], "-size") != 0)) {
+     29b:	56                   	push   %esi
+     29c:	56                   	push   %esi
+     29d:	68 8d 1b 00 00       	push   $0x1b8d
+     2a2:	ff 77 10             	push   0x10(%edi)
+     2a5:	e8 76 0f 00 00       	call   1220 <strcmp>
+     2aa:	83 c4 10             	add    $0x10,%esp
+     2ad:	85 c0                	test   %eax,%eax
+     2af:	74 1a                	je     2cb <main+0x2cb>
+     2b1:	53                   	push   %ebx
+     2b2:	53                   	push   %ebx
+     2b3:	68 93 1b 00 00       	push   $0x1b93
+     2b8:	ff 77 10             	push   0x10(%edi)
+     2bb:	e8 60 0f 00 00       	call   1220 <strcmp>
+     2c0:	83 c4 10             	add    $0x10,%esp
+     2c3:	85 c0                	test   %eax,%eax
+     2c5:	0f 85 55 fe ff ff    	jne    120 <main+0x120>
+            if (strcmp(argv[6], "-size") == 0) {
+     2cb:	51                   	push   %ecx
+     2cc:	51                   	push   %ecx
+     2cd:	68 93 1b 00 00       	push   $0x1b93
+     2d2:	ff 77 18             	push   0x18(%edi)
+     2d5:	e8 46 0f 00 00       	call   1220 <strcmp>
+     2da:	83 c4 10             	add    $0x10,%esp
+     2dd:	85 c0                	test   %eax,%eax
+     2df:	0f 85 1a 03 00 00    	jne    5ff <main+0x5ff>
+                    char indFlag = argv[7][0];
+     2e5:	8b 5f 1c             	mov    0x1c(%edi),%ebx
+                    if(strcmp(indFlag2, greater) == 0) {
+     2e8:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+                    char indFlag = argv[7][0];
+     2ee:	0f b6 03             	movzbl (%ebx),%eax
+     2f1:	88 85 e8 fd ff ff    	mov    %al,-0x218(%ebp)
+                    if(strcmp(indFlag2, greater) == 0) {
+     2f7:	52                   	push   %edx
+     2f8:	52                   	push   %edx
+     2f9:	68 99 1b 00 00       	push   $0x1b99
+     2fe:	56                   	push   %esi
+     2ff:	e8 1c 0f 00 00       	call   1220 <strcmp>
+     304:	83 c4 10             	add    $0x10,%esp
+     307:	85 c0                	test   %eax,%eax
+     309:	0f 85 68 05 00 00    	jne    877 <main+0x877>
+     30f:	89 e6                	mov    %esp,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     311:	83 ec 0c             	sub    $0xc,%esp
+                    if(strcmp(indFlag2, greater) == 0) {
+     314:	89 b5 f0 fc ff ff    	mov    %esi,-0x310(%ebp)
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     31a:	53                   	push   %ebx
+     31b:	e8 60 0f 00 00       	call   1280 <strlen>
+     320:	89 f4                	mov    %esi,%esp
+     322:	89 bd ec fc ff ff    	mov    %edi,-0x314(%ebp)
+     328:	8d 04 85 0b 00 00 00 	lea    0xb(,%eax,4),%eax
+     32f:	83 e0 f0             	and    $0xfffffff0,%eax
+     332:	29 c6                	sub    %eax,%esi
+     334:	89 f4                	mov    %esi,%esp
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     336:	be 01 00 00 00       	mov    $0x1,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     33b:	89 e0                	mov    %esp,%eax
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     33d:	89 f7                	mov    %esi,%edi
+     33f:	89 c6                	mov    %eax,%esi
+     341:	eb 15                	jmp    358 <main+0x358>
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     343:	50                   	push   %eax
+     344:	50                   	push   %eax
+     345:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+     348:	50                   	push   %eax
+     349:	ff 74 be fc          	push   -0x4(%esi,%edi,4)
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     34d:	83 c7 01             	add    $0x1,%edi
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     350:	e8 9b 0e 00 00       	call   11f0 <strcpy>
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     355:	83 c4 10             	add    $0x10,%esp
+     358:	83 ec 0c             	sub    $0xc,%esp
+     35b:	53                   	push   %ebx
+     35c:	e8 1f 0f 00 00       	call   1280 <strlen>
+     361:	83 c4 10             	add    $0x10,%esp
+     364:	39 c7                	cmp    %eax,%edi
+     366:	72 db                	jb     343 <main+0x343>
+                        findCmd.greaterThanSize = atoi(newSizeFlagString);
+     368:	83 ec 0c             	sub    $0xc,%esp
+     36b:	8b bd ec fc ff ff    	mov    -0x314(%ebp),%edi
+     371:	53                   	push   %ebx
+     372:	e8 49 10 00 00       	call   13c0 <atoi>
+     377:	89 85 04 fd ff ff    	mov    %eax,-0x2fc(%ebp)
+     37d:	8b a5 f0 fc ff ff    	mov    -0x310(%ebp),%esp
+            if(strcmp(argv[6], "-type") != 0 && (strcmp(argv[6], "-size") != 0)) {
+     383:	53                   	push   %ebx
+     384:	53                   	push   %ebx
+     385:	68 8d 1b 00 00       	push   $0x1b8d
+     38a:	ff 77 18             	push   0x18(%edi)
+     38d:	e8 8e 0e 00 00       	call   1220 <strcmp>
+     392:	83 c4 10             	add    $0x10,%esp
+     395:	85 c0                	test   %eax,%eax
+     397:	0f 85 7a 03 00 00    	jne    717 <main+0x717>
+            findCmd.bothFlags = TRUE;
+     39d:	c7 85 f0 fc ff ff 01 	movl   $0x1,-0x310(%ebp)
+     3a4:	00 00 00 
+    findCmd.oneFlag = FALSE;
+     3a7:	31 f6                	xor    %esi,%esi
+     3a9:	e9 dd fc ff ff       	jmp    8b <main+0x8b>
+            printf(1, "find failed: Cannot open folder: %s, or folder does not exist.\n", argv[1]);
+     3ae:	50                   	push   %eax
+     3af:	ff 77 04             	push   0x4(%edi)
+     3b2:	68 90 1a 00 00       	push   $0x1a90
+     3b7:	6a 01                	push   $0x1
+     3b9:	e8 12 12 00 00       	call   15d0 <printf>
+            exit();
+     3be:	e8 70 10 00 00       	call   1433 <exit>
+			if(strcmp(argv[2],"-name") != 0 || (strcmp(argv[4],"-type") != 0 && strcmp(argv[4],"-size") != 0)) {
+     3c3:	53                   	push   %ebx
+     3c4:	53                   	push   %ebx
+     3c5:	68 8d 1b 00 00       	push   $0x1b8d
+     3ca:	ff 77 10             	push   0x10(%edi)
+     3cd:	e8 4e 0e 00 00       	call   1220 <strcmp>
+     3d2:	83 c4 10             	add    $0x10,%esp
+     3d5:	85 c0                	test   %eax,%eax
+     3d7:	74 1a                	je     3f3 <main+0x3f3>
+     3d9:	51                   	push   %ecx
+     3da:	51                   	push   %ecx
+     3db:	68 93 1b 00 00       	push   $0x1b93
+     3e0:	ff 77 10             	push   0x10(%edi)
+     3e3:	e8 38 0e 00 00       	call   1220 <strcmp>
+     3e8:	83 c4 10             	add    $0x10,%esp
+     3eb:	85 c0                	test   %eax,%eax
+     3ed:	0f 85 2d fd ff ff    	jne    120 <main+0x120>
+			if(strcmp(argv[4], "-size") == 0){ 
+     3f3:	52                   	push   %edx
+     3f4:	52                   	push   %edx
+     3f5:	68 93 1b 00 00       	push   $0x1b93
+     3fa:	ff 77 10             	push   0x10(%edi)
+     3fd:	e8 1e 0e 00 00       	call   1220 <strcmp>
+     402:	83 c4 10             	add    $0x10,%esp
+     405:	85 c0                	test   %eax,%eax
+     407:	0f 84 30 01 00 00    	je     53d <main+0x53d>
+			if(strcmp(argv[4],"-type") == 0) {
+     40d:	50                   	push   %eax
+     40e:	50                   	push   %eax
+     40f:	68 8d 1b 00 00       	push   $0x1b8d
+     414:	ff 77 10             	push   0x10(%edi)
+     417:	e8 04 0e 00 00       	call   1220 <strcmp>
+     41c:	83 c4 10             	add    $0x10,%esp
+     41f:	85 c0                	test   %eax,%eax
+     421:	75 23                	jne    446 <main+0x446>
+				if(strcmp(argv[5], FOLDER) != 0 && strcmp(argv[5], DIRECTORY) != 0) {
+     423:	56                   	push   %esi
+     424:	56                   	push   %esi
+     425:	68 7d 1b 00 00       	push   $0x1b7d
+     42a:	ff 77 14             	push   0x14(%edi)
+     42d:	e8 ee 0d 00 00       	call   1220 <strcmp>
+     432:	83 c4 10             	add    $0x10,%esp
+     435:	85 c0                	test   %eax,%eax
+     437:	0f 85 1b 04 00 00    	jne    858 <main+0x858>
+				findCmd.type = argv[5];
+     43d:	8b 47 14             	mov    0x14(%edi),%eax
+     440:	89 85 fc fc ff ff    	mov    %eax,-0x304(%ebp)
+            if(strcmp(argv[4], "-type") != 0 && (strcmp(argv[4], "-size") != 0)) {
+     446:	51                   	push   %ecx
+     447:	51                   	push   %ecx
+     448:	68 8d 1b 00 00       	push   $0x1b8d
+     44d:	ff 77 10             	push   0x10(%edi)
+     450:	e8 cb 0d 00 00       	call   1220 <strcmp>
+     455:	83 c4 10             	add    $0x10,%esp
+     458:	85 c0                	test   %eax,%eax
+     45a:	0f 85 80 01 00 00    	jne    5e0 <main+0x5e0>
+    findCmd.bothFlags = FALSE;
+     460:	31 d2                	xor    %edx,%edx
+            findCmd.oneFlag = TRUE;
+     462:	be 01 00 00 00       	mov    $0x1,%esi
+    findCmd.bothFlags = FALSE;
+     467:	89 95 f0 fc ff ff    	mov    %edx,-0x310(%ebp)
+     46d:	e9 19 fc ff ff       	jmp    8b <main+0x8b>
+        findNoFlags(findCmd, statObj, argv[1], startingFileDescriptor, bufferStr);
+     472:	8b 95 ec fc ff ff    	mov    -0x314(%ebp),%edx
+     478:	8b 47 04             	mov    0x4(%edi),%eax
+     47b:	89 b5 10 fd ff ff    	mov    %esi,-0x2f0(%ebp)
+     481:	b9 34 00 00 00       	mov    $0x34,%ecx
+     486:	c7 85 0c fd ff ff 01 	movl   $0x1,-0x2f4(%ebp)
+     48d:	00 00 00 
+     490:	8d b5 18 fd ff ff    	lea    -0x2e8(%ebp),%esi
+     496:	89 95 f8 fc ff ff    	mov    %edx,-0x308(%ebp)
+     49c:	8b 95 f0 fc ff ff    	mov    -0x310(%ebp),%edx
+     4a2:	89 95 14 fd ff ff    	mov    %edx,-0x2ec(%ebp)
+     4a8:	52                   	push   %edx
+     4a9:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+     4af:	52                   	push   %edx
+     4b0:	53                   	push   %ebx
+     4b1:	50                   	push   %eax
+     4b2:	81 ec d0 00 00 00    	sub    $0xd0,%esp
+     4b8:	89 e7                	mov    %esp,%edi
+     4ba:	83 ec 20             	sub    $0x20,%esp
+     4bd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     4bf:	89 e7                	mov    %esp,%edi
+     4c1:	8d b5 f8 fc ff ff    	lea    -0x308(%ebp),%esi
+     4c7:	b9 08 00 00 00       	mov    $0x8,%ecx
+     4cc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     4ce:	e8 dd 0b 00 00       	call   10b0 <findNoFlags>
+     4d3:	81 c4 00 01 00 00    	add    $0x100,%esp
+     4d9:	e9 14 fc ff ff       	jmp    f2 <main+0xf2>
+            printf(1, "find failed: Cannot get status information about: %s\n", argv[1]);
+     4de:	51                   	push   %ecx
+     4df:	ff 77 04             	push   0x4(%edi)
+     4e2:	68 d0 1a 00 00       	push   $0x1ad0
+     4e7:	6a 01                	push   $0x1
+     4e9:	e8 e2 10 00 00       	call   15d0 <printf>
+            close(startingFileDescriptor);
+     4ee:	89 1c 24             	mov    %ebx,(%esp)
+     4f1:	e8 65 0f 00 00       	call   145b <close>
+            exit();
+     4f6:	e8 38 0f 00 00       	call   1433 <exit>
+			} else if(strcmp(argv[4],"-type") == 0) {
+     4fb:	50                   	push   %eax
+     4fc:	50                   	push   %eax
+     4fd:	68 8d 1b 00 00       	push   $0x1b8d
+     502:	ff 77 10             	push   0x10(%edi)
+     505:	e8 16 0d 00 00       	call   1220 <strcmp>
+     50a:	83 c4 10             	add    $0x10,%esp
+     50d:	85 c0                	test   %eax,%eax
+     50f:	0f 85 86 fd ff ff    	jne    29b <main+0x29b>
+				if(strcmp(argv[5],FOLDER) != 0 && strcmp(argv[5], DIRECTORY) != 0) {
+     515:	50                   	push   %eax
+     516:	50                   	push   %eax
+     517:	68 7d 1b 00 00       	push   $0x1b7d
+     51c:	ff 77 14             	push   0x14(%edi)
+     51f:	e8 fc 0c 00 00       	call   1220 <strcmp>
+     524:	83 c4 10             	add    $0x10,%esp
+     527:	85 c0                	test   %eax,%eax
+     529:	0f 85 24 04 00 00    	jne    953 <main+0x953>
+				findCmd.type = argv[5];
+     52f:	8b 47 14             	mov    0x14(%edi),%eax
+     532:	89 85 fc fc ff ff    	mov    %eax,-0x304(%ebp)
+     538:	e9 5e fd ff ff       	jmp    29b <main+0x29b>
+                    char indFlag = argv[5][0];
+     53d:	8b 5f 14             	mov    0x14(%edi),%ebx
+                    if(strcmp(indFlag2, greater) == 0) {
+     540:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+                    char indFlag = argv[5][0];
+     546:	0f b6 03             	movzbl (%ebx),%eax
+     549:	88 85 e8 fd ff ff    	mov    %al,-0x218(%ebp)
+                    if(strcmp(indFlag2, greater) == 0) {
+     54f:	50                   	push   %eax
+     550:	50                   	push   %eax
+     551:	68 99 1b 00 00       	push   $0x1b99
+     556:	56                   	push   %esi
+     557:	e8 c4 0c 00 00       	call   1220 <strcmp>
+     55c:	83 c4 10             	add    $0x10,%esp
+     55f:	85 c0                	test   %eax,%eax
+     561:	0f 85 60 02 00 00    	jne    7c7 <main+0x7c7>
+     567:	89 e6                	mov    %esp,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     569:	83 ec 0c             	sub    $0xc,%esp
+                    if(strcmp(indFlag2, greater) == 0) {
+     56c:	89 b5 f0 fc ff ff    	mov    %esi,-0x310(%ebp)
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     572:	53                   	push   %ebx
+     573:	e8 08 0d 00 00       	call   1280 <strlen>
+     578:	89 f4                	mov    %esi,%esp
+     57a:	89 bd ec fc ff ff    	mov    %edi,-0x314(%ebp)
+     580:	8d 04 85 0b 00 00 00 	lea    0xb(,%eax,4),%eax
+     587:	83 e0 f0             	and    $0xfffffff0,%eax
+     58a:	29 c6                	sub    %eax,%esi
+     58c:	89 f4                	mov    %esi,%esp
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     58e:	be 01 00 00 00       	mov    $0x1,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     593:	89 e0                	mov    %esp,%eax
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     595:	89 f7                	mov    %esi,%edi
+     597:	89 c6                	mov    %eax,%esi
+     599:	eb 15                	jmp    5b0 <main+0x5b0>
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     59b:	50                   	push   %eax
+     59c:	50                   	push   %eax
+     59d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+     5a0:	50                   	push   %eax
+     5a1:	ff 74 be fc          	push   -0x4(%esi,%edi,4)
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     5a5:	83 c7 01             	add    $0x1,%edi
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     5a8:	e8 43 0c 00 00       	call   11f0 <strcpy>
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     5ad:	83 c4 10             	add    $0x10,%esp
+     5b0:	83 ec 0c             	sub    $0xc,%esp
+     5b3:	53                   	push   %ebx
+     5b4:	e8 c7 0c 00 00       	call   1280 <strlen>
+     5b9:	83 c4 10             	add    $0x10,%esp
+     5bc:	39 c7                	cmp    %eax,%edi
+     5be:	72 db                	jb     59b <main+0x59b>
+                        findCmd.greaterThanSize = atoi(newSizeFlagString);
+     5c0:	83 ec 0c             	sub    $0xc,%esp
+     5c3:	8b bd ec fc ff ff    	mov    -0x314(%ebp),%edi
+     5c9:	53                   	push   %ebx
+     5ca:	e8 f1 0d 00 00       	call   13c0 <atoi>
+     5cf:	89 85 04 fd ff ff    	mov    %eax,-0x2fc(%ebp)
+     5d5:	8b a5 f0 fc ff ff    	mov    -0x310(%ebp),%esp
+     5db:	e9 2d fe ff ff       	jmp    40d <main+0x40d>
+            if(strcmp(argv[4], "-type") != 0 && (strcmp(argv[4], "-size") != 0)) {
+     5e0:	50                   	push   %eax
+     5e1:	50                   	push   %eax
+     5e2:	68 93 1b 00 00       	push   $0x1b93
+     5e7:	ff 77 10             	push   0x10(%edi)
+     5ea:	e8 31 0c 00 00       	call   1220 <strcmp>
+     5ef:	83 c4 10             	add    $0x10,%esp
+     5f2:	85 c0                	test   %eax,%eax
+     5f4:	0f 84 66 fe ff ff    	je     460 <main+0x460>
+     5fa:	e9 21 fb ff ff       	jmp    120 <main+0x120>
+			} else if(strcmp(argv[6],"-type") == 0) {
+     5ff:	50                   	push   %eax
+     600:	50                   	push   %eax
+     601:	68 8d 1b 00 00       	push   $0x1b8d
+     606:	ff 77 18             	push   0x18(%edi)
+     609:	e8 12 0c 00 00       	call   1220 <strcmp>
+     60e:	83 c4 10             	add    $0x10,%esp
+     611:	85 c0                	test   %eax,%eax
+     613:	0f 85 6a fd ff ff    	jne    383 <main+0x383>
+				if(strcmp(argv[7],FOLDER) != 0 && strcmp(argv[7],DIRECTORY) != 0) {
+     619:	50                   	push   %eax
+     61a:	50                   	push   %eax
+     61b:	68 7d 1b 00 00       	push   $0x1b7d
+     620:	ff 77 1c             	push   0x1c(%edi)
+     623:	e8 f8 0b 00 00       	call   1220 <strcmp>
+     628:	83 c4 10             	add    $0x10,%esp
+     62b:	85 c0                	test   %eax,%eax
+     62d:	0f 85 3f 03 00 00    	jne    972 <main+0x972>
+				findCmd.type = argv[7];
+     633:	8b 47 1c             	mov    0x1c(%edi),%eax
+     636:	89 85 fc fc ff ff    	mov    %eax,-0x304(%ebp)
+     63c:	e9 42 fd ff ff       	jmp    383 <main+0x383>
+        findOneFlag(findCmd, statObj, argv[1], startingFileDescriptor, bufferStr);
+     641:	8b 95 ec fc ff ff    	mov    -0x314(%ebp),%edx
+     647:	8b 47 04             	mov    0x4(%edi),%eax
+     64a:	31 f6                	xor    %esi,%esi
+     64c:	b9 34 00 00 00       	mov    $0x34,%ecx
+     651:	89 b5 0c fd ff ff    	mov    %esi,-0x2f4(%ebp)
+     657:	8d b5 18 fd ff ff    	lea    -0x2e8(%ebp),%esi
+     65d:	89 95 f8 fc ff ff    	mov    %edx,-0x308(%ebp)
+     663:	8b 95 f0 fc ff ff    	mov    -0x310(%ebp),%edx
+     669:	c7 85 10 fd ff ff 01 	movl   $0x1,-0x2f0(%ebp)
+     670:	00 00 00 
+     673:	89 95 14 fd ff ff    	mov    %edx,-0x2ec(%ebp)
+     679:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+     67f:	57                   	push   %edi
+     680:	52                   	push   %edx
+     681:	53                   	push   %ebx
+     682:	50                   	push   %eax
+     683:	81 ec d0 00 00 00    	sub    $0xd0,%esp
+     689:	89 e7                	mov    %esp,%edi
+     68b:	83 ec 20             	sub    $0x20,%esp
+     68e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     690:	89 e7                	mov    %esp,%edi
+     692:	8d b5 f8 fc ff ff    	lea    -0x308(%ebp),%esi
+     698:	b9 08 00 00 00       	mov    $0x8,%ecx
+     69d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     69f:	e8 7c 04 00 00       	call   b20 <findOneFlag>
+     6a4:	81 c4 00 01 00 00    	add    $0x100,%esp
+     6aa:	e9 43 fa ff ff       	jmp    f2 <main+0xf2>
+        findBothFlags(findCmd, statObj, argv[1], startingFileDescriptor, bufferStr);       
+     6af:	8b 95 ec fc ff ff    	mov    -0x314(%ebp),%edx
+     6b5:	8b 47 04             	mov    0x4(%edi),%eax
+     6b8:	8d b5 18 fd ff ff    	lea    -0x2e8(%ebp),%esi
+     6be:	c7 85 14 fd ff ff 01 	movl   $0x1,-0x2ec(%ebp)
+     6c5:	00 00 00 
+     6c8:	89 95 f8 fc ff ff    	mov    %edx,-0x308(%ebp)
+     6ce:	31 d2                	xor    %edx,%edx
+     6d0:	89 95 0c fd ff ff    	mov    %edx,-0x2f4(%ebp)
+     6d6:	89 95 10 fd ff ff    	mov    %edx,-0x2f0(%ebp)
+     6dc:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+     6e2:	51                   	push   %ecx
+     6e3:	b9 34 00 00 00       	mov    $0x34,%ecx
+     6e8:	52                   	push   %edx
+     6e9:	53                   	push   %ebx
+     6ea:	50                   	push   %eax
+     6eb:	81 ec d0 00 00 00    	sub    $0xd0,%esp
+     6f1:	89 e7                	mov    %esp,%edi
+     6f3:	83 ec 20             	sub    $0x20,%esp
+     6f6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     6f8:	89 e7                	mov    %esp,%edi
+     6fa:	8d b5 f8 fc ff ff    	lea    -0x308(%ebp),%esi
+     700:	b9 08 00 00 00       	mov    $0x8,%ecx
+     705:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     707:	e8 a4 07 00 00       	call   eb0 <findBothFlags>
+     70c:	81 c4 00 01 00 00    	add    $0x100,%esp
+     712:	e9 db f9 ff ff       	jmp    f2 <main+0xf2>
+            if(strcmp(argv[6], "-type") != 0 && (strcmp(argv[6], "-size") != 0)) {
+     717:	51                   	push   %ecx
+     718:	51                   	push   %ecx
+     719:	68 93 1b 00 00       	push   $0x1b93
+     71e:	ff 77 18             	push   0x18(%edi)
+     721:	e8 fa 0a 00 00       	call   1220 <strcmp>
+     726:	83 c4 10             	add    $0x10,%esp
+     729:	85 c0                	test   %eax,%eax
+     72b:	0f 84 6c fc ff ff    	je     39d <main+0x39d>
+     731:	e9 ea f9 ff ff       	jmp    120 <main+0x120>
+                    } else if (strcmp(indFlag2, lesser) == 0) {
+     736:	50                   	push   %eax
+     737:	50                   	push   %eax
+     738:	68 9b 1b 00 00       	push   $0x1b9b
+     73d:	56                   	push   %esi
+     73e:	e8 dd 0a 00 00       	call   1220 <strcmp>
+     743:	83 c4 10             	add    $0x10,%esp
+     746:	85 c0                	test   %eax,%eax
+     748:	0f 85 ba 01 00 00    	jne    908 <main+0x908>
+     74e:	89 e6                	mov    %esp,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     750:	83 ec 0c             	sub    $0xc,%esp
+                    } else if (strcmp(indFlag2, lesser) == 0) {
+     753:	89 b5 f0 fc ff ff    	mov    %esi,-0x310(%ebp)
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     759:	53                   	push   %ebx
+     75a:	e8 21 0b 00 00       	call   1280 <strlen>
+     75f:	89 f4                	mov    %esi,%esp
+     761:	89 bd ec fc ff ff    	mov    %edi,-0x314(%ebp)
+     767:	8d 04 85 0b 00 00 00 	lea    0xb(,%eax,4),%eax
+     76e:	83 e0 f0             	and    $0xfffffff0,%eax
+     771:	29 c6                	sub    %eax,%esi
+     773:	89 f4                	mov    %esi,%esp
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     775:	be 01 00 00 00       	mov    $0x1,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     77a:	89 e0                	mov    %esp,%eax
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     77c:	89 f7                	mov    %esi,%edi
+     77e:	89 c6                	mov    %eax,%esi
+     780:	eb 15                	jmp    797 <main+0x797>
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     782:	50                   	push   %eax
+     783:	50                   	push   %eax
+     784:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+     787:	50                   	push   %eax
+     788:	ff 74 be fc          	push   -0x4(%esi,%edi,4)
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     78c:	83 c7 01             	add    $0x1,%edi
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     78f:	e8 5c 0a 00 00       	call   11f0 <strcpy>
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     794:	83 c4 10             	add    $0x10,%esp
+     797:	83 ec 0c             	sub    $0xc,%esp
+     79a:	53                   	push   %ebx
+     79b:	e8 e0 0a 00 00       	call   1280 <strlen>
+     7a0:	83 c4 10             	add    $0x10,%esp
+     7a3:	39 c7                	cmp    %eax,%edi
+     7a5:	72 db                	jb     782 <main+0x782>
+                        findCmd.lessThanSize = atoi(newSizeFlagString);
+     7a7:	83 ec 0c             	sub    $0xc,%esp
+     7aa:	8b bd ec fc ff ff    	mov    -0x314(%ebp),%edi
+     7b0:	53                   	push   %ebx
+     7b1:	e8 0a 0c 00 00       	call   13c0 <atoi>
+     7b6:	89 85 08 fd ff ff    	mov    %eax,-0x2f8(%ebp)
+     7bc:	8b a5 f0 fc ff ff    	mov    -0x310(%ebp),%esp
+     7c2:	e9 d4 fa ff ff       	jmp    29b <main+0x29b>
+                    } else if (strcmp(indFlag2, lesser) == 0) {
+     7c7:	50                   	push   %eax
+     7c8:	50                   	push   %eax
+     7c9:	68 9b 1b 00 00       	push   $0x1b9b
+     7ce:	56                   	push   %esi
+     7cf:	e8 4c 0a 00 00       	call   1220 <strcmp>
+     7d4:	83 c4 10             	add    $0x10,%esp
+     7d7:	85 c0                	test   %eax,%eax
+     7d9:	0f 85 42 01 00 00    	jne    921 <main+0x921>
+     7df:	89 e6                	mov    %esp,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     7e1:	83 ec 0c             	sub    $0xc,%esp
+                    } else if (strcmp(indFlag2, lesser) == 0) {
+     7e4:	89 b5 f0 fc ff ff    	mov    %esi,-0x310(%ebp)
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     7ea:	53                   	push   %ebx
+     7eb:	e8 90 0a 00 00       	call   1280 <strlen>
+     7f0:	89 f4                	mov    %esi,%esp
+     7f2:	89 bd ec fc ff ff    	mov    %edi,-0x314(%ebp)
+     7f8:	8d 04 85 0b 00 00 00 	lea    0xb(,%eax,4),%eax
+     7ff:	83 e0 f0             	and    $0xfffffff0,%eax
+     802:	29 c6                	sub    %eax,%esi
+     804:	89 f4                	mov    %esi,%esp
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     806:	be 01 00 00 00       	mov    $0x1,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     80b:	89 e0                	mov    %esp,%eax
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     80d:	89 f7                	mov    %esi,%edi
+     80f:	89 c6                	mov    %eax,%esi
+     811:	eb 15                	jmp    828 <main+0x828>
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     813:	50                   	push   %eax
+     814:	50                   	push   %eax
+     815:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+     818:	50                   	push   %eax
+     819:	ff 74 be fc          	push   -0x4(%esi,%edi,4)
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     81d:	83 c7 01             	add    $0x1,%edi
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     820:	e8 cb 09 00 00       	call   11f0 <strcpy>
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     825:	83 c4 10             	add    $0x10,%esp
+     828:	83 ec 0c             	sub    $0xc,%esp
+     82b:	53                   	push   %ebx
+     82c:	e8 4f 0a 00 00       	call   1280 <strlen>
+     831:	83 c4 10             	add    $0x10,%esp
+     834:	39 c7                	cmp    %eax,%edi
+     836:	72 db                	jb     813 <main+0x813>
+                        findCmd.lessThanSize = atoi(newSizeFlagString);
+     838:	83 ec 0c             	sub    $0xc,%esp
+     83b:	8b bd ec fc ff ff    	mov    -0x314(%ebp),%edi
+     841:	53                   	push   %ebx
+     842:	e8 79 0b 00 00       	call   13c0 <atoi>
+     847:	89 85 08 fd ff ff    	mov    %eax,-0x2f8(%ebp)
+     84d:	8b a5 f0 fc ff ff    	mov    -0x310(%ebp),%esp
+     853:	e9 b5 fb ff ff       	jmp    40d <main+0x40d>
+				if(strcmp(argv[5], FOLDER) != 0 && strcmp(argv[5], DIRECTORY) != 0) {
+     858:	53                   	push   %ebx
+     859:	53                   	push   %ebx
+     85a:	68 83 1b 00 00       	push   $0x1b83
+     85f:	ff 77 14             	push   0x14(%edi)
+     862:	e8 b9 09 00 00       	call   1220 <strcmp>
+     867:	83 c4 10             	add    $0x10,%esp
+     86a:	85 c0                	test   %eax,%eax
+     86c:	0f 84 cb fb ff ff    	je     43d <main+0x43d>
+     872:	e9 a9 f8 ff ff       	jmp    120 <main+0x120>
+                    } else if (strcmp(indFlag2, lesser) == 0) {
+     877:	50                   	push   %eax
+     878:	50                   	push   %eax
+     879:	68 9b 1b 00 00       	push   $0x1b9b
+     87e:	56                   	push   %esi
+     87f:	e8 9c 09 00 00       	call   1220 <strcmp>
+     884:	83 c4 10             	add    $0x10,%esp
+     887:	85 c0                	test   %eax,%eax
+     889:	0f 85 ab 00 00 00    	jne    93a <main+0x93a>
+     88f:	89 e6                	mov    %esp,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     891:	83 ec 0c             	sub    $0xc,%esp
+                    } else if (strcmp(indFlag2, lesser) == 0) {
+     894:	89 b5 f0 fc ff ff    	mov    %esi,-0x310(%ebp)
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     89a:	53                   	push   %ebx
+     89b:	e8 e0 09 00 00       	call   1280 <strlen>
+     8a0:	89 f4                	mov    %esi,%esp
+     8a2:	89 bd ec fc ff ff    	mov    %edi,-0x314(%ebp)
+     8a8:	8d 04 85 0b 00 00 00 	lea    0xb(,%eax,4),%eax
+     8af:	83 e0 f0             	and    $0xfffffff0,%eax
+     8b2:	29 c6                	sub    %eax,%esi
+     8b4:	89 f4                	mov    %esi,%esp
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     8b6:	be 01 00 00 00       	mov    $0x1,%esi
+                        char* sizeNumString[strlen(newSizeFlagString) - 1]; 
+     8bb:	89 e0                	mov    %esp,%eax
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     8bd:	89 f7                	mov    %esi,%edi
+     8bf:	89 c6                	mov    %eax,%esi
+     8c1:	eb 15                	jmp    8d8 <main+0x8d8>
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     8c3:	50                   	push   %eax
+     8c4:	50                   	push   %eax
+     8c5:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+     8c8:	50                   	push   %eax
+     8c9:	ff 74 be fc          	push   -0x4(%esi,%edi,4)
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     8cd:	83 c7 01             	add    $0x1,%edi
+                            strcpy(sizeNumString[i-1], &newSizeFlagString[i]);
+     8d0:	e8 1b 09 00 00       	call   11f0 <strcpy>
+                        for(int i = 1; i < strlen(newSizeFlagString); i++){
+     8d5:	83 c4 10             	add    $0x10,%esp
+     8d8:	83 ec 0c             	sub    $0xc,%esp
+     8db:	53                   	push   %ebx
+     8dc:	e8 9f 09 00 00       	call   1280 <strlen>
+     8e1:	83 c4 10             	add    $0x10,%esp
+     8e4:	39 c7                	cmp    %eax,%edi
+     8e6:	72 db                	jb     8c3 <main+0x8c3>
+                        findCmd.lessThanSize = atoi(newSizeFlagString);
+     8e8:	83 ec 0c             	sub    $0xc,%esp
+     8eb:	8b bd ec fc ff ff    	mov    -0x314(%ebp),%edi
+     8f1:	53                   	push   %ebx
+     8f2:	e8 c9 0a 00 00       	call   13c0 <atoi>
+     8f7:	89 85 08 fd ff ff    	mov    %eax,-0x2f8(%ebp)
+     8fd:	8b a5 f0 fc ff ff    	mov    -0x310(%ebp),%esp
+     903:	e9 7b fa ff ff       	jmp    383 <main+0x383>
+                        findCmd.equalSize = atoi(argv[5]);
+     908:	83 ec 0c             	sub    $0xc,%esp
+     90b:	ff 77 14             	push   0x14(%edi)
+     90e:	e8 ad 0a 00 00       	call   13c0 <atoi>
+     913:	83 c4 10             	add    $0x10,%esp
+     916:	89 85 00 fd ff ff    	mov    %eax,-0x300(%ebp)
+     91c:	e9 7a f9 ff ff       	jmp    29b <main+0x29b>
+                        findCmd.equalSize = atoi(argv[5]);
+     921:	83 ec 0c             	sub    $0xc,%esp
+     924:	ff 77 14             	push   0x14(%edi)
+     927:	e8 94 0a 00 00       	call   13c0 <atoi>
+     92c:	83 c4 10             	add    $0x10,%esp
+     92f:	89 85 00 fd ff ff    	mov    %eax,-0x300(%ebp)
+     935:	e9 d3 fa ff ff       	jmp    40d <main+0x40d>
+                        findCmd.equalSize = atoi(argv[7]);
+     93a:	83 ec 0c             	sub    $0xc,%esp
+     93d:	ff 77 1c             	push   0x1c(%edi)
+     940:	e8 7b 0a 00 00       	call   13c0 <atoi>
+     945:	83 c4 10             	add    $0x10,%esp
+     948:	89 85 00 fd ff ff    	mov    %eax,-0x300(%ebp)
+     94e:	e9 30 fa ff ff       	jmp    383 <main+0x383>
+				if(strcmp(argv[5],FOLDER) != 0 && strcmp(argv[5], DIRECTORY) != 0) {
+     953:	50                   	push   %eax
+     954:	50                   	push   %eax
+     955:	68 83 1b 00 00       	push   $0x1b83
+     95a:	ff 77 14             	push   0x14(%edi)
+     95d:	e8 be 08 00 00       	call   1220 <strcmp>
+     962:	83 c4 10             	add    $0x10,%esp
+     965:	85 c0                	test   %eax,%eax
+     967:	0f 84 c2 fb ff ff    	je     52f <main+0x52f>
+     96d:	e9 ae f7 ff ff       	jmp    120 <main+0x120>
+				if(strcmp(argv[7],FOLDER) != 0 && strcmp(argv[7],DIRECTORY) != 0) {
+     972:	56                   	push   %esi
+     973:	56                   	push   %esi
+     974:	68 83 1b 00 00       	push   $0x1b83
+     979:	ff 77 1c             	push   0x1c(%edi)
+     97c:	e8 9f 08 00 00       	call   1220 <strcmp>
+     981:	83 c4 10             	add    $0x10,%esp
+     984:	85 c0                	test   %eax,%eax
+     986:	0f 84 a7 fc ff ff    	je     633 <main+0x633>
+     98c:	e9 8f f7 ff ff       	jmp    120 <main+0x120>
+     991:	66 90                	xchg   %ax,%ax
+     993:	66 90                	xchg   %ax,%ax
+     995:	66 90                	xchg   %ax,%ax
+     997:	66 90                	xchg   %ax,%ax
+     999:	66 90                	xchg   %ax,%ax
+     99b:	66 90                	xchg   %ax,%ax
+     99d:	66 90                	xchg   %ax,%ax
+     99f:	90                   	nop
+
+000009a0 <displayFormattingErrorMsg>:
+void displayFormattingErrorMsg() {
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	83 ec 10             	sub    $0x10,%esp
+	printf(1, "\nfind failed: Invalid number of arguments. Please format your arguments to one of the following: \n");
+     9a6:	68 f8 18 00 00       	push   $0x18f8
+     9ab:	6a 01                	push   $0x1
+     9ad:	e8 1e 0c 00 00       	call   15d0 <printf>
+	printf(1, "\n\t\tfind <name>");
+     9b2:	58                   	pop    %eax
+     9b3:	5a                   	pop    %edx
+     9b4:	68 4d 1b 00 00       	push   $0x1b4d
+     9b9:	6a 01                	push   $0x1
+     9bb:	e8 10 0c 00 00       	call   15d0 <printf>
+	printf(1, "\n\t\tfind <folder> -name <name>");
+     9c0:	59                   	pop    %ecx
+     9c1:	58                   	pop    %eax
+     9c2:	68 5c 1b 00 00       	push   $0x1b5c
+     9c7:	6a 01                	push   $0x1
+     9c9:	e8 02 0c 00 00       	call   15d0 <printf>
+	printf(1, "\n\t\tfind <folder> -name <name> -type f");
+     9ce:	58                   	pop    %eax
+     9cf:	5a                   	pop    %edx
+     9d0:	68 5c 19 00 00       	push   $0x195c
+     9d5:	6a 01                	push   $0x1
+     9d7:	e8 f4 0b 00 00       	call   15d0 <printf>
+	printf(1, "\n\t\tfind <folder> -name <name> -type d");
+     9dc:	59                   	pop    %ecx
+     9dd:	58                   	pop    %eax
+     9de:	68 84 19 00 00       	push   $0x1984
+     9e3:	6a 01                	push   $0x1
+     9e5:	e8 e6 0b 00 00       	call   15d0 <printf>
+	printf(1, "\n\t\tfind <folder> -name <name> -size +<number of bytes>");
+     9ea:	58                   	pop    %eax
+     9eb:	5a                   	pop    %edx
+     9ec:	68 ac 19 00 00       	push   $0x19ac
+     9f1:	6a 01                	push   $0x1
+     9f3:	e8 d8 0b 00 00       	call   15d0 <printf>
+	printf(1, "\n\t\tfind <folder> -name <name> -size -<number of bytes>\n");
+     9f8:	59                   	pop    %ecx
+     9f9:	58                   	pop    %eax
+     9fa:	68 e4 19 00 00       	push   $0x19e4
+     9ff:	6a 01                	push   $0x1
+     a01:	e8 ca 0b 00 00       	call   15d0 <printf>
+    printf(1, "\n\t\tfind <folder> -name <name> -size -<number of bytes> -type <f or d>\n");
+     a06:	58                   	pop    %eax
+     a07:	5a                   	pop    %edx
+     a08:	68 1c 1a 00 00       	push   $0x1a1c
+     a0d:	6a 01                	push   $0x1
+     a0f:	e8 bc 0b 00 00       	call   15d0 <printf>
+	exit();
+     a14:	e8 1a 0a 00 00       	call   1433 <exit>
+     a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <fmtname>:
+char* fmtname(char* folderPath) {
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	56                   	push   %esi
+     a24:	53                   	push   %ebx
+     a25:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=folderPath+strlen(folderPath); p >= folderPath && *p != '/'; p--)
+     a28:	83 ec 0c             	sub    $0xc,%esp
+     a2b:	56                   	push   %esi
+     a2c:	e8 4f 08 00 00       	call   1280 <strlen>
+     a31:	83 c4 10             	add    $0x10,%esp
+     a34:	01 f0                	add    %esi,%eax
+     a36:	89 c3                	mov    %eax,%ebx
+     a38:	73 0f                	jae    a49 <fmtname+0x29>
+     a3a:	eb 12                	jmp    a4e <fmtname+0x2e>
+     a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a40:	8d 43 ff             	lea    -0x1(%ebx),%eax
+     a43:	39 f0                	cmp    %esi,%eax
+     a45:	72 0a                	jb     a51 <fmtname+0x31>
+     a47:	89 c3                	mov    %eax,%ebx
+     a49:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+     a4c:	75 f2                	jne    a40 <fmtname+0x20>
+  p++;
+     a4e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+     a51:	83 ec 0c             	sub    $0xc,%esp
+     a54:	53                   	push   %ebx
+     a55:	e8 26 08 00 00       	call   1280 <strlen>
+     a5a:	83 c4 10             	add    $0x10,%esp
+     a5d:	83 f8 0d             	cmp    $0xd,%eax
+     a60:	77 4a                	ja     aac <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+     a62:	83 ec 0c             	sub    $0xc,%esp
+     a65:	53                   	push   %ebx
+     a66:	e8 15 08 00 00       	call   1280 <strlen>
+     a6b:	83 c4 0c             	add    $0xc,%esp
+     a6e:	50                   	push   %eax
+     a6f:	53                   	push   %ebx
+     a70:	68 f4 1f 00 00       	push   $0x1ff4
+     a75:	e8 86 09 00 00       	call   1400 <memmove>
+  memset(buf+strlen(p), NULLTERMINATOR, DIRSIZ-strlen(p));
+     a7a:	89 1c 24             	mov    %ebx,(%esp)
+     a7d:	e8 fe 07 00 00       	call   1280 <strlen>
+     a82:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+     a85:	bb f4 1f 00 00       	mov    $0x1ff4,%ebx
+  memset(buf+strlen(p), NULLTERMINATOR, DIRSIZ-strlen(p));
+     a8a:	89 c6                	mov    %eax,%esi
+     a8c:	e8 ef 07 00 00       	call   1280 <strlen>
+     a91:	ba 0e 00 00 00       	mov    $0xe,%edx
+     a96:	83 c4 0c             	add    $0xc,%esp
+     a99:	29 f2                	sub    %esi,%edx
+     a9b:	05 f4 1f 00 00       	add    $0x1ff4,%eax
+     aa0:	52                   	push   %edx
+     aa1:	6a 00                	push   $0x0
+     aa3:	50                   	push   %eax
+     aa4:	e8 07 08 00 00       	call   12b0 <memset>
+  return buf;
+     aa9:	83 c4 10             	add    $0x10,%esp
+}
+     aac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     aaf:	89 d8                	mov    %ebx,%eax
+     ab1:	5b                   	pop    %ebx
+     ab2:	5e                   	pop    %esi
+     ab3:	5d                   	pop    %ebp
+     ab4:	c3                   	ret
+     ab5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ac0 <isCurrentOrParentDir>:
+int isCurrentOrParentDir(char* folderPath) {
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	53                   	push   %ebx
+     ac4:	83 ec 10             	sub    $0x10,%esp
+     ac7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if(strcmp(fmtname(folderPath), PARENTDIR) == 0 || strcmp(fmtname(folderPath), CURRENTDIR) == 0) {
+     aca:	53                   	push   %ebx
+     acb:	e8 50 ff ff ff       	call   a20 <fmtname>
+     ad0:	5a                   	pop    %edx
+     ad1:	59                   	pop    %ecx
+     ad2:	68 7a 1b 00 00       	push   $0x1b7a
+     ad7:	50                   	push   %eax
+     ad8:	e8 43 07 00 00       	call   1220 <strcmp>
+     add:	83 c4 10             	add    $0x10,%esp
+     ae0:	89 c2                	mov    %eax,%edx
+     ae2:	b8 01 00 00 00       	mov    $0x1,%eax
+     ae7:	85 d2                	test   %edx,%edx
+     ae9:	74 21                	je     b0c <isCurrentOrParentDir+0x4c>
+     aeb:	83 ec 0c             	sub    $0xc,%esp
+     aee:	53                   	push   %ebx
+     aef:	e8 2c ff ff ff       	call   a20 <fmtname>
+     af4:	5a                   	pop    %edx
+     af5:	59                   	pop    %ecx
+     af6:	68 7b 1b 00 00       	push   $0x1b7b
+     afb:	50                   	push   %eax
+     afc:	e8 1f 07 00 00       	call   1220 <strcmp>
+     b01:	83 c4 10             	add    $0x10,%esp
+     b04:	85 c0                	test   %eax,%eax
+     b06:	0f 94 c0             	sete   %al
+     b09:	0f b6 c0             	movzbl %al,%eax
+}
+     b0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b0f:	c9                   	leave
+     b10:	c3                   	ret
+     b11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1f:	90                   	nop
+
+00000b20 <findOneFlag>:
+void findOneFlag(struct findCommandStruct findCmd, struct stat statObj, char *folderPath, int fileDescriptor, char *buf) { 
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	57                   	push   %edi
+     b24:	56                   	push   %esi
+     b25:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     b28:	53                   	push   %ebx
+     b29:	83 ec 44             	sub    $0x44,%esp
+     b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+     b2f:	8b 9d 00 01 00 00    	mov    0x100(%ebp),%ebx
+     b35:	8b bd fc 00 00 00    	mov    0xfc(%ebp),%edi
+     b3b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     b3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b41:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     b44:	8b 45 10             	mov    0x10(%ebp),%eax
+     b47:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     b4a:	8b 45 14             	mov    0x14(%ebp),%eax
+     b4d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     b50:	8b 45 18             	mov    0x18(%ebp),%eax
+     b53:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  strcpy(buf, folderPath);
+     b56:	ff b5 f8 00 00 00    	push   0xf8(%ebp)
+     b5c:	53                   	push   %ebx
+     b5d:	e8 8e 06 00 00       	call   11f0 <strcpy>
+  p = buf+strlen(buf);
+     b62:	89 1c 24             	mov    %ebx,(%esp)
+     b65:	e8 16 07 00 00       	call   1280 <strlen>
+  while(read(fileDescriptor, &direntObj, sizeof(direntObj)) == sizeof(direntObj)) {
+     b6a:	83 c4 10             	add    $0x10,%esp
+  p = buf+strlen(buf);
+     b6d:	01 d8                	add    %ebx,%eax
+  *p++ = '/';
+     b6f:	8d 50 01             	lea    0x1(%eax),%edx
+  p = buf+strlen(buf);
+     b72:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  *p++ = '/';
+     b75:	89 55 cc             	mov    %edx,-0x34(%ebp)
+     b78:	c6 00 2f             	movb   $0x2f,(%eax)
+  while(read(fileDescriptor, &direntObj, sizeof(direntObj)) == sizeof(direntObj)) {
+     b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b7f:	90                   	nop
+     b80:	83 ec 04             	sub    $0x4,%esp
+     b83:	6a 10                	push   $0x10
+     b85:	56                   	push   %esi
+     b86:	57                   	push   %edi
+     b87:	e8 bf 08 00 00       	call   144b <read>
+     b8c:	83 c4 10             	add    $0x10,%esp
+     b8f:	83 f8 10             	cmp    $0x10,%eax
+     b92:	0f 85 d8 00 00 00    	jne    c70 <findOneFlag+0x150>
+    if(direntObj.inum == 0){
+     b98:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+     b9d:	74 e1                	je     b80 <findOneFlag+0x60>
+    memmove(p, direntObj.name, DIRSIZ);
+     b9f:	83 ec 04             	sub    $0x4,%esp
+     ba2:	8d 45 da             	lea    -0x26(%ebp),%eax
+     ba5:	6a 0e                	push   $0xe
+     ba7:	50                   	push   %eax
+     ba8:	ff 75 cc             	push   -0x34(%ebp)
+     bab:	e8 50 08 00 00       	call   1400 <memmove>
+    p[DIRSIZ] = 0;
+     bb0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     bb3:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+    if (stat(buf, &statObj) < 0) {
+     bb7:	58                   	pop    %eax
+     bb8:	8d 45 28             	lea    0x28(%ebp),%eax
+     bbb:	5a                   	pop    %edx
+     bbc:	50                   	push   %eax
+     bbd:	53                   	push   %ebx
+     bbe:	e8 ad 07 00 00       	call   1370 <stat>
+     bc3:	83 c4 10             	add    $0x10,%esp
+     bc6:	85 c0                	test   %eax,%eax
+     bc8:	0f 88 8a 00 00 00    	js     c58 <findOneFlag+0x138>
+    if (strcmp(findCmd.type, FOLDER) == 0) {
+     bce:	83 ec 08             	sub    $0x8,%esp
+     bd1:	68 7d 1b 00 00       	push   $0x1b7d
+     bd6:	ff 75 d4             	push   -0x2c(%ebp)
+     bd9:	e8 42 06 00 00       	call   1220 <strcmp>
+     bde:	83 c4 10             	add    $0x10,%esp
+     be1:	85 c0                	test   %eax,%eax
+     be3:	0f 85 97 00 00 00    	jne    c80 <findOneFlag+0x160>
+        if(statObj.type == T_FILE) {
+     be9:	66 83 7d 28 02       	cmpw   $0x2,0x28(%ebp)
+     bee:	0f 84 bc 00 00 00    	je     cb0 <findOneFlag+0x190>
+    if (!isCurrentOrParentDir(buf) && statObj.type == T_DIR) {
+     bf4:	83 ec 0c             	sub    $0xc,%esp
+     bf7:	53                   	push   %ebx
+     bf8:	e8 c3 fe ff ff       	call   ac0 <isCurrentOrParentDir>
+     bfd:	83 c4 10             	add    $0x10,%esp
+     c00:	85 c0                	test   %eax,%eax
+     c02:	0f 85 78 ff ff ff    	jne    b80 <findOneFlag+0x60>
+     c08:	66 83 7d 28 01       	cmpw   $0x1,0x28(%ebp)
+     c0d:	0f 85 6d ff ff ff    	jne    b80 <findOneFlag+0x60>
+        nestedDirectoryFound(findCmd, buf);
+     c13:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     c16:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     c19:	83 ec 0c             	sub    $0xc,%esp
+     c1c:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     c1f:	89 45 08             	mov    %eax,0x8(%ebp)
+     c22:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     c25:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+     c28:	89 45 14             	mov    %eax,0x14(%ebp)
+     c2b:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     c2e:	89 55 10             	mov    %edx,0x10(%ebp)
+     c31:	89 45 18             	mov    %eax,0x18(%ebp)
+     c34:	53                   	push   %ebx
+     c35:	ff 75 24             	push   0x24(%ebp)
+     c38:	ff 75 20             	push   0x20(%ebp)
+     c3b:	ff 75 1c             	push   0x1c(%ebp)
+     c3e:	50                   	push   %eax
+     c3f:	ff 75 c0             	push   -0x40(%ebp)
+     c42:	52                   	push   %edx
+     c43:	51                   	push   %ecx
+     c44:	ff 75 c8             	push   -0x38(%ebp)
+     c47:	e8 e4 00 00 00       	call   d30 <nestedDirectoryFound>
+     c4c:	83 c4 30             	add    $0x30,%esp
+     c4f:	e9 2c ff ff ff       	jmp    b80 <findOneFlag+0x60>
+     c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "find failed: Cannot get the status of %s\n", buf);
+     c58:	83 ec 04             	sub    $0x4,%esp
+     c5b:	53                   	push   %ebx
+     c5c:	68 64 1a 00 00       	push   $0x1a64
+     c61:	6a 01                	push   $0x1
+     c63:	e8 68 09 00 00       	call   15d0 <printf>
+      continue;
+     c68:	83 c4 10             	add    $0x10,%esp
+     c6b:	e9 10 ff ff ff       	jmp    b80 <findOneFlag+0x60>
+}
+     c70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c73:	5b                   	pop    %ebx
+     c74:	5e                   	pop    %esi
+     c75:	5f                   	pop    %edi
+     c76:	5d                   	pop    %ebp
+     c77:	c3                   	ret
+     c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+    } else if (strcmp(findCmd.type, DIRECTORY) == 0) {
+     c80:	83 ec 08             	sub    $0x8,%esp
+     c83:	68 83 1b 00 00       	push   $0x1b83
+     c88:	ff 75 d4             	push   -0x2c(%ebp)
+     c8b:	e8 90 05 00 00       	call   1220 <strcmp>
+     c90:	83 c4 10             	add    $0x10,%esp
+     c93:	85 c0                	test   %eax,%eax
+     c95:	74 59                	je     cf0 <findOneFlag+0x1d0>
+    } else if (findCmd.equalSize != -1) {
+     c97:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c9a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     c9d:	74 61                	je     d00 <findOneFlag+0x1e0>
+        if(findCmd.equalSize == statObj.size) {
+     c9f:	3b 45 38             	cmp    0x38(%ebp),%eax
+     ca2:	0f 85 4c ff ff ff    	jne    bf4 <findOneFlag+0xd4>
+     ca8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     caf:	90                   	nop
+            if (strcmp(fmtname(buf), findCmd.fileName) == 0) {
+     cb0:	83 ec 0c             	sub    $0xc,%esp
+     cb3:	53                   	push   %ebx
+     cb4:	e8 67 fd ff ff       	call   a20 <fmtname>
+     cb9:	5a                   	pop    %edx
+     cba:	59                   	pop    %ecx
+     cbb:	ff 75 c8             	push   -0x38(%ebp)
+     cbe:	50                   	push   %eax
+     cbf:	e8 5c 05 00 00       	call   1220 <strcmp>
+     cc4:	83 c4 10             	add    $0x10,%esp
+     cc7:	85 c0                	test   %eax,%eax
+     cc9:	0f 85 25 ff ff ff    	jne    bf4 <findOneFlag+0xd4>
+                printf(1, "%s\n", buf);
+     ccf:	83 ec 04             	sub    $0x4,%esp
+     cd2:	53                   	push   %ebx
+     cd3:	68 7f 1b 00 00       	push   $0x1b7f
+     cd8:	6a 01                	push   $0x1
+     cda:	e8 f1 08 00 00       	call   15d0 <printf>
+     cdf:	83 c4 10             	add    $0x10,%esp
+     ce2:	e9 0d ff ff ff       	jmp    bf4 <findOneFlag+0xd4>
+     ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cee:	66 90                	xchg   %ax,%ax
+        if(statObj.type == T_DIR) {
+     cf0:	66 83 7d 28 01       	cmpw   $0x1,0x28(%ebp)
+     cf5:	0f 85 85 fe ff ff    	jne    b80 <findOneFlag+0x60>
+     cfb:	eb b3                	jmp    cb0 <findOneFlag+0x190>
+     cfd:	8d 76 00             	lea    0x0(%esi),%esi
+    } else if (findCmd.greaterThanSize != -1) {
+     d00:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     d03:	83 f8 ff             	cmp    $0xffffffff,%eax
+     d06:	74 0b                	je     d13 <findOneFlag+0x1f3>
+        if (findCmd.greaterThanSize < statObj.size) {
+     d08:	3b 45 38             	cmp    0x38(%ebp),%eax
+     d0b:	0f 83 e3 fe ff ff    	jae    bf4 <findOneFlag+0xd4>
+     d11:	eb 9d                	jmp    cb0 <findOneFlag+0x190>
+    } else if(findCmd.lessThanSize != -1) {
+     d13:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     d16:	83 f8 ff             	cmp    $0xffffffff,%eax
+     d19:	0f 84 d5 fe ff ff    	je     bf4 <findOneFlag+0xd4>
+        if(findCmd.lessThanSize > statObj.size) {
+     d1f:	39 45 38             	cmp    %eax,0x38(%ebp)
+     d22:	0f 83 cc fe ff ff    	jae    bf4 <findOneFlag+0xd4>
+     d28:	eb 86                	jmp    cb0 <findOneFlag+0x190>
+     d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d30 <nestedDirectoryFound>:
+void nestedDirectoryFound(struct findCommandStruct findCmd, char* newFolderPath){
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	57                   	push   %edi
+     d34:	56                   	push   %esi
+     d35:	53                   	push   %ebx
+     d36:	81 ec e4 00 00 00    	sub    $0xe4,%esp
+     d3c:	8b 7d 28             	mov    0x28(%ebp),%edi
+        if((newFileDescriptor = open(newFolderPath, 0)) < 0) {
+     d3f:	6a 00                	push   $0x0
+     d41:	57                   	push   %edi
+     d42:	e8 2c 07 00 00       	call   1473 <open>
+     d47:	83 c4 10             	add    $0x10,%esp
+     d4a:	85 c0                	test   %eax,%eax
+     d4c:	78 52                	js     da0 <nestedDirectoryFound+0x70>
+        if(fstat(newFileDescriptor, &newStatObj) < 0) {
+     d4e:	83 ec 08             	sub    $0x8,%esp
+     d51:	8d b5 18 ff ff ff    	lea    -0xe8(%ebp),%esi
+     d57:	89 c3                	mov    %eax,%ebx
+     d59:	56                   	push   %esi
+     d5a:	50                   	push   %eax
+     d5b:	e8 2b 07 00 00       	call   148b <fstat>
+     d60:	83 c4 10             	add    $0x10,%esp
+     d63:	85 c0                	test   %eax,%eax
+     d65:	0f 88 95 00 00 00    	js     e00 <nestedDirectoryFound+0xd0>
+        if (findCmd.noFlags == TRUE) {
+     d6b:	83 7d 1c 01          	cmpl   $0x1,0x1c(%ebp)
+     d6f:	74 4f                	je     dc0 <nestedDirectoryFound+0x90>
+        } else if (findCmd.oneFlag == TRUE) {
+     d71:	83 7d 20 01          	cmpl   $0x1,0x20(%ebp)
+     d75:	0f 84 ad 00 00 00    	je     e28 <nestedDirectoryFound+0xf8>
+        } else if (findCmd.bothFlags == TRUE) {
+     d7b:	83 7d 24 01          	cmpl   $0x1,0x24(%ebp)
+     d7f:	0f 84 e3 00 00 00    	je     e68 <nestedDirectoryFound+0x138>
+        close(newFileDescriptor);
+     d85:	83 ec 0c             	sub    $0xc,%esp
+     d88:	53                   	push   %ebx
+     d89:	e8 cd 06 00 00       	call   145b <close>
+     d8e:	83 c4 10             	add    $0x10,%esp
+} 
+     d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d94:	5b                   	pop    %ebx
+     d95:	5e                   	pop    %esi
+     d96:	5f                   	pop    %edi
+     d97:	5d                   	pop    %ebp
+     d98:	c3                   	ret
+     d99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+            printf(2, "find failed: Cannot open folder: %s, or folder does not exist.\n", newFolderPath);
+     da0:	89 7d 10             	mov    %edi,0x10(%ebp)
+     da3:	c7 45 0c 90 1a 00 00 	movl   $0x1a90,0xc(%ebp)
+     daa:	c7 45 08 02 00 00 00 	movl   $0x2,0x8(%ebp)
+} 
+     db1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     db4:	5b                   	pop    %ebx
+     db5:	5e                   	pop    %esi
+     db6:	5f                   	pop    %edi
+     db7:	5d                   	pop    %ebp
+            printf(2, "find failed: Cannot open folder: %s, or folder does not exist.\n", newFolderPath);
+     db8:	e9 13 08 00 00       	jmp    15d0 <printf>
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+            findNoFlags(findCmd, newStatObj, newFolderPath, newFileDescriptor, newFolderPath);
+     dc0:	83 ec 04             	sub    $0x4,%esp
+     dc3:	b9 34 00 00 00       	mov    $0x34,%ecx
+     dc8:	57                   	push   %edi
+     dc9:	53                   	push   %ebx
+     dca:	57                   	push   %edi
+     dcb:	81 ec d0 00 00 00    	sub    $0xd0,%esp
+     dd1:	89 e7                	mov    %esp,%edi
+     dd3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     dd5:	ff 75 24             	push   0x24(%ebp)
+     dd8:	ff 75 20             	push   0x20(%ebp)
+     ddb:	6a 01                	push   $0x1
+     ddd:	ff 75 18             	push   0x18(%ebp)
+     de0:	ff 75 14             	push   0x14(%ebp)
+     de3:	ff 75 10             	push   0x10(%ebp)
+     de6:	ff 75 0c             	push   0xc(%ebp)
+     de9:	ff 75 08             	push   0x8(%ebp)
+     dec:	e8 bf 02 00 00       	call   10b0 <findNoFlags>
+     df1:	81 c4 00 01 00 00    	add    $0x100,%esp
+     df7:	eb 8c                	jmp    d85 <nestedDirectoryFound+0x55>
+     df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+                printf(2, "find failed: Cannot get status information about: %s\n", newFolderPath);
+     e00:	83 ec 04             	sub    $0x4,%esp
+     e03:	57                   	push   %edi
+     e04:	68 d0 1a 00 00       	push   $0x1ad0
+     e09:	6a 02                	push   $0x2
+     e0b:	e8 c0 07 00 00       	call   15d0 <printf>
+                close(newFileDescriptor);
+     e10:	89 1c 24             	mov    %ebx,(%esp)
+     e13:	e8 43 06 00 00       	call   145b <close>
+                return;
+     e18:	83 c4 10             	add    $0x10,%esp
+} 
+     e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e1e:	5b                   	pop    %ebx
+     e1f:	5e                   	pop    %esi
+     e20:	5f                   	pop    %edi
+     e21:	5d                   	pop    %ebp
+     e22:	c3                   	ret
+     e23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e27:	90                   	nop
+            findOneFlag(findCmd, newStatObj, newFolderPath, newFileDescriptor, newFolderPath);
+     e28:	83 ec 04             	sub    $0x4,%esp
+     e2b:	b9 34 00 00 00       	mov    $0x34,%ecx
+     e30:	57                   	push   %edi
+     e31:	53                   	push   %ebx
+     e32:	57                   	push   %edi
+     e33:	81 ec d0 00 00 00    	sub    $0xd0,%esp
+     e39:	89 e7                	mov    %esp,%edi
+     e3b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     e3d:	ff 75 24             	push   0x24(%ebp)
+     e40:	6a 01                	push   $0x1
+     e42:	ff 75 1c             	push   0x1c(%ebp)
+     e45:	ff 75 18             	push   0x18(%ebp)
+     e48:	ff 75 14             	push   0x14(%ebp)
+     e4b:	ff 75 10             	push   0x10(%ebp)
+     e4e:	ff 75 0c             	push   0xc(%ebp)
+     e51:	ff 75 08             	push   0x8(%ebp)
+     e54:	e8 c7 fc ff ff       	call   b20 <findOneFlag>
+     e59:	81 c4 00 01 00 00    	add    $0x100,%esp
+     e5f:	e9 21 ff ff ff       	jmp    d85 <nestedDirectoryFound+0x55>
+     e64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+            findBothFlags(findCmd, newStatObj, newFolderPath, newFileDescriptor, newFolderPath);
+     e68:	83 ec 04             	sub    $0x4,%esp
+     e6b:	b9 34 00 00 00       	mov    $0x34,%ecx
+     e70:	57                   	push   %edi
+     e71:	53                   	push   %ebx
+     e72:	57                   	push   %edi
+     e73:	81 ec d0 00 00 00    	sub    $0xd0,%esp
+     e79:	89 e7                	mov    %esp,%edi
+     e7b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     e7d:	6a 01                	push   $0x1
+     e7f:	ff 75 20             	push   0x20(%ebp)
+     e82:	ff 75 1c             	push   0x1c(%ebp)
+     e85:	ff 75 18             	push   0x18(%ebp)
+     e88:	ff 75 14             	push   0x14(%ebp)
+     e8b:	ff 75 10             	push   0x10(%ebp)
+     e8e:	ff 75 0c             	push   0xc(%ebp)
+     e91:	ff 75 08             	push   0x8(%ebp)
+     e94:	e8 17 00 00 00       	call   eb0 <findBothFlags>
+     e99:	81 c4 00 01 00 00    	add    $0x100,%esp
+     e9f:	e9 e1 fe ff ff       	jmp    d85 <nestedDirectoryFound+0x55>
+     ea4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eaf:	90                   	nop
+
+00000eb0 <findBothFlags>:
+void findBothFlags(struct findCommandStruct findCmd, struct stat statObj, char *folderPath, int fileDescriptor, char *buf) { 
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	57                   	push   %edi
+     eb4:	56                   	push   %esi
+     eb5:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     eb8:	53                   	push   %ebx
+     eb9:	83 ec 44             	sub    $0x44,%esp
+     ebc:	8b 45 08             	mov    0x8(%ebp),%eax
+     ebf:	8b 9d 00 01 00 00    	mov    0x100(%ebp),%ebx
+     ec5:	8b bd fc 00 00 00    	mov    0xfc(%ebp),%edi
+     ecb:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     ece:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ed1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     ed4:	8b 45 10             	mov    0x10(%ebp),%eax
+     ed7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     eda:	8b 45 14             	mov    0x14(%ebp),%eax
+     edd:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     ee0:	8b 45 18             	mov    0x18(%ebp),%eax
+     ee3:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  strcpy(buf, folderPath);
+     ee6:	ff b5 f8 00 00 00    	push   0xf8(%ebp)
+     eec:	53                   	push   %ebx
+     eed:	e8 fe 02 00 00       	call   11f0 <strcpy>
+  p = buf+strlen(buf);
+     ef2:	89 1c 24             	mov    %ebx,(%esp)
+     ef5:	e8 86 03 00 00       	call   1280 <strlen>
+  while (read(fileDescriptor, &direntObj, sizeof(direntObj)) == sizeof(direntObj)) {
+     efa:	83 c4 10             	add    $0x10,%esp
+  p = buf+strlen(buf);
+     efd:	01 d8                	add    %ebx,%eax
+  *p++ = '/';
+     eff:	8d 50 01             	lea    0x1(%eax),%edx
+  p = buf+strlen(buf);
+     f02:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  *p++ = '/';
+     f05:	89 55 cc             	mov    %edx,-0x34(%ebp)
+     f08:	c6 00 2f             	movb   $0x2f,(%eax)
+  while (read(fileDescriptor, &direntObj, sizeof(direntObj)) == sizeof(direntObj)) {
+     f0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+     f10:	83 ec 04             	sub    $0x4,%esp
+     f13:	6a 10                	push   $0x10
+     f15:	56                   	push   %esi
+     f16:	57                   	push   %edi
+     f17:	e8 2f 05 00 00       	call   144b <read>
+     f1c:	83 c4 10             	add    $0x10,%esp
+     f1f:	83 f8 10             	cmp    $0x10,%eax
+     f22:	0f 85 d8 00 00 00    	jne    1000 <findBothFlags+0x150>
+    if(direntObj.inum == 0){
+     f28:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+     f2d:	74 e1                	je     f10 <findBothFlags+0x60>
+    memmove(p, direntObj.name, DIRSIZ);
+     f2f:	83 ec 04             	sub    $0x4,%esp
+     f32:	8d 45 da             	lea    -0x26(%ebp),%eax
+     f35:	6a 0e                	push   $0xe
+     f37:	50                   	push   %eax
+     f38:	ff 75 cc             	push   -0x34(%ebp)
+     f3b:	e8 c0 04 00 00       	call   1400 <memmove>
+    p[DIRSIZ] = 0;
+     f40:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     f43:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+    if(stat(buf, &statObj) < 0){
+     f47:	58                   	pop    %eax
+     f48:	8d 45 28             	lea    0x28(%ebp),%eax
+     f4b:	5a                   	pop    %edx
+     f4c:	50                   	push   %eax
+     f4d:	53                   	push   %ebx
+     f4e:	e8 1d 04 00 00       	call   1370 <stat>
+     f53:	83 c4 10             	add    $0x10,%esp
+     f56:	85 c0                	test   %eax,%eax
+     f58:	0f 88 8a 00 00 00    	js     fe8 <findBothFlags+0x138>
+    if(strcmp(findCmd.type, FOLDER) == 0){
+     f5e:	83 ec 08             	sub    $0x8,%esp
+     f61:	68 7d 1b 00 00       	push   $0x1b7d
+     f66:	ff 75 d4             	push   -0x2c(%ebp)
+     f69:	e8 b2 02 00 00       	call   1220 <strcmp>
+     f6e:	83 c4 10             	add    $0x10,%esp
+     f71:	85 c0                	test   %eax,%eax
+     f73:	0f 85 97 00 00 00    	jne    1010 <findBothFlags+0x160>
+        if(statObj.type == T_FILE) {
+     f79:	66 83 7d 28 02       	cmpw   $0x2,0x28(%ebp)
+     f7e:	0f 84 b2 00 00 00    	je     1036 <findBothFlags+0x186>
+    if (!isCurrentOrParentDir(buf) && statObj.type == T_DIR) {
+     f84:	83 ec 0c             	sub    $0xc,%esp
+     f87:	53                   	push   %ebx
+     f88:	e8 33 fb ff ff       	call   ac0 <isCurrentOrParentDir>
+     f8d:	83 c4 10             	add    $0x10,%esp
+     f90:	85 c0                	test   %eax,%eax
+     f92:	0f 85 78 ff ff ff    	jne    f10 <findBothFlags+0x60>
+     f98:	66 83 7d 28 01       	cmpw   $0x1,0x28(%ebp)
+     f9d:	0f 85 6d ff ff ff    	jne    f10 <findBothFlags+0x60>
+        nestedDirectoryFound(findCmd, buf);
+     fa3:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     fa6:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     fa9:	83 ec 0c             	sub    $0xc,%esp
+     fac:	8b 55 c8             	mov    -0x38(%ebp),%edx
+     faf:	89 45 08             	mov    %eax,0x8(%ebp)
+     fb2:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     fb5:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+     fb8:	89 45 14             	mov    %eax,0x14(%ebp)
+     fbb:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     fbe:	89 55 10             	mov    %edx,0x10(%ebp)
+     fc1:	89 45 18             	mov    %eax,0x18(%ebp)
+     fc4:	53                   	push   %ebx
+     fc5:	ff 75 24             	push   0x24(%ebp)
+     fc8:	ff 75 20             	push   0x20(%ebp)
+     fcb:	ff 75 1c             	push   0x1c(%ebp)
+     fce:	50                   	push   %eax
+     fcf:	ff 75 c4             	push   -0x3c(%ebp)
+     fd2:	52                   	push   %edx
+     fd3:	51                   	push   %ecx
+     fd4:	ff 75 c0             	push   -0x40(%ebp)
+     fd7:	e8 54 fd ff ff       	call   d30 <nestedDirectoryFound>
+     fdc:	83 c4 30             	add    $0x30,%esp
+     fdf:	e9 2c ff ff ff       	jmp    f10 <findBothFlags+0x60>
+     fe4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "find failed: Cannot get the status of %s\n", buf);
+     fe8:	83 ec 04             	sub    $0x4,%esp
+     feb:	53                   	push   %ebx
+     fec:	68 64 1a 00 00       	push   $0x1a64
+     ff1:	6a 01                	push   $0x1
+     ff3:	e8 d8 05 00 00       	call   15d0 <printf>
+      continue;
+     ff8:	83 c4 10             	add    $0x10,%esp
+     ffb:	e9 10 ff ff ff       	jmp    f10 <findBothFlags+0x60>
+}
+    1000:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1003:	5b                   	pop    %ebx
+    1004:	5e                   	pop    %esi
+    1005:	5f                   	pop    %edi
+    1006:	5d                   	pop    %ebp
+    1007:	c3                   	ret
+    1008:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+    } else if(strcmp(findCmd.type, DIRECTORY) == 0) {
+    1010:	83 ec 08             	sub    $0x8,%esp
+    1013:	68 83 1b 00 00       	push   $0x1b83
+    1018:	ff 75 d4             	push   -0x2c(%ebp)
+    101b:	e8 00 02 00 00       	call   1220 <strcmp>
+    1020:	83 c4 10             	add    $0x10,%esp
+    1023:	85 c0                	test   %eax,%eax
+    1025:	0f 85 59 ff ff ff    	jne    f84 <findBothFlags+0xd4>
+        if(statObj.type == T_DIR) {
+    102b:	66 83 7d 28 01       	cmpw   $0x1,0x28(%ebp)
+    1030:	0f 85 da fe ff ff    	jne    f10 <findBothFlags+0x60>
+            if(findCmd.equalSize != -1){
+    1036:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    1039:	83 f8 ff             	cmp    $0xffffffff,%eax
+    103c:	74 42                	je     1080 <findBothFlags+0x1d0>
+                if(findCmd.equalSize == statObj.size) {
+    103e:	3b 45 38             	cmp    0x38(%ebp),%eax
+    1041:	0f 85 3d ff ff ff    	jne    f84 <findBothFlags+0xd4>
+                    if (strcmp(fmtname(buf), findCmd.fileName) == 0) {
+    1047:	83 ec 0c             	sub    $0xc,%esp
+    104a:	53                   	push   %ebx
+    104b:	e8 d0 f9 ff ff       	call   a20 <fmtname>
+    1050:	5a                   	pop    %edx
+    1051:	59                   	pop    %ecx
+    1052:	ff 75 c0             	push   -0x40(%ebp)
+    1055:	50                   	push   %eax
+    1056:	e8 c5 01 00 00       	call   1220 <strcmp>
+    105b:	83 c4 10             	add    $0x10,%esp
+    105e:	85 c0                	test   %eax,%eax
+    1060:	0f 85 1e ff ff ff    	jne    f84 <findBothFlags+0xd4>
+                            printf(1, "%s\n", buf);
+    1066:	83 ec 04             	sub    $0x4,%esp
+    1069:	53                   	push   %ebx
+    106a:	68 7f 1b 00 00       	push   $0x1b7f
+    106f:	6a 01                	push   $0x1
+    1071:	e8 5a 05 00 00       	call   15d0 <printf>
+    1076:	83 c4 10             	add    $0x10,%esp
+    1079:	e9 06 ff ff ff       	jmp    f84 <findBothFlags+0xd4>
+    107e:	66 90                	xchg   %ax,%ax
+            } else if(findCmd.greaterThanSize != -1){
+    1080:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1083:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1086:	74 10                	je     1098 <findBothFlags+0x1e8>
+                if(findCmd.greaterThanSize < statObj.size) {
+    1088:	3b 45 38             	cmp    0x38(%ebp),%eax
+    108b:	0f 83 f3 fe ff ff    	jae    f84 <findBothFlags+0xd4>
+    1091:	eb b4                	jmp    1047 <findBothFlags+0x197>
+    1093:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1097:	90                   	nop
+            } else if(findCmd.lessThanSize != -1) {
+    1098:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    109b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    109e:	0f 84 e0 fe ff ff    	je     f84 <findBothFlags+0xd4>
+                if(findCmd.lessThanSize > statObj.size) {
+    10a4:	39 45 38             	cmp    %eax,0x38(%ebp)
+    10a7:	0f 83 d7 fe ff ff    	jae    f84 <findBothFlags+0xd4>
+    10ad:	eb 98                	jmp    1047 <findBothFlags+0x197>
+    10af:	90                   	nop
+
+000010b0 <findNoFlags>:
+void findNoFlags(struct findCommandStruct findCmd, struct stat statObj, char *folderPath, int fileDescriptor, char *buf) { 
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	57                   	push   %edi
+    10b4:	56                   	push   %esi
+    10b5:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    10b8:	53                   	push   %ebx
+    10b9:	83 ec 34             	sub    $0x34,%esp
+    10bc:	8b 9d 00 01 00 00    	mov    0x100(%ebp),%ebx
+    10c2:	8b bd fc 00 00 00    	mov    0xfc(%ebp),%edi
+  strcpy(buf, folderPath);
+    10c8:	ff b5 f8 00 00 00    	push   0xf8(%ebp)
+    10ce:	53                   	push   %ebx
+    10cf:	e8 1c 01 00 00       	call   11f0 <strcpy>
+  p = buf+strlen(buf);
+    10d4:	89 1c 24             	mov    %ebx,(%esp)
+    10d7:	e8 a4 01 00 00       	call   1280 <strlen>
+  while (read(fileDescriptor, &direntObj, sizeof(direntObj)) == sizeof(direntObj)) {
+    10dc:	83 c4 10             	add    $0x10,%esp
+  p = buf+strlen(buf);
+    10df:	01 d8                	add    %ebx,%eax
+  *p++ = '/';
+    10e1:	8d 48 01             	lea    0x1(%eax),%ecx
+  p = buf+strlen(buf);
+    10e4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  *p++ = '/';
+    10e7:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+    10ea:	c6 00 2f             	movb   $0x2f,(%eax)
+  while (read(fileDescriptor, &direntObj, sizeof(direntObj)) == sizeof(direntObj)) {
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+    10f0:	83 ec 04             	sub    $0x4,%esp
+    10f3:	6a 10                	push   $0x10
+    10f5:	56                   	push   %esi
+    10f6:	57                   	push   %edi
+    10f7:	e8 4f 03 00 00       	call   144b <read>
+    10fc:	83 c4 10             	add    $0x10,%esp
+    10ff:	83 f8 10             	cmp    $0x10,%eax
+    1102:	0f 85 b8 00 00 00    	jne    11c0 <findNoFlags+0x110>
+    if (direntObj.inum == 0 ) {
+    1108:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+    110d:	74 e1                	je     10f0 <findNoFlags+0x40>
+    memmove(p, direntObj.name, DIRSIZ);
+    110f:	83 ec 04             	sub    $0x4,%esp
+    1112:	8d 45 da             	lea    -0x26(%ebp),%eax
+    1115:	6a 0e                	push   $0xe
+    1117:	50                   	push   %eax
+    1118:	ff 75 cc             	push   -0x34(%ebp)
+    111b:	e8 e0 02 00 00       	call   1400 <memmove>
+    p[DIRSIZ] = 0;
+    1120:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1123:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+    if (stat(buf, &statObj) < 0) {
+    1127:	58                   	pop    %eax
+    1128:	8d 45 28             	lea    0x28(%ebp),%eax
+    112b:	5a                   	pop    %edx
+    112c:	50                   	push   %eax
+    112d:	53                   	push   %ebx
+    112e:	e8 3d 02 00 00       	call   1370 <stat>
+    1133:	83 c4 10             	add    $0x10,%esp
+    1136:	85 c0                	test   %eax,%eax
+    1138:	78 66                	js     11a0 <findNoFlags+0xf0>
+    if (strcmp(fmtname(buf), findCmd.fileName) == 0) {
+    113a:	8b 55 08             	mov    0x8(%ebp),%edx
+    113d:	83 ec 0c             	sub    $0xc,%esp
+    1140:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1143:	53                   	push   %ebx
+    1144:	e8 d7 f8 ff ff       	call   a20 <fmtname>
+    1149:	5a                   	pop    %edx
+    114a:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    114d:	59                   	pop    %ecx
+    114e:	52                   	push   %edx
+    114f:	50                   	push   %eax
+    1150:	e8 cb 00 00 00       	call   1220 <strcmp>
+    1155:	83 c4 10             	add    $0x10,%esp
+    1158:	85 c0                	test   %eax,%eax
+    115a:	74 74                	je     11d0 <findNoFlags+0x120>
+    if (!isCurrentOrParentDir(buf) && statObj.type == T_DIR) {
+    115c:	83 ec 0c             	sub    $0xc,%esp
+    115f:	53                   	push   %ebx
+    1160:	e8 5b f9 ff ff       	call   ac0 <isCurrentOrParentDir>
+    1165:	83 c4 10             	add    $0x10,%esp
+    1168:	85 c0                	test   %eax,%eax
+    116a:	75 84                	jne    10f0 <findNoFlags+0x40>
+    116c:	66 83 7d 28 01       	cmpw   $0x1,0x28(%ebp)
+    1171:	0f 85 79 ff ff ff    	jne    10f0 <findNoFlags+0x40>
+        nestedDirectoryFound(findCmd, buf);
+    1177:	83 ec 0c             	sub    $0xc,%esp
+    117a:	53                   	push   %ebx
+    117b:	ff 75 24             	push   0x24(%ebp)
+    117e:	ff 75 20             	push   0x20(%ebp)
+    1181:	ff 75 1c             	push   0x1c(%ebp)
+    1184:	ff 75 18             	push   0x18(%ebp)
+    1187:	ff 75 14             	push   0x14(%ebp)
+    118a:	ff 75 10             	push   0x10(%ebp)
+    118d:	ff 75 0c             	push   0xc(%ebp)
+    1190:	ff 75 08             	push   0x8(%ebp)
+    1193:	e8 98 fb ff ff       	call   d30 <nestedDirectoryFound>
+    1198:	83 c4 30             	add    $0x30,%esp
+    119b:	e9 50 ff ff ff       	jmp    10f0 <findNoFlags+0x40>
+      printf(2, "find failed: Cannot get the status of %s\n", buf);
+    11a0:	83 ec 04             	sub    $0x4,%esp
+    11a3:	53                   	push   %ebx
+    11a4:	68 64 1a 00 00       	push   $0x1a64
+    11a9:	6a 02                	push   $0x2
+    11ab:	e8 20 04 00 00       	call   15d0 <printf>
+      continue;
+    11b0:	83 c4 10             	add    $0x10,%esp
+    11b3:	e9 38 ff ff ff       	jmp    10f0 <findNoFlags+0x40>
+    11b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11bf:	90                   	nop
+}
+    11c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11c3:	5b                   	pop    %ebx
+    11c4:	5e                   	pop    %esi
+    11c5:	5f                   	pop    %edi
+    11c6:	5d                   	pop    %ebp
+    11c7:	c3                   	ret
+    11c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cf:	90                   	nop
+        printf(1, "%s\n", buf);
+    11d0:	83 ec 04             	sub    $0x4,%esp
+    11d3:	53                   	push   %ebx
+    11d4:	68 7f 1b 00 00       	push   $0x1b7f
+    11d9:	6a 01                	push   $0x1
+    11db:	e8 f0 03 00 00       	call   15d0 <printf>
+    11e0:	83 c4 10             	add    $0x10,%esp
+    11e3:	e9 74 ff ff ff       	jmp    115c <findNoFlags+0xac>
+    11e8:	66 90                	xchg   %ax,%ax
+    11ea:	66 90                	xchg   %ax,%ax
+    11ec:	66 90                	xchg   %ax,%ax
+    11ee:	66 90                	xchg   %ax,%ax
+
+000011f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    11f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    11f1:	31 c0                	xor    %eax,%eax
+{
+    11f3:	89 e5                	mov    %esp,%ebp
+    11f5:	53                   	push   %ebx
+    11f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    11f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1207:	83 c0 01             	add    $0x1,%eax
+    120a:	84 d2                	test   %dl,%dl
+    120c:	75 f2                	jne    1200 <strcpy+0x10>
+    ;
+  return os;
+}
+    120e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1211:	89 c8                	mov    %ecx,%eax
+    1213:	c9                   	leave
+    1214:	c3                   	ret
+    1215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	53                   	push   %ebx
+    1224:	8b 55 08             	mov    0x8(%ebp),%edx
+    1227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    122a:	0f b6 02             	movzbl (%edx),%eax
+    122d:	84 c0                	test   %al,%al
+    122f:	75 17                	jne    1248 <strcmp+0x28>
+    1231:	eb 3a                	jmp    126d <strcmp+0x4d>
+    1233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1237:	90                   	nop
+    1238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    123c:	83 c2 01             	add    $0x1,%edx
+    123f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1242:	84 c0                	test   %al,%al
+    1244:	74 1a                	je     1260 <strcmp+0x40>
+    p++, q++;
+    1246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1248:	0f b6 19             	movzbl (%ecx),%ebx
+    124b:	38 c3                	cmp    %al,%bl
+    124d:	74 e9                	je     1238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    124f:	29 d8                	sub    %ebx,%eax
+}
+    1251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1254:	c9                   	leave
+    1255:	c3                   	ret
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1264:	31 c0                	xor    %eax,%eax
+    1266:	29 d8                	sub    %ebx,%eax
+}
+    1268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    126b:	c9                   	leave
+    126c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    126d:	0f b6 19             	movzbl (%ecx),%ebx
+    1270:	31 c0                	xor    %eax,%eax
+    1272:	eb db                	jmp    124f <strcmp+0x2f>
+    1274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    127b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    127f:	90                   	nop
+
+00001280 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1286:	80 3a 00             	cmpb   $0x0,(%edx)
+    1289:	74 15                	je     12a0 <strlen+0x20>
+    128b:	31 c0                	xor    %eax,%eax
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+    1290:	83 c0 01             	add    $0x1,%eax
+    1293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1297:	89 c1                	mov    %eax,%ecx
+    1299:	75 f5                	jne    1290 <strlen+0x10>
+    ;
+  return n;
+}
+    129b:	89 c8                	mov    %ecx,%eax
+    129d:	5d                   	pop    %ebp
+    129e:	c3                   	ret
+    129f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    12a0:	31 c9                	xor    %ecx,%ecx
+}
+    12a2:	5d                   	pop    %ebp
+    12a3:	89 c8                	mov    %ecx,%eax
+    12a5:	c3                   	ret
+    12a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	57                   	push   %edi
+    12b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    12b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    12ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12bd:	89 d7                	mov    %edx,%edi
+    12bf:	fc                   	cld
+    12c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    12c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    12c5:	89 d0                	mov    %edx,%eax
+    12c7:	c9                   	leave
+    12c8:	c3                   	ret
+    12c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    12da:	0f b6 10             	movzbl (%eax),%edx
+    12dd:	84 d2                	test   %dl,%dl
+    12df:	75 12                	jne    12f3 <strchr+0x23>
+    12e1:	eb 1d                	jmp    1300 <strchr+0x30>
+    12e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12e7:	90                   	nop
+    12e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    12ec:	83 c0 01             	add    $0x1,%eax
+    12ef:	84 d2                	test   %dl,%dl
+    12f1:	74 0d                	je     1300 <strchr+0x30>
+    if(*s == c)
+    12f3:	38 d1                	cmp    %dl,%cl
+    12f5:	75 f1                	jne    12e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    12f7:	5d                   	pop    %ebp
+    12f8:	c3                   	ret
+    12f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1300:	31 c0                	xor    %eax,%eax
+}
+    1302:	5d                   	pop    %ebp
+    1303:	c3                   	ret
+    1304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    130f:	90                   	nop
+
+00001310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	57                   	push   %edi
+    1314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1319:	31 db                	xor    %ebx,%ebx
+{
+    131b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    131e:	eb 27                	jmp    1347 <gets+0x37>
+    cc = read(0, &c, 1);
+    1320:	83 ec 04             	sub    $0x4,%esp
+    1323:	6a 01                	push   $0x1
+    1325:	56                   	push   %esi
+    1326:	6a 00                	push   $0x0
+    1328:	e8 1e 01 00 00       	call   144b <read>
+    if(cc < 1)
+    132d:	83 c4 10             	add    $0x10,%esp
+    1330:	85 c0                	test   %eax,%eax
+    1332:	7e 1d                	jle    1351 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1338:	8b 55 08             	mov    0x8(%ebp),%edx
+    133b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    133f:	3c 0a                	cmp    $0xa,%al
+    1341:	74 10                	je     1353 <gets+0x43>
+    1343:	3c 0d                	cmp    $0xd,%al
+    1345:	74 0c                	je     1353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1347:	89 df                	mov    %ebx,%edi
+    1349:	83 c3 01             	add    $0x1,%ebx
+    134c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    134f:	7c cf                	jl     1320 <gets+0x10>
+    1351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1353:	8b 45 08             	mov    0x8(%ebp),%eax
+    1356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    135a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    135d:	5b                   	pop    %ebx
+    135e:	5e                   	pop    %esi
+    135f:	5f                   	pop    %edi
+    1360:	5d                   	pop    %ebp
+    1361:	c3                   	ret
+    1362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001370 <stat>:
+
+int stat(const char *n, struct stat *st)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	56                   	push   %esi
+    1374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1375:	83 ec 08             	sub    $0x8,%esp
+    1378:	6a 00                	push   $0x0
+    137a:	ff 75 08             	push   0x8(%ebp)
+    137d:	e8 f1 00 00 00       	call   1473 <open>
+  if(fd < 0)
+    1382:	83 c4 10             	add    $0x10,%esp
+    1385:	85 c0                	test   %eax,%eax
+    1387:	78 27                	js     13b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1389:	83 ec 08             	sub    $0x8,%esp
+    138c:	ff 75 0c             	push   0xc(%ebp)
+    138f:	89 c3                	mov    %eax,%ebx
+    1391:	50                   	push   %eax
+    1392:	e8 f4 00 00 00       	call   148b <fstat>
+  close(fd);
+    1397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    139a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    139c:	e8 ba 00 00 00       	call   145b <close>
+  return r;
+    13a1:	83 c4 10             	add    $0x10,%esp
+}
+    13a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13a7:	89 f0                	mov    %esi,%eax
+    13a9:	5b                   	pop    %ebx
+    13aa:	5e                   	pop    %esi
+    13ab:	5d                   	pop    %ebp
+    13ac:	c3                   	ret
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    13b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    13b5:	eb ed                	jmp    13a4 <stat+0x34>
+    13b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13be:	66 90                	xchg   %ax,%ax
+
+000013c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	53                   	push   %ebx
+    13c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    13c7:	0f be 02             	movsbl (%edx),%eax
+    13ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    13cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    13d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    13d5:	77 1e                	ja     13f5 <atoi+0x35>
+    13d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    13e0:	83 c2 01             	add    $0x1,%edx
+    13e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    13e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    13ea:	0f be 02             	movsbl (%edx),%eax
+    13ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    13f0:	80 fb 09             	cmp    $0x9,%bl
+    13f3:	76 eb                	jbe    13e0 <atoi+0x20>
+  return n;
+}
+    13f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13f8:	89 c8                	mov    %ecx,%eax
+    13fa:	c9                   	leave
+    13fb:	c3                   	ret
+    13fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001400 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	57                   	push   %edi
+    1404:	56                   	push   %esi
+    1405:	8b 45 10             	mov    0x10(%ebp),%eax
+    1408:	8b 55 08             	mov    0x8(%ebp),%edx
+    140b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    140e:	85 c0                	test   %eax,%eax
+    1410:	7e 13                	jle    1425 <memmove+0x25>
+    1412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1414:	89 d7                	mov    %edx,%edi
+    1416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1421:	39 f8                	cmp    %edi,%eax
+    1423:	75 fb                	jne    1420 <memmove+0x20>
+  return vdst;
+}
+    1425:	5e                   	pop    %esi
+    1426:	89 d0                	mov    %edx,%eax
+    1428:	5f                   	pop    %edi
+    1429:	5d                   	pop    %ebp
+    142a:	c3                   	ret
+
+0000142b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    142b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <exit>:
+SYSCALL(exit)
+    1433:	b8 02 00 00 00       	mov    $0x2,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <wait>:
+SYSCALL(wait)
+    143b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <pipe>:
+SYSCALL(pipe)
+    1443:	b8 04 00 00 00       	mov    $0x4,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <read>:
+SYSCALL(read)
+    144b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <write>:
+SYSCALL(write)
+    1453:	b8 10 00 00 00       	mov    $0x10,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <close>:
+SYSCALL(close)
+    145b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <kill>:
+SYSCALL(kill)
+    1463:	b8 06 00 00 00       	mov    $0x6,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <exec>:
+SYSCALL(exec)
+    146b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <open>:
+SYSCALL(open)
+    1473:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <mknod>:
+SYSCALL(mknod)
+    147b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <unlink>:
+SYSCALL(unlink)
+    1483:	b8 12 00 00 00       	mov    $0x12,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <fstat>:
+SYSCALL(fstat)
+    148b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <link>:
+SYSCALL(link)
+    1493:	b8 13 00 00 00       	mov    $0x13,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+
+0000149b <mkdir>:
+SYSCALL(mkdir)
+    149b:	b8 14 00 00 00       	mov    $0x14,%eax
+    14a0:	cd 40                	int    $0x40
+    14a2:	c3                   	ret
+
+000014a3 <chdir>:
+SYSCALL(chdir)
+    14a3:	b8 09 00 00 00       	mov    $0x9,%eax
+    14a8:	cd 40                	int    $0x40
+    14aa:	c3                   	ret
+
+000014ab <dup>:
+SYSCALL(dup)
+    14ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+    14b0:	cd 40                	int    $0x40
+    14b2:	c3                   	ret
+
+000014b3 <getpid>:
+SYSCALL(getpid)
+    14b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    14b8:	cd 40                	int    $0x40
+    14ba:	c3                   	ret
+
+000014bb <sbrk>:
+SYSCALL(sbrk)
+    14bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14c0:	cd 40                	int    $0x40
+    14c2:	c3                   	ret
+
+000014c3 <sleep>:
+SYSCALL(sleep)
+    14c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14c8:	cd 40                	int    $0x40
+    14ca:	c3                   	ret
+
+000014cb <uptime>:
+SYSCALL(uptime)
+    14cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <time_scheduled>:
+SYSCALL(time_scheduled)
+    14d3:	b8 16 00 00 00       	mov    $0x16,%eax
+    14d8:	cd 40                	int    $0x40
+    14da:	c3                   	ret
+
+000014db <set_sched_priority>:
+SYSCALL(set_sched_priority)
+    14db:	b8 17 00 00 00       	mov    $0x17,%eax
+    14e0:	cd 40                	int    $0x40
+    14e2:	c3                   	ret
+
+000014e3 <get_sched_priority>:
+SYSCALL(get_sched_priority)
+    14e3:	b8 18 00 00 00       	mov    $0x18,%eax
+    14e8:	cd 40                	int    $0x40
+    14ea:	c3                   	ret
+
+000014eb <fifo_position>:
+SYSCALL(fifo_position)
+    14eb:	b8 19 00 00 00       	mov    $0x19,%eax
+    14f0:	cd 40                	int    $0x40
+    14f2:	c3                   	ret
+
+000014f3 <printProcessTable>:
+SYSCALL(printProcessTable)
+    14f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14f8:	cd 40                	int    $0x40
+    14fa:	c3                   	ret
+
+000014fb <symlink>:
+SYSCALL(symlink)
+    14fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <lseek>:
+SYSCALL(lseek)
+    1503:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <fallocate>:
+SYSCALL(fallocate)
+    150b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <iostats>:
+SYSCALL(iostats)
+    1513:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <fsync>:
+SYSCALL(fsync)
+    151b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+    1523:	66 90                	xchg   %ax,%ax
+    1525:	66 90                	xchg   %ax,%ax
+    1527:	66 90                	xchg   %ax,%ax
+    1529:	66 90                	xchg   %ax,%ax
+    152b:	66 90                	xchg   %ax,%ax
+    152d:	66 90                	xchg   %ax,%ax
+    152f:	90                   	nop
+
+00001530 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1530:	55                   	push   %ebp
+    1531:	89 e5                	mov    %esp,%ebp
+    1533:	57                   	push   %edi
+    1534:	56                   	push   %esi
+    1535:	53                   	push   %ebx
+    1536:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1538:	89 d1                	mov    %edx,%ecx
+{
+    153a:	83 ec 3c             	sub    $0x3c,%esp
+    153d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1540:	85 d2                	test   %edx,%edx
+    1542:	0f 89 80 00 00 00    	jns    15c8 <printint+0x98>
+    1548:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    154c:	74 7a                	je     15c8 <printint+0x98>
+    x = -xx;
+    154e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1550:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1555:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1558:	31 f6                	xor    %esi,%esi
+    155a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1560:	89 c8                	mov    %ecx,%eax
+    1562:	31 d2                	xor    %edx,%edx
+    1564:	89 f7                	mov    %esi,%edi
+    1566:	f7 f3                	div    %ebx
+    1568:	8d 76 01             	lea    0x1(%esi),%esi
+    156b:	0f b6 92 fc 1b 00 00 	movzbl 0x1bfc(%edx),%edx
+    1572:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1576:	89 ca                	mov    %ecx,%edx
+    1578:	89 c1                	mov    %eax,%ecx
+    157a:	39 da                	cmp    %ebx,%edx
+    157c:	73 e2                	jae    1560 <printint+0x30>
+  if(neg)
+    157e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1581:	85 c0                	test   %eax,%eax
+    1583:	74 07                	je     158c <printint+0x5c>
+    buf[i++] = '-';
+    1585:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    158a:	89 f7                	mov    %esi,%edi
+    158c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    158f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1592:	01 df                	add    %ebx,%edi
+    1594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1598:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    159b:	83 ec 04             	sub    $0x4,%esp
+    159e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    15a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    15a4:	6a 01                	push   $0x1
+    15a6:	50                   	push   %eax
+    15a7:	56                   	push   %esi
+    15a8:	e8 a6 fe ff ff       	call   1453 <write>
+  while(--i >= 0)
+    15ad:	89 f8                	mov    %edi,%eax
+    15af:	83 c4 10             	add    $0x10,%esp
+    15b2:	83 ef 01             	sub    $0x1,%edi
+    15b5:	39 d8                	cmp    %ebx,%eax
+    15b7:	75 df                	jne    1598 <printint+0x68>
+}
+    15b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15bc:	5b                   	pop    %ebx
+    15bd:	5e                   	pop    %esi
+    15be:	5f                   	pop    %edi
+    15bf:	5d                   	pop    %ebp
+    15c0:	c3                   	ret
+    15c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    15c8:	31 c0                	xor    %eax,%eax
+    15ca:	eb 89                	jmp    1555 <printint+0x25>
+    15cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000015d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	57                   	push   %edi
+    15d4:	56                   	push   %esi
+    15d5:	53                   	push   %ebx
+    15d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    15d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    15dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    15df:	0f b6 1e             	movzbl (%esi),%ebx
+    15e2:	83 c6 01             	add    $0x1,%esi
+    15e5:	84 db                	test   %bl,%bl
+    15e7:	74 67                	je     1650 <printf+0x80>
+    15e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    15ec:	31 d2                	xor    %edx,%edx
+    15ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    15f1:	eb 34                	jmp    1627 <printf+0x57>
+    15f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15f7:	90                   	nop
+    15f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    15fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1600:	83 f8 25             	cmp    $0x25,%eax
+    1603:	74 18                	je     161d <printf+0x4d>
+  write(fd, &c, 1);
+    1605:	83 ec 04             	sub    $0x4,%esp
+    1608:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    160b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    160e:	6a 01                	push   $0x1
+    1610:	50                   	push   %eax
+    1611:	57                   	push   %edi
+    1612:	e8 3c fe ff ff       	call   1453 <write>
+    1617:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    161a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    161d:	0f b6 1e             	movzbl (%esi),%ebx
+    1620:	83 c6 01             	add    $0x1,%esi
+    1623:	84 db                	test   %bl,%bl
+    1625:	74 29                	je     1650 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1627:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    162a:	85 d2                	test   %edx,%edx
+    162c:	74 ca                	je     15f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    162e:	83 fa 25             	cmp    $0x25,%edx
+    1631:	75 ea                	jne    161d <printf+0x4d>
+      if(c == 'd'){
+    1633:	83 f8 25             	cmp    $0x25,%eax
+    1636:	0f 84 24 01 00 00    	je     1760 <printf+0x190>
+    163c:	83 e8 63             	sub    $0x63,%eax
+    163f:	83 f8 15             	cmp    $0x15,%eax
+    1642:	77 1c                	ja     1660 <printf+0x90>
+    1644:	ff 24 85 a4 1b 00 00 	jmp    *0x1ba4(,%eax,4)
+    164b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    164f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1653:	5b                   	pop    %ebx
+    1654:	5e                   	pop    %esi
+    1655:	5f                   	pop    %edi
+    1656:	5d                   	pop    %ebp
+    1657:	c3                   	ret
+    1658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165f:	90                   	nop
+  write(fd, &c, 1);
+    1660:	83 ec 04             	sub    $0x4,%esp
+    1663:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1666:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    166a:	6a 01                	push   $0x1
+    166c:	52                   	push   %edx
+    166d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1670:	57                   	push   %edi
+    1671:	e8 dd fd ff ff       	call   1453 <write>
+    1676:	83 c4 0c             	add    $0xc,%esp
+    1679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    167c:	6a 01                	push   $0x1
+    167e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1681:	52                   	push   %edx
+    1682:	57                   	push   %edi
+    1683:	e8 cb fd ff ff       	call   1453 <write>
+        putc(fd, c);
+    1688:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    168b:	31 d2                	xor    %edx,%edx
+    168d:	eb 8e                	jmp    161d <printf+0x4d>
+    168f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1693:	83 ec 0c             	sub    $0xc,%esp
+    1696:	b9 10 00 00 00       	mov    $0x10,%ecx
+    169b:	8b 13                	mov    (%ebx),%edx
+    169d:	6a 00                	push   $0x0
+    169f:	89 f8                	mov    %edi,%eax
+        ap++;
+    16a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    16a4:	e8 87 fe ff ff       	call   1530 <printint>
+        ap++;
+    16a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16af:	31 d2                	xor    %edx,%edx
+    16b1:	e9 67 ff ff ff       	jmp    161d <printf+0x4d>
+    16b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    16c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    16c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    16c5:	83 c0 04             	add    $0x4,%eax
+    16c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    16cb:	85 db                	test   %ebx,%ebx
+    16cd:	0f 84 9d 00 00 00    	je     1770 <printf+0x1a0>
+        while(*s != 0){
+    16d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    16d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    16d8:	84 c0                	test   %al,%al
+    16da:	0f 84 3d ff ff ff    	je     161d <printf+0x4d>
+    16e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    16e6:	89 de                	mov    %ebx,%esi
+    16e8:	89 d3                	mov    %edx,%ebx
+    16ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    16f0:	83 ec 04             	sub    $0x4,%esp
+    16f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    16f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    16f9:	6a 01                	push   $0x1
+    16fb:	53                   	push   %ebx
+    16fc:	57                   	push   %edi
+    16fd:	e8 51 fd ff ff       	call   1453 <write>
+        while(*s != 0){
+    1702:	0f b6 06             	movzbl (%esi),%eax
+    1705:	83 c4 10             	add    $0x10,%esp
+    1708:	84 c0                	test   %al,%al
+    170a:	75 e4                	jne    16f0 <printf+0x120>
+      state = 0;
+    170c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    170f:	31 d2                	xor    %edx,%edx
+    1711:	e9 07 ff ff ff       	jmp    161d <printf+0x4d>
+    1716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1723:	83 ec 0c             	sub    $0xc,%esp
+    1726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    172b:	8b 13                	mov    (%ebx),%edx
+    172d:	6a 01                	push   $0x1
+    172f:	e9 6b ff ff ff       	jmp    169f <printf+0xcf>
+    1734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1738:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    173b:	83 ec 04             	sub    $0x4,%esp
+    173e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1741:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1743:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1746:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1749:	6a 01                	push   $0x1
+    174b:	52                   	push   %edx
+    174c:	57                   	push   %edi
+    174d:	e8 01 fd ff ff       	call   1453 <write>
+        ap++;
+    1752:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1755:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1758:	31 d2                	xor    %edx,%edx
+    175a:	e9 be fe ff ff       	jmp    161d <printf+0x4d>
+    175f:	90                   	nop
+  write(fd, &c, 1);
+    1760:	83 ec 04             	sub    $0x4,%esp
+    1763:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1766:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1769:	6a 01                	push   $0x1
+    176b:	e9 11 ff ff ff       	jmp    1681 <printf+0xb1>
+    1770:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1775:	bb 9d 1b 00 00       	mov    $0x1b9d,%ebx
+    177a:	e9 61 ff ff ff       	jmp    16e0 <printf+0x110>
+    177f:	90                   	nop
+
+00001780 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1780:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1781:	a1 04 20 00 00       	mov    0x2004,%eax
+{
+    1786:	89 e5                	mov    %esp,%ebp
+    1788:	57                   	push   %edi
+    1789:	56                   	push   %esi
+    178a:	53                   	push   %ebx
+    178b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    178e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1798:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    179a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    179c:	39 ca                	cmp    %ecx,%edx
+    179e:	73 30                	jae    17d0 <free+0x50>
+    17a0:	39 c1                	cmp    %eax,%ecx
+    17a2:	72 04                	jb     17a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17a4:	39 c2                	cmp    %eax,%edx
+    17a6:	72 f0                	jb     1798 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    17a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    17ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    17ae:	39 f8                	cmp    %edi,%eax
+    17b0:	74 2e                	je     17e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    17b5:	8b 42 04             	mov    0x4(%edx),%eax
+    17b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17bb:	39 f1                	cmp    %esi,%ecx
+    17bd:	74 38                	je     17f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    17bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    17c1:	5b                   	pop    %ebx
+  freep = p;
+    17c2:	89 15 04 20 00 00    	mov    %edx,0x2004
+}
+    17c8:	5e                   	pop    %esi
+    17c9:	5f                   	pop    %edi
+    17ca:	5d                   	pop    %ebp
+    17cb:	c3                   	ret
+    17cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17d0:	39 c1                	cmp    %eax,%ecx
+    17d2:	72 d0                	jb     17a4 <free+0x24>
+    17d4:	eb c2                	jmp    1798 <free+0x18>
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    17e0:	03 70 04             	add    0x4(%eax),%esi
+    17e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17e6:	8b 02                	mov    (%edx),%eax
+    17e8:	8b 00                	mov    (%eax),%eax
+    17ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    17ed:	8b 42 04             	mov    0x4(%edx),%eax
+    17f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17f3:	39 f1                	cmp    %esi,%ecx
+    17f5:	75 c8                	jne    17bf <free+0x3f>
+    p->s.size += bp->s.size;
+    17f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    17fa:	89 15 04 20 00 00    	mov    %edx,0x2004
+    p->s.size += bp->s.size;
+    1800:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1803:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1806:	89 0a                	mov    %ecx,(%edx)
+}
+    1808:	5b                   	pop    %ebx
+    1809:	5e                   	pop    %esi
+    180a:	5f                   	pop    %edi
+    180b:	5d                   	pop    %ebp
+    180c:	c3                   	ret
+    180d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001810 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1810:	55                   	push   %ebp
+    1811:	89 e5                	mov    %esp,%ebp
+    1813:	57                   	push   %edi
+    1814:	56                   	push   %esi
+    1815:	53                   	push   %ebx
+    1816:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1819:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    181c:	8b 15 04 20 00 00    	mov    0x2004,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1822:	8d 78 07             	lea    0x7(%eax),%edi
+    1825:	c1 ef 03             	shr    $0x3,%edi
+    1828:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    182b:	85 d2                	test   %edx,%edx
+    182d:	0f 84 8d 00 00 00    	je     18c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1833:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1835:	8b 48 04             	mov    0x4(%eax),%ecx
+    1838:	39 f9                	cmp    %edi,%ecx
+    183a:	73 64                	jae    18a0 <malloc+0x90>
+  if(nu < 4096)
+    183c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1841:	39 df                	cmp    %ebx,%edi
+    1843:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1846:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    184d:	eb 0a                	jmp    1859 <malloc+0x49>
+    184f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1850:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1852:	8b 48 04             	mov    0x4(%eax),%ecx
+    1855:	39 f9                	cmp    %edi,%ecx
+    1857:	73 47                	jae    18a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1859:	89 c2                	mov    %eax,%edx
+    185b:	39 05 04 20 00 00    	cmp    %eax,0x2004
+    1861:	75 ed                	jne    1850 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1863:	83 ec 0c             	sub    $0xc,%esp
+    1866:	56                   	push   %esi
+    1867:	e8 4f fc ff ff       	call   14bb <sbrk>
+  if(p == (char*)-1)
+    186c:	83 c4 10             	add    $0x10,%esp
+    186f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1872:	74 1c                	je     1890 <malloc+0x80>
+  hp->s.size = nu;
+    1874:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1877:	83 ec 0c             	sub    $0xc,%esp
+    187a:	83 c0 08             	add    $0x8,%eax
+    187d:	50                   	push   %eax
+    187e:	e8 fd fe ff ff       	call   1780 <free>
+  return freep;
+    1883:	8b 15 04 20 00 00    	mov    0x2004,%edx
+      if((p = morecore(nunits)) == 0)
+    1889:	83 c4 10             	add    $0x10,%esp
+    188c:	85 d2                	test   %edx,%edx
+    188e:	75 c0                	jne    1850 <malloc+0x40>
+        return 0;
+  }
+}
+    1890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1893:	31 c0                	xor    %eax,%eax
+}
+    1895:	5b                   	pop    %ebx
+    1896:	5e                   	pop    %esi
+    1897:	5f                   	pop    %edi
+    1898:	5d                   	pop    %ebp
+    1899:	c3                   	ret
+    189a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    18a0:	39 cf                	cmp    %ecx,%edi
+    18a2:	74 4c                	je     18f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    18a4:	29 f9                	sub    %edi,%ecx
+    18a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    18a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    18ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    18af:	89 15 04 20 00 00    	mov    %edx,0x2004
+}
+    18b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    18b8:	83 c0 08             	add    $0x8,%eax
+}
+    18bb:	5b                   	pop    %ebx
+    18bc:	5e                   	pop    %esi
+    18bd:	5f                   	pop    %edi
+    18be:	5d                   	pop    %ebp
+    18bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    18c0:	c7 05 04 20 00 00 08 	movl   $0x2008,0x2004
+    18c7:	20 00 00 
+    base.s.size = 0;
+    18ca:	b8 08 20 00 00       	mov    $0x2008,%eax
+    base.s.ptr = freep = prevp = &base;
+    18cf:	c7 05 08 20 00 00 08 	movl   $0x2008,0x2008
+    18d6:	20 00 00 
+    base.s.size = 0;
+    18d9:	c7 05 0c 20 00 00 00 	movl   $0x0,0x200c
+    18e0:	00 00 00 
+    if(p->s.size >= nunits){
+    18e3:	e9 54 ff ff ff       	jmp    183c <malloc+0x2c>
+    18e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    18f0:	8b 08                	mov    (%eax),%ecx
+    18f2:	89 0a                	mov    %ecx,(%edx)
+    18f4:	eb b9                	jmp    18af <malloc+0x9f>
@@ -23,10 +23,20 @@
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static uint eblocks(struct inode*);
+static int einsert(struct inode*, struct extent*);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
 
+// Free blocks, counted from the bitmap at boot, and how many of
+// them are promised to delayed writes (see idelayspace()).
+struct {
+  struct spinlock lock;
+  uint nfree;
+  uint ndelay;
+} bcount;
+
 // Read the super block.
 void
 readsb(int dev, struct superblock *sb)
@@ -52,6 +62,49 @@ bzero(int dev, int bno)
 
 // Blocks.
 
+// Add n to the count of free blocks.
+static void
+bcountadd(int n)
+{
+  acquire(&bcount.lock);
+  bcount.nfree += n;
+  release(&bcount.lock);
+}
+
+// Take up to n free blocks for an allocation, and return how
+// many.  Blocks promised to delayed writes (see idelayspace())
+// are only taken by the process allocating them, against its
+// bcredit; everyone else gets what is not promised.
+static uint
+bclaim(uint n)
+{
+  struct proc *p = myproc();
+  uint c, m;
+
+  acquire(&bcount.lock);
+  c = min(n, p->bcredit);
+  p->bcredit -= c;
+  bcount.ndelay -= c;
+  bcount.nfree -= c;
+  m = bcount.nfree > bcount.ndelay ? bcount.nfree - bcount.ndelay : 0;
+  m = min(n - c, m);
+  bcount.nfree -= m;
+  release(&bcount.lock);
+  return c + m;
+}
+
+// Free blocks not promised to delayed writes.
+static uint
+bavail(void)
+{
+  uint n;
+
+  acquire(&bcount.lock);
+  n = bcount.nfree > bcount.ndelay ? bcount.nfree - bcount.ndelay : 0;
+  release(&bcount.lock);
+  return n;
+}
+
 // Allocate a zeroed disk block.
 static uint
 balloc(uint dev)
@@ -66,6 +119,8 @@ balloc(uint dev)
     for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
       m = 1 << (bi % 8);
       if((bp->data[bi/8] & m) == 0){  // Is block free? if soo....
+        if(bclaim(1) == 0)
+          panic("balloc: out of blocks");  // the rest is promised
         bp->data[bi/8] |= m;  // Mark block in use.
         log_write(bp); // write the updated block map back to the physical disk
         brelse(bp);
@@ -78,6 +133,89 @@ balloc(uint dev)
   panic("balloc: out of blocks");
 }
 
+// Allocate a run of up to want contiguous disk blocks.
+// The blocks are not zeroed.
+// The run never crosses a bitmap block, so the whole run is
+// marked in use with one log_write().  If block goal is free the
+// run starts there, so a file can keep growing in place;
+// otherwise takes the first run of want free blocks, or failing
+// that the longest run seen.
+// Returns the first block of the run and sets *got to its length,
+// or returns 0 if the disk is full.
+static uint
+balloc_range(uint dev, uint goal, uint want, uint *got)
+{
+  int b, bi, m, start, len, beststart, bestlen;
+  struct buf *bp;
+
+  if(want == 0)
+    panic("balloc_range");
+
+  beststart = bestlen = 0;
+  if(goal > 0 && goal < sb.size){
+    bp = bread(dev, BBLOCK(goal, sb));
+    for(bi = goal % BPB; bi < BPB && goal + bestlen < sb.size; bi++){
+      if(bp->data[bi/8] & (1 << (bi % 8)))
+        break;
+      if(++bestlen == want)
+        break;
+    }
+    brelse(bp);
+    beststart = goal;
+    if(bestlen > 0)
+      goto found;
+  }
+
+  for(b = 0; b < sb.size; b += BPB){
+    bp = bread(dev, BBLOCK(b, sb));
+    start = len = 0;
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+      if(bi % 8 == 0 && bp->data[bi/8] == 0xff && b + bi + 8 <= sb.size){
+        // Whole byte in use; skip it.
+        len = 0;
+        bi += 7;
+        continue;
+      }
+      m = 1 << (bi % 8);
+      if(bp->data[bi/8] & m){
+        len = 0;
+        continue;
+      }
+      if(len++ == 0)
+        start = b + bi;
+      if(len > bestlen){
+        beststart = start;
+        bestlen = len;
+      }
+      if(len == want)
+        break;
+    }
+    brelse(bp);
+    if(bestlen == want)
+      break;
+  }
+  if(bestlen == 0){
+    *got = 0;
+    return 0;
+  }
+
+found:
+  if((bestlen = bclaim(bestlen)) == 0){
+    *got = 0;
+    return 0;
+  }
+  bp = bread(dev, BBLOCK(beststart, sb));
+  for(b = beststart; b < beststart + bestlen; b++){
+    bi = b % BPB;
+    bp->data[bi/8] |= 1 << (bi % 8);
+  }
+  log_write(bp);
+  brelse(bp);
+
+  *got = bestlen;
+  return beststart;
+}
+
 // Free a disk block.
 static void
 bfree(int dev, uint b)
@@ -93,6 +231,31 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+  log_free(b, 1);
+  bcountadd(1);
+}
+
+// Free n contiguous disk blocks starting at b, clearing their
+// bits with one log_write() per bitmap block the run spans.
+static void
+bfree_range(int dev, uint b, uint n)
+{
+  struct buf *bp;
+  int bi, m;
+
+  log_free(b, n);
+  bcountadd(n);
+  while(n > 0){
+    bp = bread(dev, BBLOCK(b, sb));
+    for(bi = b % BPB; bi < BPB && n > 0; bi++, b++, n--){
+      m = 1 << (bi % 8);
+      if((bp->data[bi/8] & m) == 0)
+        panic("freeing free block");
+      bp->data[bi/8] &= ~m;
+    }
+    log_write(bp);
+    brelse(bp);
+  }
 }
 
 // Inodes.
@@ -167,12 +330,16 @@ bfree(int dev, uint b)
 struct {
   struct spinlock lock;
   struct inode inode[NINODE];
+  struct inode *orphan[NINODE];  // see delalloc()
+  int norphan;
 } icache;
 
 void
 iinit(int dev)
 {
   int i = 0;
+  uint b, bi;
+  struct buf *bp;
   
   initlock(&icache.lock, "icache");
   for(i = 0; i < NINODE; i++) {
@@ -180,10 +347,21 @@ iinit(int dev)
   }
 
   readsb(dev, &sb);
+
+  initlock(&bcount.lock, "bcount");
+  for(b = 0; b < sb.size; b += BPB){
+    bp = bread(dev, BBLOCK(b, sb));
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+        bcount.nfree++;
+    }
+    brelse(bp);
+  }
+
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
- inodestart %d bmap start %d\n", sb.size, sb.nblocks,
+ inodestart %d bmap start %d free %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
-          sb.bmapstart);
+          sb.bmapstart, bcount.nfree);
 }
 
 static struct inode* iget(uint dev, uint inum);
@@ -205,6 +383,8 @@ ialloc(uint dev, short type)
     if(dip->type == 0){  // a free inode
       memset(dip, 0, sizeof(*dip));
       dip->type = type;
+      if(type == T_EXTENT)
+        dip->eversion = EXTENT_VERSION;
       log_write(bp);   // mark it allocated on the disk
       brelse(bp);
       return iget(dev, inum);
@@ -231,9 +411,18 @@ iupdate(struct inode *ip)
   dip->minor = ip->minor;
   dip->nlink = ip->nlink;
   dip->size = ip->size;
-  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+  if(ip->type == T_EXTENT && !ip->ebad){
+    memset(dip->addrs, 0, sizeof(dip->addrs));
+    dip->eversion = EXTENT_VERSION;
+    dip->edepth = ip->edepth;
+    dip->nextents = ip->numExtents;
+    memmove(dip->eroot, ip->extentz, sizeof(ip->extentz));
+  } else {
+    memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+  }
   log_write(bp);
   brelse(bp);
+  ip->txn = log_txn();
 }
 
 // Find the inode with number inum on device dev
@@ -267,6 +456,13 @@ iget(uint dev, uint inum)
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->numExtents = 0;
+  ip->edepth = 0;
+  ip->sisterblocks = 0;
+  ip->ndelay = 0;
+  ip->txn = 0;
+  ip->ranext = 0;
+  ip->raend = 0;
   release(&icache.lock);
 
   return ip;
@@ -304,11 +500,26 @@ ilock(struct inode *ip)
     ip->minor = dip->minor;
     ip->nlink = dip->nlink;
     ip->size = dip->size;
-    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+    ip->ebad = ip->type == T_EXTENT && dip->eversion != EXTENT_VERSION;
+    if(ip->type == T_EXTENT && !ip->ebad){
+      memset(ip->addrs, 0, sizeof(ip->addrs));
+      ip->edepth = dip->edepth;
+      ip->numExtents = dip->nextents;
+      memmove(ip->extentz, dip->eroot, sizeof(ip->extentz));
+    } else {
+      // An extent root in a format we cannot read is kept as it
+      // is on disk; readi() and writei() refuse the file.
+      memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+      ip->numExtents = ip->edepth = 0;
+    }
     brelse(bp);
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
+    if(ip->type == T_EXTENT)
+      ip->sisterblocks = eblocks(ip);
+    if(ip->ebad)
+      cprintf("inode %d: unknown extent version\n", ip->inum);
   }
 }
 
@@ -361,15 +572,17 @@ iunlockput(struct inode *ip)
 }
 
 
+// Return the disk block of file block bn of ip.  If it has
+// none, use block nb, or allocate one if nb is 0.
 static uint
-bmap(struct inode *ip, uint bn)
+bmap(struct inode *ip, uint bn, uint nb)
 {
   uint addr, *a;
   struct buf *bp;
 
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0) {
-      ip->addrs[bn] = addr = balloc(ip->dev);    
+      ip->addrs[bn] = addr = nb ? nb : balloc(ip->dev);
     }
 
     return addr;
@@ -383,7 +596,7 @@ bmap(struct inode *ip, uint bn)
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
     if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+      a[bn] = addr = nb ? nb : balloc(ip->dev);
       log_write(bp);
     }
     brelse(bp);
@@ -409,7 +622,7 @@ bmap(struct inode *ip, uint bn)
     a = (uint*)bp->data;
     if(!(addr = a[bn % D_INDIRECT_INSTANCE]))
     {
-      a[bn % D_INDIRECT_INSTANCE] = addr = balloc(ip->dev);
+      a[bn % D_INDIRECT_INSTANCE] = addr = nb ? nb : balloc(ip->dev);
       log_write(bp);
     }
     brelse(bp);
@@ -419,21 +632,549 @@ bmap(struct inode *ip, uint bn)
   panic("bmap: out of range");
 }
 
+// Extent trees.
+
+// Return the index of the last of the n records in e whose
+// logicalStart is at most bn (0 if there is none).
+static int
+esearch(struct extent *e, int n, uint bn)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = n;
+  while(hi - lo > 1){
+    mid = (lo + hi) / 2;
+    if(e[mid].logicalStart <= bn)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+// Find the extent of ip holding block bn and set *ep to point
+// at it, either in ip->extentz or in a leaf block.  In the latter
+// case returns the leaf's locked buffer, which the caller must
+// brelse().  Binary-searches each node on the way down the tree.
+static struct buf*
+efind(struct inode *ip, uint bn, struct extent **ep)
+{
+  struct extent *e;
+  struct extenthdr *hdr;
+  struct buf *bp;
+  uint child;
+  int n, depth;
+
+  bp = 0;
+  e = ip->extentz;
+  n = ip->numExtents;
+  for(depth = ip->edepth; ; depth--){
+    if(n == 0)
+      panic("efind: empty node");
+    e += esearch(e, n, bn);
+    if(depth == 0)
+      break;
+    child = e->startingAddress;
+    if(bp)
+      brelse(bp);
+    bp = bread(ip->dev, child);
+    hdr = (struct extenthdr*)bp->data;
+    if(hdr->magic != EXTENT_MAGIC || hdr->depth != depth - 1)
+      panic("efind: bad node");
+    e = (struct extent*)(hdr + 1);
+    n = hdr->entries;
+  }
+  if(bn < e->logicalStart || bn >= e->logicalStart + e->length)
+    panic("efind: out of range");
+  *ep = e;
+  return bp;
+}
+
+// Find the extent of ip holding block bn and copy it to *ex.
+static void
+elookup(struct inode *ip, uint bn, struct extent *ex)
+{
+  struct extent *e;
+  struct buf *bp;
+
+  bp = efind(ip, bn, &e);
+  *ex = *e;
+  if(bp)
+    brelse(bp);
+}
+
+// Return the disk block address of block bn of extent inode ip.
+static uint
+emap(struct inode *ip, uint bn)
+{
+  struct extent ex;
+
+  elookup(ip, bn, &ex);
+  return ex.startingAddress + bn - ex.logicalStart;
+}
+
+// Mark block bn of extent inode ip written and return its disk
+// block, setting *fresh if it was unwritten; the caller must fill
+// it.  The written blocks of an extent are a prefix, so writing
+// past the prefix splits the extent, ext4-style: the blocks from
+// bn on become an extent of their own, with bn written, and the
+// unwritten blocks before bn stay unwritten.
+// Returns 0 if there is no disk space for the split.
+static uint
+ewritten(struct inode *ip, uint bn, int *fresh)
+{
+  struct extent *e, x;
+  struct buf *leaf;
+  uint k, addr;
+
+  leaf = efind(ip, bn, &e);
+  k = bn - e->logicalStart;
+  addr = e->startingAddress + k;
+  *fresh = k >= e->written;
+  if(!*fresh){
+    if(leaf)
+      brelse(leaf);
+    return addr;
+  }
+
+  if(k == e->written){
+    e->written++;
+  } else {
+    x.logicalStart = bn;
+    x.startingAddress = addr;
+    x.length = e->length - k;
+    x.written = 1;
+    if(leaf)
+      brelse(leaf);
+    if(einsert(ip, &x) < 0)
+      return 0;
+    leaf = efind(ip, bn - 1, &e);
+    e->length = k;
+  }
+  if(leaf){
+    log_write(leaf);
+    brelse(leaf);
+  } else {
+    iupdate(ip);
+  }
+  return addr;
+}
+
+// Return a locked buffer for writing block bn of extent inode ip,
+// or 0 if the disk is too full.  A block that was unwritten comes
+// back zeroed.
+static struct buf*
+ewrite(struct inode *ip, uint bn)
+{
+  struct buf *bp;
+  uint addr;
+  int fresh;
+
+  if((addr = ewritten(ip, bn, &fresh)) == 0)
+    return 0;
+  bp = bread(ip->dev, addr);
+  if(fresh)
+    memset(bp->data, 0, BSIZE);
+  return bp;
+}
+
+// Find the nodes on the right edge of the non-empty extent tree
+// of ip, setting path[d] to the block of the one at depth d,
+// and copy the last extent of the file to *last.
+static void
+eright(struct inode *ip, uint *path, struct extent *last)
+{
+  struct extenthdr *hdr;
+  struct buf *bp;
+  int depth;
+
+  *last = ip->extentz[ip->numExtents - 1];
+  for(depth = ip->edepth - 1; depth >= 0; depth--){
+    path[depth] = last->startingAddress;
+    bp = bread(ip->dev, path[depth]);
+    hdr = (struct extenthdr*)bp->data;
+    if(hdr->magic != EXTENT_MAGIC || hdr->depth != depth)
+      panic("eright: bad node");
+    *last = ((struct extent*)(hdr + 1))[hdr->entries - 1];
+    brelse(bp);
+  }
+}
+
+// Return the number of file blocks mapped by the extent tree of ip.
+static uint
+eblocks(struct inode *ip)
+{
+  uint path[EXTENT_MAXDEPTH];
+  struct extent last;
+
+  if(ip->numExtents == 0)
+    return 0;
+  eright(ip, path, &last);
+  return last.logicalStart + last.length;
+}
+
+// Allocate a node block at the given depth holding just r.
+// Returns its block number, or 0 if the disk is full.
+static uint
+enode(struct inode *ip, int depth, struct extent *r)
+{
+  uint addr, got;
+  struct buf *bp;
+  struct extenthdr *hdr;
+
+  if((addr = balloc_range(ip->dev, 0, 1, &got)) == 0)
+    return 0;
+  bp = bread(ip->dev, addr);
+  memset(bp->data, 0, BSIZE);
+  hdr = (struct extenthdr*)bp->data;
+  hdr->magic = EXTENT_MAGIC;
+  hdr->depth = depth;
+  hdr->entries = 1;
+  hdr->max = NEXTENT_BLOCK;
+  *(struct extent*)(hdr + 1) = *r;
+  log_write(bp);
+  brelse(bp);
+  return addr;
+}
+
+// Add extent x at the right edge of the extent tree of ip.
+// If x continues the last extent on disk, that extent just grows.
+// Otherwise a full node gets a new right sibling holding x, and an index
+// record for the sibling goes up to the parent in the same way;
+// when the root itself is full, its records move into a new node
+// and the tree grows one level.
+static int
+eappend(struct inode *ip, struct extent *x)
+{
+  uint path[EXTENT_MAXDEPTH], addr;
+  struct extent r;
+  struct extenthdr *hdr;
+  struct buf *bp;
+  int depth;
+
+  if(ip->numExtents == 0){
+    ip->extentz[ip->numExtents++] = *x;
+    return 0;
+  }
+
+  // Merge x into the last extent if it follows it on disk and
+  // the written blocks of the result still form a prefix.  An
+  // extent with unwritten blocks is left alone, so a later write
+  // to x's blocks does not have to split it (see ewritten()).
+  eright(ip, path, &r);
+  if(r.startingAddress + r.length == x->startingAddress &&
+     r.length + x->length <= EXTENT_MAXLEN && r.written == r.length){
+    r.written += x->written;
+    r.length += x->length;
+    if(ip->edepth == 0){
+      ip->extentz[ip->numExtents - 1] = r;
+      return 0;
+    }
+    bp = bread(ip->dev, path[0]);
+    hdr = (struct extenthdr*)bp->data;
+    ((struct extent*)(hdr + 1))[hdr->entries - 1] = r;
+    log_write(bp);
+    brelse(bp);
+    return 0;
+  }
+
+  // Insert from the leaf up.
+  r = *x;
+  for(depth = 0; depth < ip->edepth; depth++){
+    bp = bread(ip->dev, path[depth]);
+    hdr = (struct extenthdr*)bp->data;
+    if(hdr->entries < hdr->max){
+      ((struct extent*)(hdr + 1))[hdr->entries++] = r;
+      log_write(bp);
+      brelse(bp);
+      return 0;
+    }
+    brelse(bp);
+    if((addr = enode(ip, depth, &r)) == 0)
+      return -1;
+    r.startingAddress = addr;
+    r.length = r.written = 0;
+  }
+
+  if(ip->numExtents < NEXTENT_ROOT){
+    ip->extentz[ip->numExtents++] = r;
+    return 0;
+  }
+
+  // Root is full: push its records down a level.
+  if(ip->edepth + 1 >= EXTENT_MAXDEPTH)
+    panic("eappend: tree too deep");
+  if((addr = enode(ip, ip->edepth, &ip->extentz[0])) == 0)
+    return -1;
+  bp = bread(ip->dev, addr);
+  hdr = (struct extenthdr*)bp->data;
+  memmove(hdr + 1, ip->extentz, ip->numExtents * sizeof(struct extent));
+  ((struct extent*)(hdr + 1))[ip->numExtents] = r;
+  hdr->entries = ip->numExtents + 1;
+  log_write(bp);
+  brelse(bp);
+
+  ip->extentz[0].startingAddress = addr;
+  ip->extentz[0].length = ip->extentz[0].written = 0;
+  ip->numExtents = 1;
+  ip->edepth++;
+  return 0;
+}
+
+// Insert extent x into the extent tree of ip, right after the
+// extent holding block x->logicalStart, which ewritten() is
+// splitting.  A full node splits in two, its upper half moving to
+// a new right sibling whose index record goes up to the parent in
+// the same way; a full root moves down into a new node.  The new
+// nodes are allocated first, so if the disk is full this returns
+// -1 with the tree unchanged.
+static int
+einsert(struct inode *ip, struct extent *x)
+{
+  uint path[EXTENT_MAXDEPTH], addr[EXTENT_MAXDEPTH];
+  struct extent tmp[NEXTENT_BLOCK+1], r, *e;
+  struct extenthdr *hdr;
+  struct buf *bp;
+  uint got;
+  int depth, full, n, i, half;
+
+  // Find the nodes down to the leaf, and how many of them, from
+  // the leaf up, are full and must split.
+  e = ip->extentz;
+  n = ip->numExtents;
+  full = 0;
+  for(depth = ip->edepth; depth > 0; depth--){
+    path[depth-1] = e[esearch(e, n, x->logicalStart)].startingAddress;
+    bp = bread(ip->dev, path[depth-1]);
+    hdr = (struct extenthdr*)bp->data;
+    if(hdr->magic != EXTENT_MAGIC || hdr->depth != depth - 1)
+      panic("einsert: bad node");
+    full = hdr->entries < hdr->max ? 0 : full + 1;
+    n = hdr->entries;
+    memmove(tmp, hdr + 1, n * sizeof(struct extent));
+    brelse(bp);
+    e = tmp;
+  }
+  if(full == ip->edepth && ip->numExtents == NEXTENT_ROOT){
+    if(ip->edepth + 1 >= EXTENT_MAXDEPTH)
+      return -1;
+    full++;  // the root moves down too
+  }
+  for(i = 0; i < full; i++){
+    if((addr[i] = balloc_range(ip->dev, 0, 1, &got)) == 0){
+      while(--i >= 0)
+        bfree(ip->dev, addr[i]);
+      return -1;
+    }
+  }
+
+  // Insert from the leaf up.
+  r = *x;
+  for(depth = 0; depth < ip->edepth; depth++){
+    bp = bread(ip->dev, path[depth]);
+    hdr = (struct extenthdr*)bp->data;
+    e = (struct extent*)(hdr + 1);
+    n = hdr->entries;
+    i = esearch(e, n, r.logicalStart) + 1;
+    if(n < hdr->max){
+      memmove(e + i + 1, e + i, (n - i) * sizeof(struct extent));
+      e[i] = r;
+      hdr->entries++;
+      log_write(bp);
+      brelse(bp);
+      return 0;
+    }
+    memmove(tmp, e, i * sizeof(struct extent));
+    tmp[i] = r;
+    memmove(tmp + i + 1, e + i, (n - i) * sizeof(struct extent));
+    half = (n + 1) / 2;
+    memmove(e, tmp, half * sizeof(struct extent));
+    hdr->entries = half;
+    log_write(bp);
+    brelse(bp);
+
+    bp = bread(ip->dev, addr[depth]);
+    memset(bp->data, 0, BSIZE);
+    hdr = (struct extenthdr*)bp->data;
+    hdr->magic = EXTENT_MAGIC;
+    hdr->depth = depth;
+    hdr->entries = n + 1 - half;
+    hdr->max = NEXTENT_BLOCK;
+    memmove(hdr + 1, tmp + half, hdr->entries * sizeof(struct extent));
+    log_write(bp);
+    brelse(bp);
+
+    r.logicalStart = tmp[half].logicalStart;
+    r.startingAddress = addr[depth];
+    r.length = r.written = 0;
+  }
+
+  e = ip->extentz;
+  n = ip->numExtents;
+  i = esearch(e, n, r.logicalStart) + 1;
+  if(n < NEXTENT_ROOT){
+    memmove(e + i + 1, e + i, (n - i) * sizeof(struct extent));
+    e[i] = r;
+    ip->numExtents++;
+    iupdate(ip);
+    return 0;
+  }
+
+  // Root is full: its records and r move down a level.
+  bp = bread(ip->dev, addr[ip->edepth]);
+  memset(bp->data, 0, BSIZE);
+  hdr = (struct extenthdr*)bp->data;
+  hdr->magic = EXTENT_MAGIC;
+  hdr->depth = ip->edepth;
+  hdr->entries = n + 1;
+  hdr->max = NEXTENT_BLOCK;
+  memmove(tmp, e, i * sizeof(struct extent));
+  tmp[i] = r;
+  memmove(tmp + i + 1, e + i, (n - i) * sizeof(struct extent));
+  memmove(hdr + 1, tmp, (n + 1) * sizeof(struct extent));
+  log_write(bp);
+  brelse(bp);
+
+  ip->extentz[0].startingAddress = addr[ip->edepth];
+  ip->extentz[0].length = ip->extentz[0].written = 0;
+  ip->numExtents = 1;
+  ip->edepth++;
+  iupdate(ip);
+  return 0;
+}
+
+// Add one run of new blocks to the extent map of ip, toward
+// covering nblocks blocks.  The run is allocated with
+// balloc_range() right after the file's last block when possible,
+// so appends extend one extent.  The new blocks are unwritten:
+// they read as zeros until ewrite() hands them out.
+static int
+egrow(struct inode *ip, uint nblocks)
+{
+  struct extent x;
+  uint goal, got;
+
+  goal = 0;
+  if(ip->sisterblocks > 0)
+    goal = emap(ip, ip->sisterblocks - 1) + 1;
+  x.logicalStart = ip->sisterblocks;
+  x.startingAddress = balloc_range(ip->dev, goal,
+    min(nblocks - ip->sisterblocks, EXTENT_MAXLEN), &got);
+  x.length = got;
+  x.written = 0;
+  if(got == 0 || eappend(ip, &x) < 0)
+    return -1;
+  ip->sisterblocks += got;
+  return 0;
+}
+
+// Grow the extent map of ip to cover nblocks blocks.
+static int
+eextend(struct inode *ip, uint nblocks)
+{
+  while(ip->sisterblocks < nblocks){
+    if(egrow(ip, nblocks) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+// Free the blocks of the n records in e at the given depth,
+// including the node blocks below them.
+static void
+etrunc(struct inode *ip, struct extent *e, int n, int depth)
+{
+  struct extenthdr *hdr;
+  struct buf *bp;
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(depth == 0){
+      bfree_range(ip->dev, e[i].startingAddress, e[i].length);
+      continue;
+    }
+    bp = bread(ip->dev, e[i].startingAddress);
+    hdr = (struct extenthdr*)bp->data;
+    etrunc(ip, (struct extent*)(hdr + 1), hdr->entries, depth - 1);
+    brelse(bp);
+    bfree(ip->dev, e[i].startingAddress);
+  }
+}
+
+// Copy the first extents of the n records in e at the given
+// depth into st, counting every extent in st->numExtents.
+static void
+estat(struct inode *ip, struct extent *e, int n, int depth, struct stat *st)
+{
+  struct extenthdr *hdr;
+  struct buf *bp;
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(depth == 0){
+      if(st->numExtents < NELEM(st->extentz)){
+        st->extentz[st->numExtents].logicalStart = e[i].logicalStart;
+        st->extentz[st->numExtents].startingAddress = e[i].startingAddress;
+        st->extentz[st->numExtents].length = e[i].length;
+      }
+      st->numExtents++;
+      continue;
+    }
+    bp = bread(ip->dev, e[i].startingAddress);
+    hdr = (struct extenthdr*)bp->data;
+    estat(ip, (struct extent*)(hdr + 1), hdr->entries, depth - 1, st);
+    brelse(bp);
+  }
+}
+
+// A run of blocks that itrunc() has yet to free.
+struct frun {
+  uint start;
+  uint len;
+};
+
+// Add block b to the pending run r, first freeing r
+// if b does not continue it.
+static void
+frun_add(uint dev, struct frun *r, uint b)
+{
+  if(r->len > 0 && b == r->start + r->len){
+    r->len++;
+    return;
+  }
+  if(r->len > 0)
+    bfree_range(dev, r->start, r->len);
+  r->start = b;
+  r->len = 1;
+}
+
 // Truncate inode (discard contents).
 // Only called when the inode has no links
 // to it (no directory entries referring to it)
 // and has no in-memory reference to it (is
 // not an open file or current directory).
+// Blocks are freed in contiguous runs, so each
+// bitmap block is updated once per run.
 static void
 itrunc(struct inode *ip)
 {
   int i, j;
-  struct buf *bp;
-  uint *a;
+  struct buf *bp, *bp2;
+  uint *a, *a2;
+  struct frun run;
+
+  if(ip->type == T_SYMLINK || ip->ebad){
+    // addrs holds the target path, or an extent root we cannot
+    // read, not blocks.
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+    goto done;
+  }
 
+  run.start = run.len = 0;
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
+      frun_add(ip->dev, &run, ip->addrs[i]);
       ip->addrs[i] = 0;
     }
   }
@@ -443,13 +1184,44 @@ itrunc(struct inode *ip)
     a = (uint*)bp->data;
     for(j = 0; j < NINDIRECT; j++){
       if(a[j])
-        bfree(ip->dev, a[j]);
+        frun_add(ip->dev, &run, a[j]);
     }
     brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
+    frun_add(ip->dev, &run, ip->addrs[NDIRECT]);
     ip->addrs[NDIRECT] = 0;
   }
 
+  if(ip->addrs[NDIRECT+1]){
+    bp = bread(ip->dev, ip->addrs[NDIRECT+1]);
+    a = (uint*)bp->data;
+    for(i = 0; i < D_INDIRECT_INSTANCE; i++){
+      if(a[i] == 0)
+        continue;
+      bp2 = bread(ip->dev, a[i]);
+      a2 = (uint*)bp2->data;
+      for(j = 0; j < D_INDIRECT_INSTANCE; j++){
+        if(a2[j])
+          frun_add(ip->dev, &run, a2[j]);
+      }
+      brelse(bp2);
+      frun_add(ip->dev, &run, a[i]);
+    }
+    brelse(bp);
+    frun_add(ip->dev, &run, ip->addrs[NDIRECT+1]);
+    ip->addrs[NDIRECT+1] = 0;
+  }
+
+  if(run.len > 0)
+    bfree_range(ip->dev, run.start, run.len);
+
+  if(ip->type == T_EXTENT){
+    etrunc(ip, ip->extentz, ip->numExtents, ip->edepth);
+    ip->numExtents = 0;
+    ip->edepth = 0;
+    ip->sisterblocks = 0;
+  }
+
+done:
   ip->size = 0;
   iupdate(ip);
 }
@@ -464,13 +1236,11 @@ stati(struct inode *ip, struct stat *st)
   st->type = ip->type;
   st->nlink = ip->nlink;
   st->size = ip->size;
+  st->dirty = !log_committed(ip->txn);
 
   if(ip->type == T_EXTENT || ip->type == 5) {
-      st->numExtents = ip->numExtents;
-    for(int i = 0; i < ip->numExtents; i++){
-        st->extentz[i].length = ip->extentz[i].length;
-        st->extentz[i].startingAddress = ip->extentz[i].startingAddress;
-    }
+    st->numExtents = 0;
+    estat(ip, ip->extentz, ip->numExtents, ip->edepth, st);
   } else {
     if(ip->type == T_FILE) {
       for(int i = 0; i < NDIRECT; i++){
@@ -480,12 +1250,271 @@ stati(struct inode *ip, struct stat *st)
   }
 }
 
+// Delayed allocation.
+//
+// Writes that add blocks to a file or extent file leave the data
+// in the buffer cache (bdelay) instead of allocating disk blocks.
+// Blocks dstart..dstart+ndelay-1 of such an inode are delayed; the
+// inode holds an extra reference until delalloc() allocates them
+// as one run per file, at the end of the transaction.  They always
+// follow the file's last mapped block.  writei() promises them disk
+// space before it delays them, so delalloc() cannot run out.
+
+// Bound on the block-map or extent-tree nodes delalloc() allocates
+// for n delayed blocks of one file: at worst each block is a run
+// of its own, and a node holds NEXTENT_BLOCK records.
+static uint
+dnodes(uint n)
+{
+  return n / (NEXTENT_BLOCK/2) + EXTENT_MAXDEPTH + 2;
+}
+
+// Disk blocks promised to n delayed blocks of one file.
+static uint
+dspace(uint n)
+{
+  return n > 0 ? n + dnodes(n) : 0;
+}
+
+// Log blocks set aside for n delayed blocks of one file: the
+// blocks, a bitmap block per run at worst, and WRITEMETA.
+// filewrite() reserves enough for an op to add its share.
+static uint
+dlog(uint n)
+{
+  return n > 0 ? n + min(n, sb.size/BPB + 1) + WRITEMETA(n) : 0;
+}
+
+// Return the number of leading blocks of ip that have disk
+// blocks; the blocks after them are delayed writes.
+static uint
+imapped(struct inode *ip)
+{
+  if(ip->ndelay > 0)
+    return ip->dstart;
+  if(ip->type == T_EXTENT)
+    return ip->sisterblocks;
+  return (ip->size + BSIZE - 1) / BSIZE;
+}
+
+// Promise disk space for delayed writes of ip up to block end.
+// Returns -1 if the disk is too full.
+static int
+idelayspace(struct inode *ip, uint end)
+{
+  uint want;
+  int ok;
+
+  if(end <= imapped(ip) + ip->ndelay)
+    return 0;
+  want = dspace(end - imapped(ip)) - dspace(ip->ndelay);
+  acquire(&bcount.lock);
+  ok = bcount.nfree >= bcount.ndelay + want;
+  if(ok)
+    bcount.ndelay += want;
+  release(&bcount.lock);
+  return ok ? 0 : -1;
+}
+
+// Return a locked buffer for writing block bn of ip, which
+// has no disk block yet.
+static struct buf*
+idelay(struct inode *ip, uint bn)
+{
+  if(ip->ndelay == 0){
+    ip->dstart = bn;
+    idup(ip);  // keep ip cached until delalloc()
+  }
+  if(bn == ip->dstart + ip->ndelay){
+    log_delay(dlog(ip->ndelay + 1) - dlog(ip->ndelay));
+    ip->ndelay++;
+  } else if(bn < ip->dstart || bn > ip->dstart + ip->ndelay)
+    panic("idelay");
+  return bdelay(ip->dev, ip->inum, bn);
+}
+
+// Allocate disk blocks for the delayed writes of ip and log them.
+static void
+iallocdelayed(struct inode *ip)
+{
+  struct buf *bp;
+  uint bn, end, addr, goal, got;
+  int fresh;
+
+  // The blocks idelayspace() promised are ours to allocate.
+  myproc()->bcredit = dspace(ip->ndelay);
+  end = ip->dstart + ip->ndelay;
+  if(ip->type == T_EXTENT && eextend(ip, end) < 0)
+    panic("delalloc: out of blocks");
+
+  got = 0;
+  addr = 0;
+  for(bn = ip->dstart; bn < end; bn++){
+    if(ip->type == T_EXTENT){
+      // Delayed blocks follow the written ones (see eappend()),
+      // so there is nothing to split.
+      if((addr = ewritten(ip, bn, &fresh)) == 0)
+        panic("delalloc: split");
+    } else {
+      if(got == 0){
+        goal = bn > 0 ? bmap(ip, bn - 1, 0) + 1 : 0;
+        if((addr = balloc_range(ip->dev, goal, end - bn, &got)) == 0)
+          panic("delalloc: out of blocks");
+      } else {
+        addr++;
+      }
+      got--;
+      bmap(ip, bn, addr);
+    }
+    bp = bdelay(ip->dev, ip->inum, bn);
+    bassign(bp, addr);
+    log_data(bp);
+    brelse(bp);
+  }
+  log_delay(-dlog(ip->ndelay));
+  acquire(&bcount.lock);
+  bcount.ndelay -= myproc()->bcredit;  // promised but not needed
+  myproc()->bcredit = 0;
+  release(&bcount.lock);
+  ip->ndelay = 0;
+  iupdate(ip);
+}
+
+// Allocate the delayed writes of ip now, inside the caller's
+// transaction, rather than in delalloc().
+static void
+iflushdelayed(struct inode *ip)
+{
+  iallocdelayed(ip);
+  acquire(&icache.lock);
+  ip->ref--;  // idelay()'s reference; the caller holds another
+  release(&icache.lock);
+}
+
+// Allocate disk blocks for all delayed writes.
+// Called by the last outstanding FS operation of a transaction.
+void
+delalloc(void)
+{
+  struct inode *ip;
+  int done;
+
+  acquire(&icache.lock);
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+    // ndelay only turns nonzero along with an extra reference,
+    // so this unlocked peek skips inodes that may not be valid.
+    if(ip->ref == 0 || ip->ndelay == 0)
+      continue;
+    ip->ref++;
+    release(&icache.lock);
+    ilock(ip);
+    done = ip->ndelay > 0;
+    if(done)
+      iallocdelayed(ip);
+    iunlock(ip);
+    acquire(&icache.lock);
+    if(done)
+      ip->ref--;  // the reference idelay() took; ours remains
+    // If ours is the last reference to an unlinked file, iput()
+    // would free it, with no log space reserved for that this
+    // late in the op.  Leave it to iputorphans() instead.
+    if(ip->ref == 1 && ip->valid && ip->nlink == 0)
+      icache.orphan[icache.norphan++] = ip;
+    else
+      ip->ref--;
+  }
+  release(&icache.lock);
+}
+
+// Free the unlinked files whose last reference delalloc() held,
+// each in an op of its own.  Called by end_op(), outside the op.
+void
+iputorphans(void)
+{
+  struct inode *ip;
+
+  for(;;){
+    acquire(&icache.lock);
+    if(icache.norphan == 0){
+      release(&icache.lock);
+      return;
+    }
+    ip = icache.orphan[--icache.norphan];
+    release(&icache.lock);
+    begin_op();
+    iput(ip);
+    end_op();
+  }
+}
+
+// Read-ahead.
+
+#define RA_BLOCKS 8    // blocks read ahead of a sequential reader
+#define RA_EXTENT 64   // most blocks read ahead in an extent
+
+// Blocks first..last of ip are about to be read.  If ip is being
+// read sequentially, start reading them and the blocks after them
+// from disk without waiting, so the disk runs ahead of the reader.
+// Extent files read on to the end of the extent.
+static void
+ireadahead(struct inode *ip, uint first, uint last)
+{
+  struct extent ex;
+  uint bn, end, nblocks, addr, n;
+
+  if(first > ip->ranext || first + 1 < ip->ranext){
+    // Not sequential: start over from here.
+    ip->ranext = ip->raend = last + 1;
+    return;
+  }
+  ip->ranext = last + 1;
+  if(last + RA_BLOCKS/2 < ip->raend)
+    return;  // enough read ahead already
+
+  // Stop at the end of the file and at delayed writes.
+  nblocks = (ip->size + BSIZE - 1) / BSIZE;
+  if(ip->ndelay > 0 && ip->dstart < nblocks)
+    nblocks = ip->dstart;
+  end = min(last + 1 + RA_BLOCKS, nblocks);
+  bn = first > ip->raend ? first : ip->raend;
+
+  if(ip->type == T_EXTENT){
+    if(end > 0){
+      elookup(ip, end - 1, &ex);
+      n = min(ex.logicalStart + ex.written, last + 1 + RA_EXTENT);
+      if(n > end)
+        end = min(n, nblocks);
+    }
+    while(bn < end){
+      elookup(ip, bn, &ex);
+      if(bn - ex.logicalStart >= ex.written){
+        bn = ex.logicalStart + ex.length;  // unwritten: no I/O
+        continue;
+      }
+      n = min(ex.logicalStart + ex.written, end) - bn;
+      bread_ahead(ip->dev, ex.startingAddress + bn - ex.logicalStart, n);
+      bn += n;
+    }
+  } else {
+    while(bn < end){
+      addr = bmap(ip, bn, 0);
+      for(n = 1; bn + n < end && bmap(ip, bn + n, 0) == addr + n; n++)
+        ;
+      bread_ahead(ip->dev, addr, n);
+      bn += n;
+    }
+  }
+  if(end > ip->raend)
+    ip->raend = end;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
 int readi(struct inode *ip, char *dst, uint off, uint n) {
-  uint tot, m;
+  uint tot, m, bn;
   struct buf *bp;
+  struct extent ex;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read) {
@@ -494,45 +1523,37 @@ int readi(struct inode *ip, char *dst, uint off, uint n) {
     return devsw[ip->major].read(ip, dst, n);
   }
 
-  if(ip->type == T_EXTENT) {
-      if(ip->lOffset >= ip->sisterblocks) {
-        // We are done!
-          return 0;
-      }
-
-      for(int i = ip->eOffset; i < ip->numExtents; i++) {
-          for(int j = 0; j < ip->extentz[i].length; j++) {
-
-              bp = bread(ip->dev, bmap(ip, ip->lOffset));
-              int bpSize = strlen((char *)bp->data);
-
-              if(bpSize > 512) {
-                bpSize = 512;
-              }
-
-              memmove(dst, bp->data, bpSize);
+  if(off > ip->size || off + n < off || ip->ebad) {
+    return -1;
+  }
 
-              ip->lOffset++;
+  if(off + n > ip->size) {
+    n = ip->size - off;
+  }
 
-              brelse(bp);
-              return bpSize;
-          }
-      }
-  } else {  
-        if(off > ip->size || off + n < off) {
-              return -1;
-        }
-
-        if(off + n > ip->size) {
-            n = ip->size - off;
-        }
-
-      for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-        bp = bread(ip->dev, bmap(ip, off/BSIZE));
-        m = min(n - tot, BSIZE - off%BSIZE);
-        memmove(dst, bp->data + off%BSIZE, m);
-        brelse(bp);
+  if(n > 0)
+    ireadahead(ip, off/BSIZE, (off + n - 1)/BSIZE);
+
+  memset(&ex, 0, sizeof(ex));
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+    bn = off/BSIZE;
+    m = min(n - tot, BSIZE - off%BSIZE);
+    if(ip->ndelay > 0 && bn >= ip->dstart && bn < ip->dstart + ip->ndelay){
+      bp = bdelay(ip->dev, ip->inum, bn);
+    } else if(ip->type == T_EXTENT){
+      // Look the extent up once, then walk through it.
+      if(ex.length == 0 || bn >= ex.logicalStart + ex.length)
+        elookup(ip, bn, &ex);
+      if(bn - ex.logicalStart >= ex.written){
+        memset(dst, 0, m);  // unwritten
+        continue;
       }
+      bp = bread(ip->dev, ex.startingAddress + bn - ex.logicalStart);
+    } else {
+      bp = bread(ip->dev, bmap(ip, bn, 0));
+    }
+    memmove(dst, bp->data + off%BSIZE, m);
+    brelse(bp);
   }
 
   return n;
@@ -544,8 +1565,9 @@ int readi(struct inode *ip, char *dst, uint off, uint n) {
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, bn;
   struct buf *bp;
+  int delay;
 
   if(ip->type == T_DEV) {
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write) {
@@ -555,71 +1577,98 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return devsw[ip->major].write(ip, src, n);
   }
 
-  if(off > ip->size || off + n < off) {
+  if(off > ip->size || off + n < off || ip->ebad) {
      return -1;
   }
-  if(off + n > MAXFILE*BSIZE) {
+  if(ip->type != T_EXTENT && off + n > MAXFILE*BSIZE) {
       return -1;
   }
 
-// Project 4 Part 4 things.
-  if(ip->type == T_EXTENT) {
-    // Check we havent made too made extents
-    if(ip->numExtents > NDIRECT) {
-      cprintf("You have too many extents. Your extent file is too big and we cannot continue to write. Exiting...\n");
-      exit();
-    } else {
-      ip->numExtents++;
-    }
+  // New blocks of files wait for delalloc() to place them.
+  delay = DELALLOC && (ip->type == T_FILE || ip->type == T_EXTENT);
+  if(delay && idelayspace(ip, (off + n + BSIZE - 1) / BSIZE) < 0)
+    return -1;
 
-    struct extent iextent;
-    int lengthCounter = 0;
+  // Project 4 Part 4 things.
+  // Extent files get any new blocks up front, in contiguous runs.
+  if(ip->type == T_EXTENT && !delay &&
+     eextend(ip, (off + n + BSIZE - 1) / BSIZE) < 0){
+    iupdate(ip);  // keep whatever was allocated
+    return -1;
+  }
 
-    for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-      if(tot == 0) {
-          iextent.startingAddress = bmap(ip, ip->sisterblocks);
-          bp = bread(ip->dev, iextent.startingAddress);
-      } else {
-        bp = bread(ip->dev, bmap(ip, ip->sisterblocks));
-      }
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+    bn = off/BSIZE;
+    if(delay && bn >= imapped(ip))
+      bp = idelay(ip, bn);
+    else if(ip->type == T_EXTENT){
+      if((bp = ewrite(ip, bn)) == 0)
+        return -1;  // no space to split an extent
+    } else
+      bp = bread(ip->dev, bmap(ip, bn, 0));
+
+    m = min(n - tot, BSIZE - off%BSIZE);    
+    memmove(bp->data + off%BSIZE, src, m);  
+
+    if((bp->flags & B_DELAY) == 0){
+      if(ip->type == T_DIR)
+        log_write(bp);  // directories are metadata
+      else
+        log_data(bp);
+    }
+    brelse(bp); 
+  }
 
-      ip->sisterblocks++;
-      lengthCounter++;
+  if(n > 0 && off > ip->size){
+    ip->size = off;
+    iupdate(ip);
+  }
+  ip->txn = log_txn();
 
-      m = min(n - tot, BSIZE - off%BSIZE);     
-      memmove(bp->data + off%BSIZE, src, m);  
-      log_write(bp); 
+  return n; 
+}
 
-      brelse(bp);
-    } 
+// Reserve blocks for bytes [off, off+n) of extent inode ip
+// without writing them; they read as zeros until written, and
+// the file grows to cover them.  Allocates at most one run of
+// blocks so the caller can bound its transaction: returns 1 if
+// more blocks are needed, 0 when done, -1 on error.
+// Caller must hold ip->lock.
+int
+falloci(struct inode *ip, uint off, uint n)
+{
+  uint end, avail;
 
-    iextent.length = lengthCounter;
+  if(ip->type != T_EXTENT || ip->ebad || off + n < off)
+    return -1;
 
-    if(n > 0){
-      ip->extentz[ip->numExtents - 1] = iextent;
-      ip->size += n;
-      ip->eOffset = 0;
-      ip->lOffset = 0;
+  // New blocks are mapped from the end of the extent map, where
+  // any delayed writes are; give those their blocks first.
+  if(ip->ndelay > 0)
+    iflushdelayed(ip);
+
+  end = (off + n + BSIZE - 1) / BSIZE;
+  if(ip->sisterblocks < end){
+    // Leave the blocks promised to delayed writes, and room for
+    // the extent-tree nodes this run may need.
+    avail = bavail();
+    if(avail <= EXTENT_MAXDEPTH + 1){
       iupdate(ip);
+      return -1;
+    }
+    if(egrow(ip, min(end, ip->sisterblocks + avail - EXTENT_MAXDEPTH - 1)) < 0){
+      iupdate(ip);
+      return -1;
+    }
+    if(ip->sisterblocks < end){
+      iupdate(ip);
+      return 1;
     }
-  } else { 
-      for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-        bp = bread(ip->dev, bmap(ip, off/BSIZE));
-
-        m = min(n - tot, BSIZE - off%BSIZE);    
-        memmove(bp->data + off%BSIZE, src, m);  
-
-        log_write(bp); 
-        brelse(bp); 
-      }
-
-      if(n > 0 && off > ip->size){
-        ip->size = off;
-        iupdate(ip);
-      }
   }
-
-  return n; 
+  if(off + n > ip->size)
+    ip->size = off + n;
+  iupdate(ip);
+  return 0;
 }
 
 //PAGEBREAK!
@@ -21,6 +21,14 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
+// A log record starts with header blocks holding an array of
+// ints: LOGHDR ints about the record, then one block number for
+// each of the record's blocks.  LOGHEADS(nlog) is the number of
+// header blocks a record filling a log of nlog blocks needs.
+#define LOGHPB (BSIZE / sizeof(int))  // header ints per block
+#define LOGHDR 4
+#define LOGHEADS(nlog) (((nlog) + LOGHDR + LOGHPB) / (LOGHPB + 1))
+
 // do not change these values, please
 #define NDIRECT 11
 #define D_INDIRECT_INSTANCE 128
@@ -32,6 +40,50 @@ struct superblock {
 
 #define MAXFILE (NDIRECT + NINDIRECT + D_INDIRECT)
 
+// Extent record: length blocks that are contiguous on disk,
+// starting at block startingAddress, holding file blocks
+// logicalStart .. logicalStart+length-1.  An inode's extents
+// are kept sorted by logicalStart.  Only the first written
+// blocks hold data; the rest are reserved (fallocate) and
+// read as zeros.  Writing past them splits the extent.
+struct extent {
+  uint logicalStart;
+  uint startingAddress;
+  ushort length;
+  ushort written;
+};
+
+#define EXTENT_MAXLEN 0xffff  // max blocks in one extent
+
+// Extent tree.  An extent file's extents are indexed by a tree
+// whose root is in the inode (NEXTENT_ROOT records).  When the
+// root fills, its records move down into a new node block and the
+// root indexes that block instead.  A node block is an extenthdr
+// followed by records; at depth 0 the records are extents, above
+// that each record points (startingAddress) at a child node whose
+// first file block is logicalStart.  Records are added at the
+// right edge as extent files grow, and in the middle only when a
+// write splits a reserved extent.
+struct extenthdr {
+  ushort magic;    // EXTENT_MAGIC
+  ushort depth;    // 0 for a leaf
+  ushort entries;  // records in use
+  ushort max;      // records that fit in the block
+};
+
+#define EXTENT_MAGIC 0xE47E
+#define NEXTENT_ROOT 4
+#define NEXTENT_BLOCK ((BSIZE - sizeof(struct extenthdr)) / sizeof(struct extent))
+#define EXTENT_MAXDEPTH 4
+
+// Log blocks a write of n new file blocks may need besides the
+// blocks and their bitmap blocks: block-map or extent-tree nodes,
+// at worst a record per block, the nodes they change, the inode.
+#define WRITEMETA(n) ((n)/(NEXTENT_BLOCK/2) + 2*EXTENT_MAXDEPTH + 4)
+
+// Layout of the extent fields of a T_EXTENT dinode.
+#define EXTENT_VERSION 2
+
 // On-disk inode structure
 struct dinode {
   short type;           // File type
@@ -39,7 +91,15 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+2];   // Data block addresses
+  union {
+    uint addrs[NDIRECT+2];   // Data block addresses
+    struct {                 // T_EXTENT: root of the extent tree
+      uchar eversion;        // EXTENT_VERSION
+      uchar edepth;          // depth of the tree; 0 if eroot holds extents
+      ushort nextents;       // records in eroot
+      struct extent eroot[NEXTENT_ROOT];
+    };
+  };
 };
 
 // Inodes per block.
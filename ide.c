@@ -1,4 +1,5 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.  Data moves by PIO, or by bus-master
+// DMA if the controller supports it and IDEDMA is set.
 
 #include "types.h"
 #include "defs.h"
@@ -13,6 +14,8 @@
 #include "fs.h"
 #include "buf.h"
 
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
 #define IDE_DRDY      0x40
@@ -23,15 +26,62 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+
+// Bus-master IDE registers, from the base in BAR4, primary channel.
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+#define BM_CMD_START  0x01
+#define BM_CMD_READ   0x08  // controller writes memory
+#define BM_ST_ERR     0x02
+#define BM_ST_INTR    0x04
+
+#define IDE_MAXMULT   16   // sectors per interrupt in multiple mode
+#define IDE_MAXSECT   256  // sectors per command
+#define IDE_MAXPASS   32   // times a request can be passed over
+
+// Position of a request's block, for ordering the queue.
+#define IDEPOS(b) ((b)->dev * FSSIZE + (b)->blockno)
 
 // idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+// idequeue->qnext points to the next buf to be processed; the
+// queue is kept in elevator order (see idequeue_add).
+// A command covers the first idenbuf bufs in the queue, which are
+// for consecutive blocks and all reads or all writes; idesect of
+// its sectors have been moved so far.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenbuf;
+static int idesect;
 
 static int havedisk1;
+static int vdisk1;      // disk 1 is a virtio block device
+static int idemult[2];  // sectors per interrupt for each disk
+
+// A physical region descriptor: one piece of a DMA transfer.
+struct prd {
+  uint addr;
+  ushort count;   // bytes; 0 means 64K
+  ushort flags;   // PRD_EOT on the last one
+};
+#define PRD_EOT 0x8000
+
+static int idedma;      // DMA in use?
+static ushort idebm;    // bus-master register base
+static struct prd ideprd[2*IDE_MAXSECT] __attribute__((aligned(4096)));
+
+// Counters for idestats().
+static struct {
+  uint nreq;      // requests done
+  uint ncmd;      // commands issued
+  uint wait;      // total ticks requests spent queued
+  uint maxwait;
+} idestat;
 static void idestart(struct buf*);
 
 // Wait for IDE disk to become ready.
@@ -47,6 +97,37 @@ idewait(int checkerr)
   return 0;
 }
 
+// Put disk d in multiple mode, so READ/WRITE MULTIPLE move
+// IDE_MAXMULT sectors per interrupt.  Without it, commands
+// move one sector per interrupt.
+static void
+idesetmult(int d)
+{
+  outb(0x3f6, 2);  // no interrupt
+  outb(0x1f6, 0xe0 | (d<<4));
+  outb(0x1f2, IDE_MAXMULT);
+  outb(0x1f7, IDE_CMD_SETMUL);
+  idemult[d] = idewait(1) < 0 ? 1 : IDE_MAXMULT;
+}
+
+// Find the PCI IDE controller and turn on bus-master DMA if it
+// has it; otherwise the driver stays with PIO.
+static void
+idedmainit(void)
+{
+  uint tag, bar;
+
+  if((tag = pcifindclass(0x01, 0x01)) == 0)
+    return;
+  bar = pciread(tag, 0x20);
+  if((bar & 1) == 0 || (bar & 0xfffc) == 0)
+    return;  // no bus-master registers
+  pcienable(tag);
+  idebm = bar & 0xfffc;
+  idedma = 1;
+  cprintf("ide: bus-master DMA at 0x%x\n", idebm);
+}
+
 void
 ideinit(void)
 {
@@ -55,6 +136,7 @@ ideinit(void)
   initlock(&idelock, "ide");
   ioapicenable(IRQ_IDE, ncpu - 1);
   idewait(0);
+  vdisk1 = virtioinit();
 
   // Check if disk 1 is present
   outb(0x1f6, 0xe0 | (1<<4));
@@ -65,35 +147,129 @@ ideinit(void)
     }
   }
 
+  if(havedisk1)
+    idesetmult(1);
+  idesetmult(0);
+  if(IDEDMA)
+    idedmainit();
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Move the next n sectors of the running command between the
+// disk and its bufs.  Caller must hold idelock.
+static void
+idexfer(int n)
+{
+  struct buf *b;
+  uchar *data;
+  int k;
+
+  for(; n > 0; n--, idesect++){
+    b = idequeue;
+    for(k = idesect / (BSIZE/SECTOR_SIZE); k > 0; k--)
+      b = b->qnext;
+    data = b->data + (idesect % (BSIZE/SECTOR_SIZE)) * SECTOR_SIZE;
+    if(b->flags & B_DIRTY)
+      outsl(0x1f0, data, SECTOR_SIZE/4);
+    else
+      insl(0x1f0, data, SECTOR_SIZE/4);
+  }
+}
+
+// Start a DMA command for the nsect sectors from sector, into
+// or out of the idenbuf bufs from b.  Caller must hold idelock.
+static void
+idedmastart(struct buf *b, int nsect, int sector)
+{
+  struct prd *p;
+  uint pa, end;
+  int i;
+
+  // Describe each buf's data, split where it crosses a 64K
+  // boundary, which one descriptor cannot.
+  p = ideprd;
+  for(i = 0; i < idenbuf; i++, b = b->qnext){
+    pa = V2P(b->data);
+    end = pa + BSIZE;
+    if((pa ^ (end - 1)) & ~0xffff){
+      p->addr = pa;
+      p->count = (end & ~0xffff) - pa;
+      p->flags = 0;
+      p++;
+      pa = end & ~0xffff;
+    }
+    p->addr = pa;
+    p->count = end - pa;
+    p->flags = 0;
+    p++;
+  }
+  p[-1].flags = PRD_EOT;
+  b = idequeue;
+
+  outl(idebm + BM_PRDT, V2P(ideprd));
+  outb(idebm + BM_STATUS, BM_ST_ERR | BM_ST_INTR);  // clear
+  outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_CMD_READ);
+
+  idewait(0);
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, nsect & 0xff);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+  outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+  outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_CMD_START);
+}
+
+// Start the request for b, together with the bufs queued after
+// it for the next blocks in the same direction.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *e;
+
   if(b == 0)
     panic("idestart");
   if(b->blockno >= FSSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int mult = idemult[b->dev&1];
+  int read_cmd = (mult == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (mult == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+
+  if (sector_per_block > IDE_MAXSECT) panic("idestart");
 
-  if (sector_per_block > 7) panic("idestart");
+  idenbuf = 1;
+  for(e = b; e->qnext != 0; e = e->qnext){
+    if((idenbuf+1) * sector_per_block > IDE_MAXSECT ||
+       e->qnext->dev != b->dev || e->qnext->blockno != e->blockno + 1 ||
+       (e->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+    idenbuf++;
+  }
+  idesect = 0;
+  idestat.ncmd++;
+
+  if(idedma){
+    idedmastart(b, idenbuf * sector_per_block, sector);
+    return;
+  }
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, (idenbuf * sector_per_block) & 0xff);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
   if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    idewait(0);
+    idexfer(min(mult, idenbuf * sector_per_block));
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -104,6 +280,8 @@ void
 ideintr(void)
 {
   struct buf *b;
+  void (*done)(struct buf*);
+  int n, nsect, st;
 
   // First queued buffer is the active request.
   acquire(&idelock);
@@ -112,16 +290,62 @@ ideintr(void)
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  nsect = idenbuf * (BSIZE/SECTOR_SIZE);
+  if(idedma){
+    st = inb(idebm + BM_STATUS);
+    if((st & BM_ST_INTR) == 0){
+      release(&idelock);
+      return;  // not from our command
+    }
+    outb(idebm + BM_CMD, 0);
+    outb(idebm + BM_STATUS, BM_ST_ERR | BM_ST_INTR);
+    if(idewait(1) < 0 || (st & BM_ST_ERR)){
+      // Give up on DMA and redo the command with PIO.
+      cprintf("ide: DMA failed, using PIO\n");
+      idedma = 0;
+      idestart(idequeue);
+      release(&idelock);
+      return;
+    }
+    idesect = nsect;
+  }
+
+  // Move the next sectors; if some are left, wait for the
+  // interrupt that says the disk is ready for them.
+  n = min(idemult[b->dev&1], nsect - idesect);
+  if(!(b->flags & B_DIRTY)){
+    // Read data if needed.
+    if(idewait(1) >= 0)
+      idexfer(n);
+    else
+      idesect += n;
+  }
+  if(idesect < nsect){
+    if(b->flags & B_DIRTY)
+      idexfer(n);
+    release(&idelock);
+    return;
+  }
+
+  // The command is done.
+  for(; idenbuf > 0; idenbuf--){
+    b = idequeue;
+    idequeue = b->qnext;
+    idestat.nreq++;
+    idestat.wait += ticks - b->qtime;
+    if(ticks - b->qtime > idestat.maxwait)
+      idestat.maxwait = ticks - b->qtime;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // Wake process waiting for this buf.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
+    if((done = b->done) != 0){
+      b->done = 0;
+      done(b);
+    }
+  }
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
@@ -130,39 +354,125 @@ ideintr(void)
   release(&idelock);
 }
 
-//PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Does a go after b in C-LOOK order, for a disk whose head
+// is at position head?  Requests at or past head go first, in
+// ascending order, then the ones before it, also ascending.
+static int
+ideafter(struct buf *a, struct buf *b, uint head)
 {
-  struct buf **pp;
+  int wa, wb;
 
-  if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
-  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
-  if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+  wa = IDEPOS(a) < head;
+  wb = IDEPOS(b) < head;
+  if(wa != wb)
+    return wa;
+  return IDEPOS(a) > IDEPOS(b);
+}
 
-  acquire(&idelock);  //DOC:acquire-lock
+// Add b to idequeue in C-LOOK order after the command in
+// progress, starting the disk if it is idle.  A request passed
+// over IDE_MAXPASS times keeps its place, so a stream of
+// requests ahead of it cannot starve it.
+// Caller must hold idelock.
+static void
+idequeue_add(struct buf *b)
+{
+  struct buf **pp, **start, *e;
+  uint head;
+  int i;
 
-  // Append b to idequeue.
   b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  b->qtime = ticks;
+  b->npass = 0;
+  if(idequeue == 0){
+    idequeue = b;
+    idestart(b);
+    return;
+  }
+
+  // Skip the command in progress.
+  pp = &idequeue;
+  e = 0;
+  for(i = 0; i < idenbuf; i++){
+    e = *pp;
+    pp = &e->qnext;
+  }
+  head = IDEPOS(e) + 1;
+
+  start = pp;
+  for(; *pp; pp = &(*pp)->qnext){
+    if((*pp)->npass >= IDE_MAXPASS)
+      start = &(*pp)->qnext;
+  }
+  for(pp = start; *pp && !ideafter(*pp, b, head); pp = &(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+  for(e = b->qnext; e; e = e->qnext)
+    e->npass++;
+}
 
-  // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+// Print disk queue counters.
+void
+idestats(void)
+{
+  cprintf("ide: %d requests in %d commands; queued %d ticks "
+          "in all, %d at most\n", idestat.nreq, idestat.ncmd,
+          idestat.wait, idestat.maxwait);
+  if(vdisk1)
+    virtiostats();
+}
 
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
+//PAGEBREAK!
+// Queue b for the disk and return without waiting.
+// If B_DIRTY is set, write b to disk, else read it.
+// When the transfer is done, ideintr() clears B_DIRTY, sets
+// B_VALID, and calls b->done(b) if it is set; the lock on b
+// passes to the hook, which runs holding idelock and so must not
+// start disk I/O.  Otherwise the caller must ide_wait(b)
+// before using b.
+void
+ide_submit(struct buf *b)
+{
+  if(b->dev == 1 && vdisk1){
+    virtio_submit(b);
+    return;
   }
+  if(!holdingsleep(&b->lock))
+    panic("ide_submit: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("ide_submit: nothing to do");
+  if(b->flags & B_DELAY)
+    panic("ide_submit: no disk block");
+  if(b->dev != 0 && !havedisk1)
+    panic("ide_submit: ide disk 1 not present");
 
+  acquire(&idelock);  //DOC:acquire-lock
+  idequeue_add(b);
+  release(&idelock);
+}
 
+// Wait for b, queued with ide_submit(), to finish.
+void
+ide_wait(struct buf *b)
+{
+  if(b->dev == 1 && vdisk1){
+    virtio_wait(b);
+    return;
+  }
+  acquire(&idelock);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+    sleep(b, &idelock);
+  }
   release(&idelock);
 }
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  ide_submit(b);
+  ide_wait(b);
+}
@@ -0,0 +1,11 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Print the kernel's file system I/O counters.
+int
+main(void)
+{
+  iostats();
+  exit();
+}
@@ -1,6 +1,8 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -17,20 +19,82 @@
 // A system call should call begin_op()/end_op() to mark
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
-// But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// Each op reserves log space for the blocks it may write:
+// MAXOPBLOCKS plus the bitmap blocks itrunc() may touch, or as
+// many as it asks for with begin_opn().
+// If the log cannot hold the reservation, begin_op() sleeps
+// until the last outstanding end_op() commits.
 //
 // The log is a physical re-do log containing disk blocks.
-// The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+// Each commit appends one record to the log:
+//   header blocks: LOGMAGIC, sequence number, count, checksum,
+//     then block #s for block A, B, C, ...
 //   block A
 //   block B
 //   block C
 //   ...
+// The checksum covers the header and the blocks, so the whole
+// record is written at once and is valid only if all of it got
+// to the disk; there is no separate commit or erase write.
+// Recovery replays valid records with consecutive sequence
+// numbers from the start of the log, stopping at the first
+// invalid one.  Once its records are installed, clear_log() ends
+// the chain with an empty record: file data is written in place,
+// and replaying an old record could undo such a write.
+// A logged block that begins with LOGMAGIC is logged with its
+// first word zeroed and LOGESC set in its header entry, so only
+// headers start with LOGMAGIC.
 // Log appends are synchronous.
+//
+// Committed blocks are not installed at once.  They stay pinned
+// in the cache (B_DIRTY, with B_CKPT marking them), and the log
+// fills with records.  When it runs short of space, or its oldest
+// record is CKPTTICKS old, the log thread waits for the
+// running transaction to commit, writes every B_CKPT block home
+// from the cache, ends the chain with clear_log(), and starts the
+// log again from the beginning.
+//
+// In ordered mode (ORDERED), file data is not logged:
+// log_data() puts a block on the transaction's data list, and
+// commit() writes those blocks in place, and waits for them,
+// before it writes the record.  So only inodes, bitmap blocks,
+// directories and block-map or extent-tree nodes are written
+// twice, and committed metadata never points at data that did
+// not reach the disk.  A block in a record that recovery would
+// replay (B_CKPT) is logged rather than written in place, or the
+// replay would clobber it.
+//
+// With delayed allocation, writes to new file blocks stay in the
+// buffer cache with no disk block (B_DELAY), and log space is
+// set aside for them with log_delay().  The last outstanding
+// end_op() calls delalloc() to give them disk blocks, and log
+// them, before the transaction commits.
+//
+// Group commit: when processes are using the file system at the
+// same time, the last op out of a transaction does not commit at
+// once but waits for another op to join, which then takes over.
+// A transaction is closed to new ops, and so commits when its ops
+// drain, once it holds COMMITBLOCKS blocks or has been open for
+// COMMITTICKS ticks (see log_tick()).  A lone process commits at
+// the end of each op, as before.
+//
+// With LAZYCOMMIT, end_op() does not commit, and a transaction
+// stays open between ops until it is closed: by size, by time,
+// for log space, or by log_sync().  If no op is running then, the
+// log thread commits it.  An op that needs its changes on disk
+// (fsync(), or a write to an O_SYNC file) calls log_sync() with
+// the transaction that made them.
+
+// The number of header blocks and of blocks the log can hold
+// follow from the superblock's nlog (see LOGHEADS in fs.h).
 
-// Contents of the header block, used for both the on-disk header block
+// Contents of the header, used for both the on-disk header blocks
 // and to keep track in memory of logged block# before commit.
+#define NLOGIO 8  // log block writes in flight at once
+#define LOGMAGIC 0x6c6f6721  // first word of a record header
+#define LOGESC   0x80000000  // in a header entry: block began with LOGMAGIC
+#define NLOGFREE 16          // freed runs remembered per transaction
+
 struct logheader {
   int n;
   int block[LOGSIZE];
@@ -40,164 +104,668 @@ struct log {
   struct spinlock lock;
   int start;
   int size;
+  int cap;         // blocks a transaction may log
+  int opblocks;    // blocks begin_op() reserves
+  uint seq;        // sequence number of the next record
+  int tail;        // log blocks used by records not yet installed
+  int nckpt;       // distinct blocks in those records
+  int ckpt[LOGSIZE];
+  uint ckptstart;  // ticks when the first of them committed
+  int ckptwant;    // log thread should checkpoint
+  uint txn;        // number of the open transaction
+  uint done;       // number of the last committed one
   int outstanding; // how many FS sys calls are executing.
+  int reserved;    // log blocks reserved by them
   int committing;  // in commit(), please wait.
+  int ndelayed;    // log blocks set aside for delayed writes
+  int closed;      // no new ops; commit when the current ones end
+  int lingering;   // last op waiting for company before commit
+  uint txstart;    // ticks when the transaction's first op began
+  int nops;        // ops in the transaction
+  int lastpid;     // process of the latest op
+  int shared;      // ops from more than one process?
   int dev;
   struct logheader lh;
+  int ndata;       // file data blocks to write in place
+  int data[LOGSIZE];
+  int nfree;       // runs of blocks freed in the transaction
+  struct {
+    uint start;
+    uint len;
+  } freed[NLOGFREE];
 };
 struct log log;
 
+// Counters for logstats().
+static struct {
+  uint ncommit;    // commits with blocks to write
+  uint nblock;     // blocks they wrote
+  uint nop;        // ops they held
+  uint maxblock;
+  uint wait;       // total ticks from first op to commit
+  uint maxwait;
+  uint write;      // total ticks spent in commit()
+  uint ntimeout;   // transactions closed by COMMITTICKS
+  uint ndata;      // file data blocks written in place
+  uint nckpt;      // checkpoints
+  uint nckptblock; // blocks they installed
+} logstat;
+
 static void recover_from_log(void);
 static void commit();
+static void logthread(void);
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
+  log.cap = log.size - LOGHEADS(sb.nlog);
+  if(log.cap > LOGSIZE)
+    log.cap = LOGSIZE;
+  // Any op may end up in itrunc(), which can free blocks
+  // under every bitmap block.
+  log.opblocks = MAXOPBLOCKS + sb.size/BPB + 1;
+  if(log.cap < 3*log.opblocks || log.cap < 2*MAXWRITEBLOCKS)
+    panic("initlog: log too small");
   log.dev = dev;
   recover_from_log();
+  log.txn = 1;
+  kthread("log", logthread);
 }
 
-// Copy committed blocks from log to their home location
-static void
-install_trans(void)
+// Header blocks in a record of n blocks.
+static int
+nheads(int n)
 {
-  int tail;
+  return (LOGHDR + n + LOGHPB - 1) / LOGHPB;
+}
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+// Is there no room after log.tail for a record of n blocks,
+// or in log.ckpt for its blocks?
+static int
+logfull(int n)
+{
+  return n > log.cap || log.tail + nheads(n) + n > log.size ||
+         log.nckpt + n > LOGSIZE;
+}
+
+// Add n bytes at p to a running checksum.
+static uint
+logsum(uint sum, void *p, int n)
+{
+  uint *w = p;
+  for (; n > 0; n -= sizeof(uint))
+    sum = (sum ^ *w++) * 16777619;
+  return sum;
+}
+
+// Add logged block data, with its first word zeroed if esc,
+// to a running checksum.
+static uint
+blocksum(uint sum, uchar *data, int esc)
+{
+  uint zero = 0;
+  sum = logsum(sum, esc ? (void*)&zero : (void*)data, sizeof(uint));
+  return logsum(sum, data + sizeof(uint), BSIZE - sizeof(uint));
+}
+
+// Header int k of the in-memory header, for a record with
+// sequence number seq and checksum sum.
+static uint
+headint(int k, uint seq, uint sum)
+{
+  switch (k) {
+  case 0: return LOGMAGIC;
+  case 1: return seq;
+  case 2: return log.lh.n;
+  case 3: return sum;
+  }
+  return log.lh.block[k - LOGHDR];
+}
+
+// Checksum of the in-memory header, taking sum as the checksum
+// of its blocks.
+static uint
+headsum(uint seq, uint sum)
+{
+  uint w;
+  int k;
+  for (k = 0; k < LOGHDR + log.lh.n; k++) {
+    w = k == 3 ? 0 : headint(k, seq, sum);
+    sum = logsum(sum, &w, sizeof(w));
   }
+  return sum;
 }
 
-// Read the log header from disk into the in-memory log header
+// Copy committed blocks from the record whose blocks start at
+// log block data to their home location, NLOGIO writes at a time.
 static void
-read_head(void)
+install_trans(int data)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-  log.lh.n = lh->n;
+  struct buf *dbuf[NLOGIO];
+  int tail, i, n;
+
+  for (tail = 0; tail < log.lh.n; tail += n) {
+    n = log.lh.n - tail;
+    if (n > NLOGIO)
+      n = NLOGIO;
+    for (i = 0; i < n; i++) {
+      struct buf *lbuf = bread(log.dev, log.start+data+tail+i); // read log block
+      dbuf[i] = bread(log.dev, log.lh.block[tail+i] & ~LOGESC); // read dst
+      memmove(dbuf[i]->data, lbuf->data, BSIZE);  // copy block to dst
+      if (log.lh.block[tail+i] & LOGESC)
+        *(uint*)dbuf[i]->data = LOGMAGIC;
+      brelse(lbuf);
+      bwrite_async(dbuf[i]);  // start writing dst to disk
+    }
+    for (i = 0; i < n; i++) {
+      bwait(dbuf[i]);
+      brelse(dbuf[i]);
+    }
+  }
+}
+
+// Read the header of the record at log block pos into the
+// in-memory log header.  Returns its sequence number in *seq,
+// or -1 if there is no valid record there.
+static int
+read_head(int pos, uint *seq)
+{
+  struct buf *buf;
+  uint *h, sum, want;
+  int i, k;
+
+  if (pos + 1 >= log.size)
+    return -1;
+  buf = bread(log.dev, log.start + pos);
+  h = (uint *) (buf->data);
+  log.lh.n = h[2];
+  if (h[0] != LOGMAGIC || h[2] > log.cap || pos + nheads(h[2]) + h[2] > log.size) {
+    log.lh.n = 0;
+    brelse(buf);
+    return -1;
+  }
+  *seq = h[1];
+  want = h[3];
   for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+    k = LOGHDR + i;
+    if (k % LOGHPB == 0) {
+      brelse(buf);
+      buf = bread(log.dev, log.start + pos + k/LOGHPB);
+      h = (uint *) (buf->data);
+    }
+    log.lh.block[i] = h[k % LOGHPB];
   }
   brelse(buf);
+
+  // Check the blocks and header against the checksum.
+  sum = 0;
+  for (i = 0; i < log.lh.n; i++) {
+    buf = bread(log.dev, log.start + pos + nheads(log.lh.n) + i);
+    sum = logsum(sum, buf->data, BSIZE);
+    brelse(buf);
+  }
+  if (headsum(*seq, sum) != want) {
+    log.lh.n = 0;
+    return -1;
+  }
+  return 0;
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
+// Fill header block j of a record with sequence number seq and
+// checksum sum from the in-memory header.
 static void
-write_head(void)
+fill_head(struct buf *buf, int j, uint seq, uint sum)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
-  }
+  uint *h = (uint *) (buf->data);
+  int k;
+  for (k = j*LOGHPB; k < (j+1)*LOGHPB && k < LOGHDR + log.lh.n; k++)
+    h[k - j*LOGHPB] = headint(k, seq, sum);
+}
+
+// Write an empty record at the start of the log, so recovery
+// replays nothing that was there before.  Every block in the
+// log's records must be installed.
+static void
+clear_log(void)
+{
+  struct buf *buf;
+
+  log.lh.n = 0;
+  buf = bread(log.dev, log.start);
+  memset(buf->data, 0, BSIZE);
+  fill_head(buf, 0, log.seq, headsum(log.seq, 0));
   bwrite(buf);
   brelse(buf);
+  log.seq++;
 }
 
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  struct buf *buf;
+  uint seq, prev = 0;
+  int pos, i;
+
+  // Number new records past any in the log.
+  log.seq = 0;
+  for (i = 0; i < log.size; i++) {
+    buf = bread(log.dev, log.start + i);
+    if (((uint*)buf->data)[0] == LOGMAGIC && ((uint*)buf->data)[1] >= log.seq)
+      log.seq = ((uint*)buf->data)[1] + 1;
+    brelse(buf);
+  }
+
+  // Replay the chain of valid records.
+  for (pos = 0; read_head(pos, &seq) == 0; pos += nheads(log.lh.n) + log.lh.n) {
+    if (pos > 0 && seq != prev + 1)
+      break;
+    install_trans(pos + nheads(log.lh.n)); // committed, copy from log to disk
+    prev = seq;
+  }
+  clear_log();
 }
 
 // called at the start of each FS system call.
 void
 begin_op(void)
 {
+  begin_opn(log.opblocks);
+}
+
+// Like begin_op(), for an op that may write up to n blocks.
+void
+begin_opn(int n)
+{
+  if(n > log.cap)
+    panic("begin_opn: too many blocks");
+
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.committing || log.closed){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    } else if(logfull(log.lh.n + log.ndata + log.ndelayed +
+                      log.reserved + n)){
+      // this op might exhaust log space; close the transaction
+      // and wait for it to commit and the log to be checkpointed.
+      log.closed = 1;
+      if(log.tail > 0)
+        log.ckptwant = 1;
+      wakeup(&log.lingering);
+      wakeup(&log);  // the log thread, if no op is running
       sleep(&log, &log.lock);
     } else {
+      if(log.nops == 0){
+        log.txstart = ticks;
+        log.shared = 0;
+      } else if(myproc()->pid != log.lastpid){
+        log.shared = 1;
+      }
+      log.lastpid = myproc()->pid;
+      log.nops++;
       log.outstanding += 1;
+      log.reserved += n;
+      myproc()->logres = n;
+      if(log.lingering)
+        wakeup(&log.lingering);  // hand the commit to this op
       release(&log.lock);
       break;
     }
   }
 }
 
+// Should the last op of the transaction wait for others to join
+// before committing?  Caller must hold log.lock.
+static int
+linger(void)
+{
+  if(log.lh.n + log.ndata + log.ndelayed >= COMMITBLOCKS)
+    log.closed = 1;
+  return !LAZYCOMMIT && log.shared && !log.closed &&
+         log.lh.n + log.ndata + log.ndelayed > 0;
+}
+
+// Commit the transaction.  Caller holds log.lock, and no op or
+// commit may be running; the lock is dropped during the commit.
+static void
+logcommit(void)
+{
+  uint t;
+
+  log.committing = 1;
+  t = ticks;
+  logstat.ndata += log.ndata;
+  if(log.lh.n > 0){
+    logstat.ncommit++;
+    logstat.nblock += log.lh.n;
+    logstat.nop += log.nops;
+    if(log.lh.n > logstat.maxblock)
+      logstat.maxblock = log.lh.n;
+    logstat.wait += t - log.txstart;
+    if(t - log.txstart > logstat.maxwait)
+      logstat.maxwait = t - log.txstart;
+  }
+  // call commit w/o holding locks, since not allowed
+  // to sleep with locks.
+  release(&log.lock);
+  commit();
+  acquire(&log.lock);
+  logstat.write += ticks - t;
+  log.committing = 0;
+  log.closed = log.ckptwant;  // let the checkpoint go first
+  log.nops = 0;
+  log.done = log.txn++;
+  wakeup(&log);
+}
+
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// commits if this was the last outstanding operation,
+// unless LAZYCOMMIT leaves the transaction open.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
+  // The op's blocks are in the transaction now, or set aside
+  // with log_delay(); it no longer needs its reservation.
+  log.reserved -= myproc()->logres;
+  myproc()->logres = 0;
+  if(log.outstanding == 1 && linger()){
+    log.lingering = 1;
+    while(log.outstanding == 1 && !log.closed)
+      sleep(&log.lingering, &log.lock);
+    log.lingering = 0;
+  }
+  // The last op out allocates blocks for delayed writes while
+  // still inside the transaction, now that each file's whole
+  // dirty run is known.
+  while(log.outstanding == 1 && log.ndelayed > 0){
+    release(&log.lock);
+    delalloc();
+    acquire(&log.lock);
+  }
   log.outstanding -= 1;
   if(log.committing)
     panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
+  if(log.outstanding == 0 && (log.closed || !LAZYCOMMIT)){
+    logcommit();
   } else {
     // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
+    // and this op's reservation has been given back.
     wakeup(&log);
   }
   release(&log.lock);
+  iputorphans();
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
+// Number of the open transaction.  During an op, the one the
+// op's changes will commit with.
+uint
+log_txn(void)
+{
+  uint t;
+
+  acquire(&log.lock);
+  t = log.txn;
+  release(&log.lock);
+  return t;
+}
+
+// Wait until transaction t, and every one before it, has
+// committed, closing it if it is still open.  Must not be
+// called inside an op.
+void
+log_sync(uint t)
+{
+  acquire(&log.lock);
+  while(log.done < t){
+    if(log.txn == t && !log.closed){
+      log.closed = 1;
+      wakeup(&log.lingering);
+    }
+    if(log.txn == t && log.outstanding == 0 && !log.committing)
+      logcommit();
+    else
+      sleep(&log, &log.lock);
+  }
+  release(&log.lock);
+}
+
+// Return whether transaction t has committed.
+int
+log_committed(uint t)
+{
+  int r;
+
+  acquire(&log.lock);
+  r = log.done >= t;
+  release(&log.lock);
+  return r;
+}
+
+// Called on each timer tick: close a transaction that has been
+// open for COMMITTICKS, so that it commits once its ops end.
+void
+log_tick(void)
+{
+  acquire(&log.lock);
+  if(log.nops > 0 && !log.closed && !log.committing &&
+     ticks - log.txstart >= COMMITTICKS){
+    log.closed = 1;
+    logstat.ntimeout++;
+    wakeup(&log.lingering);
+    wakeup(&log);
+  }
+  if(log.tail > 0 && !log.ckptwant && ticks - log.ckptstart >= CKPTTICKS){
+    log.ckptwant = 1;
     wakeup(&log);
-    release(&log.lock);
   }
+  release(&log.lock);
+}
+
+// Print commit counters.
+void
+logstats(void)
+{
+  cprintf("log: %d commits of %d blocks (%d at most) for %d ops; "
+          "%d closed by time\n", logstat.ncommit, logstat.nblock,
+          logstat.maxblock, logstat.nop, logstat.ntimeout);
+  cprintf("log: open %d ticks in all, %d at most; %d ticks "
+          "writing\n", logstat.wait, logstat.maxwait, logstat.write);
+  cprintf("log: %d data blocks written in place\n", logstat.ndata);
+  cprintf("log: %d checkpoints installed %d blocks\n", logstat.nckpt,
+          logstat.nckptblock);
 }
 
-// Copy modified blocks from cache to log.
+// Set aside n blocks of log space for delayed writes, or
+// give back -n of them.
+void
+log_delay(int n)
+{
+  acquire(&log.lock);
+  log.ndelayed += n;
+  if(log.ndelayed < 0)
+    panic("log_delay");
+  if(n < 0)
+    wakeup(&log);
+  release(&log.lock);
+}
+
+// Write the transaction to the log as one record, header blocks
+// first, NLOGIO writes at a time.  The record is valid once all
+// of its writes are done.
 static void
 write_log(void)
 {
-  int tail;
+  struct buf *to[NLOGIO], *from;
+  int nh, tail, i, k, n;
+  uint sum;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+  // Checksum the blocks as they will appear in the log.
+  sum = 0;
+  for (i = 0; i < log.lh.n; i++) {
+    from = bread(log.dev, log.lh.block[i]);
+    if (*(uint*)from->data == LOGMAGIC)
+      log.lh.block[i] |= LOGESC;
+    sum = blocksum(sum, from->data, log.lh.block[i] & LOGESC);
     brelse(from);
-    brelse(to);
   }
+  sum = headsum(log.seq, sum);
+
+  nh = nheads(log.lh.n);
+  if (log.tail + nh + log.lh.n > log.size)
+    panic("write_log: log full");
+  for (tail = 0; tail < nh + log.lh.n; tail += n) {
+    n = nh + log.lh.n - tail;
+    if (n > NLOGIO)
+      n = NLOGIO;
+    for (i = 0; i < n; i++) {
+      k = tail + i;
+      to[i] = bread(log.dev, log.start+log.tail+k); // log block
+      if (k < nh) {
+        fill_head(to[i], k, log.seq, sum);
+      } else {
+        from = bread(log.dev, log.lh.block[k-nh] & ~LOGESC); // cache block
+        memmove(to[i]->data, from->data, BSIZE);
+        brelse(from);
+        if (log.lh.block[k-nh] & LOGESC)
+          *(uint*)to[i]->data = 0;
+      }
+      bwrite_async(to[i]);  // start writing the log
+    }
+    for (i = 0; i < n; i++) {
+      bwait(to[i]);
+      brelse(to[i]);
+    }
+  }
+}
+
+// Write the transaction's file data blocks in place, in block
+// order, NLOGIO writes at a time.
+static void
+write_data(void)
+{
+  struct buf *to[NLOGIO];
+  int tail, i, j, n, t;
+
+  for (i = 1; i < log.ndata; i++) {
+    t = log.data[i];
+    for (j = i; j > 0 && log.data[j-1] > t; j--)
+      log.data[j] = log.data[j-1];
+    log.data[j] = t;
+  }
+  for (tail = 0; tail < log.ndata; tail += n) {
+    n = log.ndata - tail;
+    if (n > NLOGIO)
+      n = NLOGIO;
+    for (i = 0; i < n; i++) {
+      to[i] = bread(log.dev, log.data[tail+i]);
+      bwrite_async(to[i]);
+    }
+    for (i = 0; i < n; i++) {
+      bwait(to[i]);
+      brelse(to[i]);
+    }
+  }
+  log.ndata = 0;
 }
 
 static void
 commit()
 {
+  struct buf *b;
+  int i;
+
+  write_data();      // File data first, in place
+  log.nfree = 0;
   if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+    write_log();     // Write the record -- the real commit
+    // Leave the blocks pinned for checkpoint() to install.
+    for (i = 0; i < log.lh.n; i++) {
+      b = bread(log.dev, log.lh.block[i] & ~LOGESC);
+      if ((b->flags & B_CKPT) == 0) {
+        b->flags |= B_CKPT;
+        log.ckpt[log.nckpt++] = b->blockno;
+      }
+      brelse(b);
+    }
+    if (log.tail == 0)
+      log.ckptstart = ticks;
+    log.tail += nheads(log.lh.n) + log.lh.n;
     log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+    log.seq++;
+  }
+}
+
+// Write every block in the log's records home from the cache,
+// in block order, NLOGIO writes at a time, and empty the log.
+// No transaction may be running, so the cached blocks hold
+// exactly what was committed.
+static void
+checkpoint(void)
+{
+  struct buf *to[NLOGIO];
+  int tail, i, j, n, t;
+
+  for (i = 1; i < log.nckpt; i++) {
+    t = log.ckpt[i];
+    for (j = i; j > 0 && log.ckpt[j-1] > t; j--)
+      log.ckpt[j] = log.ckpt[j-1];
+    log.ckpt[j] = t;
+  }
+  for (tail = 0; tail < log.nckpt; tail += n) {
+    n = log.nckpt - tail;
+    if (n > NLOGIO)
+      n = NLOGIO;
+    for (i = 0; i < n; i++) {
+      to[i] = bread(log.dev, log.ckpt[tail+i]);
+      to[i]->flags &= ~B_CKPT;
+      bwrite_async(to[i]);
+    }
+    for (i = 0; i < n; i++) {
+      bwait(to[i]);
+      brelse(to[i]);
+    }
+  }
+  clear_log();  // before anything is written in place again
+  logstat.nckpt++;
+  logstat.nckptblock += log.nckpt;
+  log.nckpt = 0;
+  log.tail = 0;
+}
+
+// The log thread.  It commits a closed transaction that no op
+// is running in, and checkpoints when asked: it closes the open
+// transaction, waits for it to commit, and checkpoints while new
+// transactions wait in begin_op().
+static void
+logthread(void)
+{
+  acquire(&log.lock);
+  for (;;) {
+    if (log.committing || log.outstanding > 0) {
+      if (log.ckptwant && log.outstanding > 0 && !log.closed) {
+        log.closed = 1;
+        wakeup(&log.lingering);
+      }
+      sleep(&log, &log.lock);
+    } else if (log.nops > 0 && (log.closed || log.ckptwant)) {
+      logcommit();
+    } else if (log.ckptwant) {
+      log.committing = 1;
+      log.ckptwant = 0;
+      release(&log.lock);
+      checkpoint();
+      acquire(&log.lock);
+      log.committing = 0;
+      log.closed = 0;
+      wakeup(&log);
+    } else {
+      sleep(&log, &log.lock);
+    }
   }
 }
 
@@ -215,16 +783,25 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
-    panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
   acquire(&log.lock);
+  // A block on the data list is metadata now.
+  for (i = 0; i < log.ndata; i++) {
+    if (log.data[i] == b->blockno) {
+      log.data[i] = log.data[--log.ndata];
+      break;
+    }
+  }
   for (i = 0; i < log.lh.n; i++) {
     if (log.lh.block[i] == b->blockno)   // log absorbtion
       break;
   }
+  // An op that logs more than it reserved would run past the
+  // log's free space, over the blocks after the log.
+  if (i == log.lh.n && logfull(log.lh.n + log.ndata + 1))
+    panic("too big a transaction");
   log.lh.block[i] = b->blockno;
   if (i == log.lh.n)
     log.lh.n++;
@@ -232,3 +809,81 @@ log_write(struct buf *b)
   release(&log.lock);
 }
 
+
+// Was block b freed earlier in this transaction?  If the freed
+// runs did not all fit in log.freed, assume so.
+// Caller must hold log.lock.
+static int
+log_freed(uint b)
+{
+  int i;
+
+  if (log.nfree > NLOGFREE)
+    return 1;
+  for (i = 0; i < log.nfree; i++) {
+    if (b >= log.freed[i].start && b < log.freed[i].start + log.freed[i].len)
+      return 1;
+  }
+  return 0;
+}
+
+// Caller has freed the n blocks from b in this transaction.
+void
+log_free(uint b, uint n)
+{
+  int i;
+
+  acquire(&log.lock);
+  for (i = 0; i < log.nfree && i < NLOGFREE; i++) {
+    if (log.freed[i].start + log.freed[i].len == b) {
+      log.freed[i].len += n;
+      break;
+    }
+  }
+  if (i == log.nfree && log.nfree++ < NLOGFREE) {
+    log.freed[i].start = b;
+    log.freed[i].len = n;
+  }
+  release(&log.lock);
+}
+
+// Like log_write(), for a block of file data.  In ordered mode
+// commit() writes the block in place before the record, and it
+// is not logged; if it was logged as metadata earlier in this
+// transaction, that is revoked.  A block freed earlier in the
+// transaction is logged after all: written in place, it could
+// clobber the data of its old owner if we crash before commit.
+// So is a block still in a record awaiting checkpoint, which
+// recovery would replay over it.
+void
+log_data(struct buf *b)
+{
+  int i;
+
+  if (log.outstanding < 1)
+    panic("log_data outside of trans");
+
+  acquire(&log.lock);
+  if (!ORDERED || (b->flags & B_CKPT) || log_freed(b->blockno)) {
+    release(&log.lock);
+    log_write(b);
+    return;
+  }
+  for (i = 0; i < log.lh.n; i++) {
+    if (log.lh.block[i] == b->blockno) {
+      log.lh.block[i] = log.lh.block[--log.lh.n];
+      break;
+    }
+  }
+  for (i = 0; i < log.ndata; i++) {
+    if (log.data[i] == b->blockno)
+      break;
+  }
+  if (i == log.ndata && logfull(log.lh.n + log.ndata + 1))
+    panic("too big a transaction");
+  log.data[i] = b->blockno;
+  if (i == log.ndata)
+    log.ndata++;
+  b->flags |= B_DIRTY; // prevent eviction
+  release(&log.lock);
+}
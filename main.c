@@ -37,6 +37,7 @@ main(void)
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit2();        // size buffer cache from free memory
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 
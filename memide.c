@@ -32,22 +32,22 @@ ideintr(void)
   // no-op
 }
 
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Do the transfer for b at once; the memory disk needs no queue.
+// Calls b->done(b) afterward if it is set, as ide.c would.
 void
-iderw(struct buf *b)
+ide_submit(struct buf *b)
 {
   uchar *p;
+  void (*done)(struct buf*);
 
   if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
+    panic("ide_submit: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
+    panic("ide_submit: nothing to do");
   if(b->dev != 1)
-    panic("iderw: request not for disk 1");
+    panic("ide_submit: request not for disk 1");
   if(b->blockno >= disksize)
-    panic("iderw: block out of range");
+    panic("ide_submit: block out of range");
 
   p = memdisk + b->blockno*BSIZE;
 
@@ -57,4 +57,28 @@ iderw(struct buf *b)
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  if((done = b->done) != 0){
+    b->done = 0;
+    done(b);
+  }
+}
+
+// Nothing to wait for; ide_submit() has finished the transfer.
+void
+ide_wait(struct buf *b)
+{
+}
+
+void
+idestats(void)
+{
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  ide_submit(b);
 }
@@ -22,7 +22,7 @@
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+int nlog;
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -82,6 +82,8 @@ main(int argc, char *argv[])
   }
 
   assert((BSIZE % sizeof(struct dinode)) == 0);
+  // The extent root of a T_EXTENT inode shares space with addrs.
+  assert(sizeof(struct dinode) == 12 + sizeof(uint)*(NDIRECT+2));
   assert((BSIZE % sizeof(struct dirent)) == 0);
 
   fsfd = open(argv[1], O_RDWR|O_CREAT|O_TRUNC, 0666);
@@ -90,6 +92,10 @@ main(int argc, char *argv[])
     exit(1);
   }
 
+  // Room for LOGSIZE blocks after the log header.
+  for(nlog = LOGSIZE; nlog - LOGHEADS(nlog) < LOGSIZE; nlog++)
+    ;
+
   // 1 fs block = 1 disk sector
   nmeta = 2 + nlog + ninodeblocks + nbitmap;
   nblocks = FSSIZE - nmeta;
@@ -228,6 +234,8 @@ ialloc(ushort type)
 
   bzero(&din, sizeof(din));
   din.type = xshort(type);
+  if(type == T_EXTENT)
+    din.eversion = EXTENT_VERSION;
   din.nlink = xshort(1);
   din.size = xint(0);
   winode(inum, &din);
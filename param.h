@@ -8,7 +8,16 @@
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define LOGSIZE      (MAXOPBLOCKS*100)  // max data blocks in on-disk log
+#define MAXWRITEBLOCKS (LOGSIZE/4)  // max log blocks one write() op reserves
+#define COMMITBLOCKS (LOGSIZE/2)  // close a transaction with this many blocks
+#define COMMITTICKS   10  // or once it has been open this many ticks
+#define CKPTTICKS    100  // install committed blocks at most this late
+#define LAZYCOMMIT    1  // end_op() leaves the commit for later; see log_sync()
+#define NBUF         (LOGSIZE+MAXOPBLOCKS*3)  // minimum size of disk block cache
+#define NBUFMAX      4096  // boot-time cap on disk block cache size
+#define DELALLOC      1  // choose data blocks of file writes at commit
+#define ORDERED       1  // journal metadata only; write file data in place
+#define IDEDMA        1  // use bus-master DMA for IDE if the controller has it
 #define FSSIZE       200000  // size of file system in blocks
 
@@ -0,0 +1,74 @@
+// PCI configuration space access, through I/O ports 0xCF8 and
+// 0xCFC (configuration mechanism #1).
+//
+// A device is named by its tag, the value of the address port
+// for its function with register 0.  Only bus 0 is searched,
+// which is where QEMU's PC machine puts its devices.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PCI_ADDR 0xCF8
+#define PCI_DATA 0xCFC
+
+#define PCITAG(bus, dev, func) \
+  (0x80000000 | ((bus) << 16) | ((dev) << 11) | ((func) << 8))
+
+// Read the 32-bit configuration register at offset off.
+uint
+pciread(uint tag, int off)
+{
+  outl(PCI_ADDR, tag | (off & 0xfc));
+  return inl(PCI_DATA);
+}
+
+// Write the 32-bit configuration register at offset off.
+void
+pciwrite(uint tag, int off, uint v)
+{
+  outl(PCI_ADDR, tag | (off & 0xfc));
+  outl(PCI_DATA, v);
+}
+
+// Return the tag of the first function on bus 0 for which
+// register off, masked with mask, equals val; 0 if none.
+static uint
+pcimatch(int off, uint mask, uint val)
+{
+  uint tag;
+  int dev, func;
+
+  for(dev = 0; dev < 32; dev++){
+    for(func = 0; func < 8; func++){
+      tag = PCITAG(0, dev, func);
+      if((pciread(tag, 0x00) & 0xffff) == 0xffff)
+        continue;  // no such function
+      if((pciread(tag, off) & mask) == val)
+        return tag;
+    }
+  }
+  return 0;
+}
+
+// Find a device by vendor and device id.
+uint
+pcifind(uint vendor, uint device)
+{
+  return pcimatch(0x00, 0xffffffff, (device << 16) | vendor);
+}
+
+// Find a device by class and subclass.
+uint
+pcifindclass(uint class, uint subclass)
+{
+  return pcimatch(0x08, 0xffff0000, (class << 24) | (subclass << 16));
+}
+
+// Let the device respond to I/O and memory accesses and
+// master the bus.
+void
+pcienable(uint tag)
+{
+  pciwrite(tag, 0x04, pciread(tag, 0x04) | 0x7);
+}
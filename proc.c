@@ -151,6 +151,28 @@ found:
   return p;
 }
 
+// Start a kernel thread running fn(), which must not return.
+// It has no user memory: forkret() "returns" into fn in place
+// of trapret.
+void
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    panic("kthread");
+  if((p->pgdir = setupkvm()) == 0)
+    panic("kthread: out of memory");
+  *(uint*)((char*)p->tf - 4) = (uint)fn;
+  p->parent = initproc;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  p->priority = DEFAULT_PRIORITY;
+  release(&ptable.lock);
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -742,8 +764,8 @@ forkret(void)
     // of a regular process (e.g., they call sleep), and thus cannot
     // be run from main().
     first = 0;
-    iinit(ROOTDEV);
     initlog(ROOTDEV);
+    iinit(ROOTDEV);  // after recovery: it counts free blocks
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -53,6 +53,8 @@ struct proc {
   uint pEndTime;	       // End uptime for the process
   uint pUptime;		       // The total uptime for the process
   int priority;		       // JTM - Process priority, where highest priority is 1.
+  int logres;                  // log blocks reserved by the current FS op
+  uint bcredit;                // promised disk blocks it is allocating (fs.c)
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -0,0 +1,1356 @@
+
+_stat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "syscall.h"
+#include "fcntl.h"
+
+// start main()
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec e0 00 00 00    	sub    $0xe0,%esp
+  17:	8b 71 04             	mov    0x4(%ecx),%esi
+    int fileDescriptor;
+    struct stat statObj;
+    // char buf[512];
+
+    // User program stat: can be called like this: stat pathname
+    if((fileDescriptor = open(argv[1], O_RDONLY)) < 0) {
+  1a:	6a 00                	push   $0x0
+  1c:	ff 76 04             	push   0x4(%esi)
+  1f:	e8 4f 04 00 00       	call   473 <open>
+  24:	83 c4 10             	add    $0x10,%esp
+  27:	85 c0                	test   %eax,%eax
+  29:	0f 88 8b 00 00 00    	js     ba <main+0xba>
+  2f:	89 c3                	mov    %eax,%ebx
+            printf(1, "stat failed: Cannot read file: %s\n", argv[1]);
+            exit();
+    }
+
+    if(fstat(fileDescriptor, &statObj) < 0) {
+  31:	8d bd 18 ff ff ff    	lea    -0xe8(%ebp),%edi
+  37:	50                   	push   %eax
+  38:	50                   	push   %eax
+  39:	57                   	push   %edi
+  3a:	53                   	push   %ebx
+  3b:	e8 4b 04 00 00       	call   48b <fstat>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	85 c0                	test   %eax,%eax
+  45:	78 56                	js     9d <main+0x9d>
+            printf(1, "stat failed: Cannot get status information about: %s\n", argv[1]);
+            close(fileDescriptor);
+            exit();
+    }
+
+   printf(1, "Printing out stat information for: %s\n", argv[1]);
+  47:	50                   	push   %eax
+  48:	ff 76 04             	push   0x4(%esi)
+  4b:	68 54 09 00 00       	push   $0x954
+  50:	6a 01                	push   $0x1
+  52:	e8 79 05 00 00       	call   5d0 <printf>
+
+
+   if(statObj.type == 1) {
+  57:	0f b7 85 18 ff ff ff 	movzwl -0xe8(%ebp),%eax
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	66 83 f8 01          	cmp    $0x1,%ax
+  65:	74 68                	je     cf <main+0xcf>
+       printf(1, "type: %s\n", "Directory");
+       printf(1, "size: %d\n", statObj.size);
+    } else if(statObj.type == 3) {
+  67:	66 83 f8 03          	cmp    $0x3,%ax
+  6b:	0f 84 8a 00 00 00    	je     fb <main+0xfb>
+       printf(1, "type: %s\n", "Device");
+       printf(1, "size: %d\n", statObj.size);
+    } else if(statObj.type == 4) {
+  71:	66 83 f8 04          	cmp    $0x4,%ax
+  75:	0f 84 88 00 00 00    	je     103 <main+0x103>
+       printf(1, "type: %s\n", "Symlink");    
+       printf(1, "size: %d\n", statObj.size);
+    } else if(statObj.type == 5) {
+  7b:	66 83 f8 05          	cmp    $0x5,%ax
+  7f:	0f 84 86 00 00 00    	je     10b <main+0x10b>
+        for(int i = 0; i < statObj.numExtents && i < sizeof(statObj.extentz)/sizeof(statObj.extentz[0]); i++) {
+            printf(1,"Extent No. %d Logical Start: %d\n", i+1, statObj.extentz[i].logicalStart);
+            printf(1,"Extent No. %d Start Address: %d\n", i+1, statObj.extentz[i].startingAddress);
+            printf(1,"Extent No. %d Length: %d\n", i+1, statObj.extentz[i].length);
+        }
+    } else if(statObj.type == 2){
+  85:	66 83 f8 02          	cmp    $0x2,%ax
+  89:	0f 84 11 01 00 00    	je     1a0 <main+0x1a0>
+            printf(1,"Disk Sector Block Direct Pointer Addresses for Block No. %d: %d\n", i+1, statObj.addrs[i]);
+        }
+    }
+
+    
+    close(fileDescriptor);
+  8f:	83 ec 0c             	sub    $0xc,%esp
+  92:	53                   	push   %ebx
+  93:	e8 c3 03 00 00       	call   45b <close>
+    exit();
+  98:	e8 96 03 00 00       	call   433 <exit>
+            printf(1, "stat failed: Cannot get status information about: %s\n", argv[1]);
+  9d:	50                   	push   %eax
+  9e:	ff 76 04             	push   0x4(%esi)
+  a1:	68 1c 09 00 00       	push   $0x91c
+  a6:	6a 01                	push   $0x1
+  a8:	e8 23 05 00 00       	call   5d0 <printf>
+            close(fileDescriptor);
+  ad:	89 1c 24             	mov    %ebx,(%esp)
+  b0:	e8 a6 03 00 00       	call   45b <close>
+            exit();
+  b5:	e8 79 03 00 00       	call   433 <exit>
+            printf(1, "stat failed: Cannot read file: %s\n", argv[1]);
+  ba:	50                   	push   %eax
+  bb:	ff 76 04             	push   0x4(%esi)
+  be:	68 f8 08 00 00       	push   $0x8f8
+  c3:	6a 01                	push   $0x1
+  c5:	e8 06 05 00 00       	call   5d0 <printf>
+            exit();
+  ca:	e8 64 03 00 00       	call   433 <exit>
+       printf(1, "type: %s\n", "Directory");
+  cf:	57                   	push   %edi
+  d0:	68 05 0a 00 00       	push   $0xa05
+       printf(1, "type: %s\n", "Device");
+  d5:	68 0f 0a 00 00       	push   $0xa0f
+  da:	6a 01                	push   $0x1
+  dc:	e8 ef 04 00 00       	call   5d0 <printf>
+       printf(1, "size: %d\n", statObj.size);
+  e1:	83 c4 0c             	add    $0xc,%esp
+  e4:	ff b5 28 ff ff ff    	push   -0xd8(%ebp)
+  ea:	68 19 0a 00 00       	push   $0xa19
+  ef:	6a 01                	push   $0x1
+  f1:	e8 da 04 00 00       	call   5d0 <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+  f9:	eb 94                	jmp    8f <main+0x8f>
+       printf(1, "type: %s\n", "Device");
+  fb:	56                   	push   %esi
+  fc:	68 23 0a 00 00       	push   $0xa23
+ 101:	eb d2                	jmp    d5 <main+0xd5>
+       printf(1, "type: %s\n", "Symlink");    
+ 103:	51                   	push   %ecx
+ 104:	68 2a 0a 00 00       	push   $0xa2a
+ 109:	eb ca                	jmp    d5 <main+0xd5>
+        printf(1, "type: %s\n", "Extent File");    
+ 10b:	52                   	push   %edx
+        for(int i = 0; i < statObj.numExtents && i < sizeof(statObj.extentz)/sizeof(statObj.extentz[0]); i++) {
+ 10c:	31 f6                	xor    %esi,%esi
+        printf(1, "type: %s\n", "Extent File");    
+ 10e:	68 32 0a 00 00       	push   $0xa32
+ 113:	68 0f 0a 00 00       	push   $0xa0f
+ 118:	6a 01                	push   $0x1
+ 11a:	e8 b1 04 00 00       	call   5d0 <printf>
+        printf(1, "size: %d\n", statObj.size);
+ 11f:	83 c4 0c             	add    $0xc,%esp
+ 122:	ff b5 28 ff ff ff    	push   -0xd8(%ebp)
+ 128:	68 19 0a 00 00       	push   $0xa19
+ 12d:	6a 01                	push   $0x1
+ 12f:	e8 9c 04 00 00       	call   5d0 <printf>
+        printf(1, "extents: %d\n", statObj.numExtents);
+ 134:	83 c4 0c             	add    $0xc,%esp
+ 137:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+ 13d:	68 3e 0a 00 00       	push   $0xa3e
+ 142:	6a 01                	push   $0x1
+ 144:	e8 87 04 00 00       	call   5d0 <printf>
+        for(int i = 0; i < statObj.numExtents && i < sizeof(statObj.extentz)/sizeof(statObj.extentz[0]); i++) {
+ 149:	83 c4 10             	add    $0x10,%esp
+ 14c:	eb 42                	jmp    190 <main+0x190>
+ 14e:	83 fe 0b             	cmp    $0xb,%esi
+ 151:	0f 84 38 ff ff ff    	je     8f <main+0x8f>
+            printf(1,"Extent No. %d Logical Start: %d\n", i+1, statObj.extentz[i].logicalStart);
+ 157:	83 c6 01             	add    $0x1,%esi
+ 15a:	ff 77 3c             	push   0x3c(%edi)
+ 15d:	56                   	push   %esi
+ 15e:	68 7c 09 00 00       	push   $0x97c
+ 163:	6a 01                	push   $0x1
+ 165:	e8 66 04 00 00       	call   5d0 <printf>
+            printf(1,"Extent No. %d Start Address: %d\n", i+1, statObj.extentz[i].startingAddress);
+ 16a:	ff 77 44             	push   0x44(%edi)
+ 16d:	56                   	push   %esi
+ 16e:	68 a0 09 00 00       	push   $0x9a0
+ 173:	6a 01                	push   $0x1
+ 175:	e8 56 04 00 00       	call   5d0 <printf>
+            printf(1,"Extent No. %d Length: %d\n", i+1, statObj.extentz[i].length);
+ 17a:	83 c4 20             	add    $0x20,%esp
+ 17d:	ff 77 40             	push   0x40(%edi)
+ 180:	56                   	push   %esi
+ 181:	68 4b 0a 00 00       	push   $0xa4b
+ 186:	6a 01                	push   $0x1
+ 188:	e8 43 04 00 00       	call   5d0 <printf>
+ 18d:	83 c4 10             	add    $0x10,%esp
+        for(int i = 0; i < statObj.numExtents && i < sizeof(statObj.extentz)/sizeof(statObj.extentz[0]); i++) {
+ 190:	83 c7 0c             	add    $0xc,%edi
+ 193:	3b b5 5c ff ff ff    	cmp    -0xa4(%ebp),%esi
+ 199:	72 b3                	jb     14e <main+0x14e>
+ 19b:	e9 ef fe ff ff       	jmp    8f <main+0x8f>
+        printf(1, "type: %s\n", "Pointer-based File");    
+ 1a0:	50                   	push   %eax
+        for(int i = 0; i < NDIRECT; i++) {
+ 1a1:	31 f6                	xor    %esi,%esi
+        printf(1, "type: %s\n", "Pointer-based File");    
+ 1a3:	68 65 0a 00 00       	push   $0xa65
+ 1a8:	68 0f 0a 00 00       	push   $0xa0f
+ 1ad:	6a 01                	push   $0x1
+ 1af:	e8 1c 04 00 00       	call   5d0 <printf>
+        printf(1, "size: %d\n", statObj.size);
+ 1b4:	83 c4 0c             	add    $0xc,%esp
+ 1b7:	ff b5 28 ff ff ff    	push   -0xd8(%ebp)
+ 1bd:	68 19 0a 00 00       	push   $0xa19
+ 1c2:	6a 01                	push   $0x1
+ 1c4:	e8 07 04 00 00       	call   5d0 <printf>
+ 1c9:	83 c4 10             	add    $0x10,%esp
+            printf(1,"Disk Sector Block Direct Pointer Addresses for Block No. %d: %d\n", i+1, statObj.addrs[i]);
+ 1cc:	8b 44 b7 14          	mov    0x14(%edi,%esi,4),%eax
+ 1d0:	83 c6 01             	add    $0x1,%esi
+ 1d3:	50                   	push   %eax
+ 1d4:	56                   	push   %esi
+ 1d5:	68 c4 09 00 00       	push   $0x9c4
+ 1da:	6a 01                	push   $0x1
+ 1dc:	e8 ef 03 00 00       	call   5d0 <printf>
+        for(int i = 0; i < NDIRECT; i++) {
+ 1e1:	83 c4 10             	add    $0x10,%esp
+ 1e4:	83 fe 0b             	cmp    $0xb,%esi
+ 1e7:	75 e3                	jne    1cc <main+0x1cc>
+ 1e9:	e9 a1 fe ff ff       	jmp    8f <main+0x8f>
+ 1ee:	66 90                	xchg   %ax,%ax
+
+000001f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1f1:	31 c0                	xor    %eax,%eax
+{
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 207:	83 c0 01             	add    $0x1,%eax
+ 20a:	84 d2                	test   %dl,%dl
+ 20c:	75 f2                	jne    200 <strcpy+0x10>
+    ;
+  return os;
+}
+ 20e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 211:	89 c8                	mov    %ecx,%eax
+ 213:	c9                   	leave
+ 214:	c3                   	ret
+ 215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+ 227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 22a:	0f b6 02             	movzbl (%edx),%eax
+ 22d:	84 c0                	test   %al,%al
+ 22f:	75 17                	jne    248 <strcmp+0x28>
+ 231:	eb 3a                	jmp    26d <strcmp+0x4d>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 23c:	83 c2 01             	add    $0x1,%edx
+ 23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 242:	84 c0                	test   %al,%al
+ 244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+ 246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 248:	0f b6 19             	movzbl (%ecx),%ebx
+ 24b:	38 c3                	cmp    %al,%bl
+ 24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 24f:	29 d8                	sub    %ebx,%eax
+}
+ 251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 264:	31 c0                	xor    %eax,%eax
+ 266:	29 d8                	sub    %ebx,%eax
+}
+ 268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 19             	movzbl (%ecx),%ebx
+ 270:	31 c0                	xor    %eax,%eax
+ 272:	eb db                	jmp    24f <strcmp+0x2f>
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 286:	80 3a 00             	cmpb   $0x0,(%edx)
+ 289:	74 15                	je     2a0 <strlen+0x20>
+ 28b:	31 c0                	xor    %eax,%eax
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+ 29b:	89 c8                	mov    %ecx,%eax
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2a0:	31 c9                	xor    %ecx,%ecx
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	89 c8                	mov    %ecx,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	89 d7                	mov    %edx,%edi
+ 2bf:	fc                   	cld
+ 2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2da:	0f b6 10             	movzbl (%eax),%edx
+ 2dd:	84 d2                	test   %dl,%dl
+ 2df:	75 12                	jne    2f3 <strchr+0x23>
+ 2e1:	eb 1d                	jmp    300 <strchr+0x30>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ec:	83 c0 01             	add    $0x1,%eax
+ 2ef:	84 d2                	test   %dl,%dl
+ 2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+ 2f3:	38 d1                	cmp    %dl,%cl
+ 2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 300:	31 c0                	xor    %eax,%eax
+}
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 319:	31 db                	xor    %ebx,%ebx
+{
+ 31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	eb 27                	jmp    347 <gets+0x37>
+    cc = read(0, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 01                	push   $0x1
+ 325:	56                   	push   %esi
+ 326:	6a 00                	push   $0x0
+ 328:	e8 1e 01 00 00       	call   44b <read>
+    if(cc < 1)
+ 32d:	83 c4 10             	add    $0x10,%esp
+ 330:	85 c0                	test   %eax,%eax
+ 332:	7e 1d                	jle    351 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 33f:	3c 0a                	cmp    $0xa,%al
+ 341:	74 10                	je     353 <gets+0x43>
+ 343:	3c 0d                	cmp    $0xd,%al
+ 345:	74 0c                	je     353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 347:	89 df                	mov    %ebx,%edi
+ 349:	83 c3 01             	add    $0x1,%ebx
+ 34c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 34f:	7c cf                	jl     320 <gets+0x10>
+ 351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <stat>:
+
+int stat(const char *n, struct stat *st)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	6a 00                	push   $0x0
+ 37a:	ff 75 08             	push   0x8(%ebp)
+ 37d:	e8 f1 00 00 00       	call   473 <open>
+  if(fd < 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	ff 75 0c             	push   0xc(%ebp)
+ 38f:	89 c3                	mov    %eax,%ebx
+ 391:	50                   	push   %eax
+ 392:	e8 f4 00 00 00       	call   48b <fstat>
+  close(fd);
+ 397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 39c:	e8 ba 00 00 00       	call   45b <close>
+  return r;
+ 3a1:	83 c4 10             	add    $0x10,%esp
+}
+ 3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a7:	89 f0                	mov    %esi,%eax
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+ 3ac:	c3                   	ret
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3b5:	eb ed                	jmp    3a4 <stat+0x34>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3c7:	0f be 02             	movsbl (%edx),%eax
+ 3ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3d5:	77 1e                	ja     3f5 <atoi+0x35>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3e0:	83 c2 01             	add    $0x1,%edx
+ 3e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ea:	0f be 02             	movsbl (%edx),%eax
+ 3ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3f0:	80 fb 09             	cmp    $0x9,%bl
+ 3f3:	76 eb                	jbe    3e0 <atoi+0x20>
+  return n;
+}
+ 3f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f8:	89 c8                	mov    %ecx,%eax
+ 3fa:	c9                   	leave
+ 3fb:	c3                   	ret
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	8b 45 10             	mov    0x10(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	7e 13                	jle    425 <memmove+0x25>
+ 412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 414:	89 d7                	mov    %edx,%edi
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 421:	39 f8                	cmp    %edi,%eax
+ 423:	75 fb                	jne    420 <memmove+0x20>
+  return vdst;
+}
+ 425:	5e                   	pop    %esi
+ 426:	89 d0                	mov    %edx,%eax
+ 428:	5f                   	pop    %edi
+ 429:	5d                   	pop    %ebp
+ 42a:	c3                   	ret
+
+0000042b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 42b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <exit>:
+SYSCALL(exit)
+ 433:	b8 02 00 00 00       	mov    $0x2,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <wait>:
+SYSCALL(wait)
+ 43b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <pipe>:
+SYSCALL(pipe)
+ 443:	b8 04 00 00 00       	mov    $0x4,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <read>:
+SYSCALL(read)
+ 44b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <write>:
+SYSCALL(write)
+ 453:	b8 10 00 00 00       	mov    $0x10,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <close>:
+SYSCALL(close)
+ 45b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <kill>:
+SYSCALL(kill)
+ 463:	b8 06 00 00 00       	mov    $0x6,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <exec>:
+SYSCALL(exec)
+ 46b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <open>:
+SYSCALL(open)
+ 473:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mknod>:
+SYSCALL(mknod)
+ 47b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <unlink>:
+SYSCALL(unlink)
+ 483:	b8 12 00 00 00       	mov    $0x12,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <fstat>:
+SYSCALL(fstat)
+ 48b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <link>:
+SYSCALL(link)
+ 493:	b8 13 00 00 00       	mov    $0x13,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mkdir>:
+SYSCALL(mkdir)
+ 49b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <chdir>:
+SYSCALL(chdir)
+ 4a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <dup>:
+SYSCALL(dup)
+ 4ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getpid>:
+SYSCALL(getpid)
+ 4b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <sbrk>:
+SYSCALL(sbrk)
+ 4bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <sleep>:
+SYSCALL(sleep)
+ 4c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <uptime>:
+SYSCALL(uptime)
+ 4cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <time_scheduled>:
+SYSCALL(time_scheduled)
+ 4d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <set_sched_priority>:
+SYSCALL(set_sched_priority)
+ 4db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <get_sched_priority>:
+SYSCALL(get_sched_priority)
+ 4e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <fifo_position>:
+SYSCALL(fifo_position)
+ 4eb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <printProcessTable>:
+SYSCALL(printProcessTable)
+ 4f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <symlink>:
+SYSCALL(symlink)
+ 4fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <lseek>:
+SYSCALL(lseek)
+ 503:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <fallocate>:
+SYSCALL(fallocate)
+ 50b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <iostats>:
+SYSCALL(iostats)
+ 513:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fsync>:
+SYSCALL(fsync)
+ 51b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+ 523:	66 90                	xchg   %ax,%ax
+ 525:	66 90                	xchg   %ax,%ax
+ 527:	66 90                	xchg   %ax,%ax
+ 529:	66 90                	xchg   %ax,%ax
+ 52b:	66 90                	xchg   %ax,%ax
+ 52d:	66 90                	xchg   %ax,%ax
+ 52f:	90                   	nop
+
+00000530 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 538:	89 d1                	mov    %edx,%ecx
+{
+ 53a:	83 ec 3c             	sub    $0x3c,%esp
+ 53d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 540:	85 d2                	test   %edx,%edx
+ 542:	0f 89 80 00 00 00    	jns    5c8 <printint+0x98>
+ 548:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 54c:	74 7a                	je     5c8 <printint+0x98>
+    x = -xx;
+ 54e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 550:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 555:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 558:	31 f6                	xor    %esi,%esi
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 560:	89 c8                	mov    %ecx,%eax
+ 562:	31 d2                	xor    %edx,%edx
+ 564:	89 f7                	mov    %esi,%edi
+ 566:	f7 f3                	div    %ebx
+ 568:	8d 76 01             	lea    0x1(%esi),%esi
+ 56b:	0f b6 92 d8 0a 00 00 	movzbl 0xad8(%edx),%edx
+ 572:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 576:	89 ca                	mov    %ecx,%edx
+ 578:	89 c1                	mov    %eax,%ecx
+ 57a:	39 da                	cmp    %ebx,%edx
+ 57c:	73 e2                	jae    560 <printint+0x30>
+  if(neg)
+ 57e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 581:	85 c0                	test   %eax,%eax
+ 583:	74 07                	je     58c <printint+0x5c>
+    buf[i++] = '-';
+ 585:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 58a:	89 f7                	mov    %esi,%edi
+ 58c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 58f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 592:	01 df                	add    %ebx,%edi
+ 594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 598:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 59b:	83 ec 04             	sub    $0x4,%esp
+ 59e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5a4:	6a 01                	push   $0x1
+ 5a6:	50                   	push   %eax
+ 5a7:	56                   	push   %esi
+ 5a8:	e8 a6 fe ff ff       	call   453 <write>
+  while(--i >= 0)
+ 5ad:	89 f8                	mov    %edi,%eax
+ 5af:	83 c4 10             	add    $0x10,%esp
+ 5b2:	83 ef 01             	sub    $0x1,%edi
+ 5b5:	39 d8                	cmp    %ebx,%eax
+ 5b7:	75 df                	jne    598 <printint+0x68>
+}
+ 5b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5bc:	5b                   	pop    %ebx
+ 5bd:	5e                   	pop    %esi
+ 5be:	5f                   	pop    %edi
+ 5bf:	5d                   	pop    %ebp
+ 5c0:	c3                   	ret
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5c8:	31 c0                	xor    %eax,%eax
+ 5ca:	eb 89                	jmp    555 <printint+0x25>
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5df:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e2:	83 c6 01             	add    $0x1,%esi
+ 5e5:	84 db                	test   %bl,%bl
+ 5e7:	74 67                	je     650 <printf+0x80>
+ 5e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ec:	31 d2                	xor    %edx,%edx
+ 5ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5f1:	eb 34                	jmp    627 <printf+0x57>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 600:	83 f8 25             	cmp    $0x25,%eax
+ 603:	74 18                	je     61d <printf+0x4d>
+  write(fd, &c, 1);
+ 605:	83 ec 04             	sub    $0x4,%esp
+ 608:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 60b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60e:	6a 01                	push   $0x1
+ 610:	50                   	push   %eax
+ 611:	57                   	push   %edi
+ 612:	e8 3c fe ff ff       	call   453 <write>
+ 617:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 61a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 61d:	0f b6 1e             	movzbl (%esi),%ebx
+ 620:	83 c6 01             	add    $0x1,%esi
+ 623:	84 db                	test   %bl,%bl
+ 625:	74 29                	je     650 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 627:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 62a:	85 d2                	test   %edx,%edx
+ 62c:	74 ca                	je     5f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 62e:	83 fa 25             	cmp    $0x25,%edx
+ 631:	75 ea                	jne    61d <printf+0x4d>
+      if(c == 'd'){
+ 633:	83 f8 25             	cmp    $0x25,%eax
+ 636:	0f 84 24 01 00 00    	je     760 <printf+0x190>
+ 63c:	83 e8 63             	sub    $0x63,%eax
+ 63f:	83 f8 15             	cmp    $0x15,%eax
+ 642:	77 1c                	ja     660 <printf+0x90>
+ 644:	ff 24 85 80 0a 00 00 	jmp    *0xa80(,%eax,4)
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 653:	5b                   	pop    %ebx
+ 654:	5e                   	pop    %esi
+ 655:	5f                   	pop    %edi
+ 656:	5d                   	pop    %ebp
+ 657:	c3                   	ret
+ 658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 666:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 66a:	6a 01                	push   $0x1
+ 66c:	52                   	push   %edx
+ 66d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 670:	57                   	push   %edi
+ 671:	e8 dd fd ff ff       	call   453 <write>
+ 676:	83 c4 0c             	add    $0xc,%esp
+ 679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67c:	6a 01                	push   $0x1
+ 67e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 681:	52                   	push   %edx
+ 682:	57                   	push   %edi
+ 683:	e8 cb fd ff ff       	call   453 <write>
+        putc(fd, c);
+ 688:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68b:	31 d2                	xor    %edx,%edx
+ 68d:	eb 8e                	jmp    61d <printf+0x4d>
+ 68f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 00                	push   $0x0
+ 69f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6a4:	e8 87 fe ff ff       	call   530 <printint>
+        ap++;
+ 6a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6af:	31 d2                	xor    %edx,%edx
+ 6b1:	e9 67 ff ff ff       	jmp    61d <printf+0x4d>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6c5:	83 c0 04             	add    $0x4,%eax
+ 6c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6cb:	85 db                	test   %ebx,%ebx
+ 6cd:	0f 84 9d 00 00 00    	je     770 <printf+0x1a0>
+        while(*s != 0){
+ 6d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6d8:	84 c0                	test   %al,%al
+ 6da:	0f 84 3d ff ff ff    	je     61d <printf+0x4d>
+ 6e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6e6:	89 de                	mov    %ebx,%esi
+ 6e8:	89 d3                	mov    %edx,%ebx
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	53                   	push   %ebx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 51 fd ff ff       	call   453 <write>
+        while(*s != 0){
+ 702:	0f b6 06             	movzbl (%esi),%eax
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	84 c0                	test   %al,%al
+ 70a:	75 e4                	jne    6f0 <printf+0x120>
+      state = 0;
+ 70c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 07 ff ff ff       	jmp    61d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 01                	push   $0x1
+ 72f:	e9 6b ff ff ff       	jmp    69f <printf+0xcf>
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 738:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 741:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 743:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 746:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	52                   	push   %edx
+ 74c:	57                   	push   %edi
+ 74d:	e8 01 fd ff ff       	call   453 <write>
+        ap++;
+ 752:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 755:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 758:	31 d2                	xor    %edx,%edx
+ 75a:	e9 be fe ff ff       	jmp    61d <printf+0x4d>
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 766:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 769:	6a 01                	push   $0x1
+ 76b:	e9 11 ff ff ff       	jmp    681 <printf+0xb1>
+ 770:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 775:	bb 78 0a 00 00       	mov    $0xa78,%ebx
+ 77a:	e9 61 ff ff ff       	jmp    6e0 <printf+0x110>
+ 77f:	90                   	nop
+
+00000780 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 780:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 781:	a1 80 0d 00 00       	mov    0xd80,%eax
+{
+ 786:	89 e5                	mov    %esp,%ebp
+ 788:	57                   	push   %edi
+ 789:	56                   	push   %esi
+ 78a:	53                   	push   %ebx
+ 78b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 78e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 798:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 79a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 79c:	39 ca                	cmp    %ecx,%edx
+ 79e:	73 30                	jae    7d0 <free+0x50>
+ 7a0:	39 c1                	cmp    %eax,%ecx
+ 7a2:	72 04                	jb     7a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a4:	39 c2                	cmp    %eax,%edx
+ 7a6:	72 f0                	jb     798 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ae:	39 f8                	cmp    %edi,%eax
+ 7b0:	74 2e                	je     7e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7bb:	39 f1                	cmp    %esi,%ecx
+ 7bd:	74 38                	je     7f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7c1:	5b                   	pop    %ebx
+  freep = p;
+ 7c2:	89 15 80 0d 00 00    	mov    %edx,0xd80
+}
+ 7c8:	5e                   	pop    %esi
+ 7c9:	5f                   	pop    %edi
+ 7ca:	5d                   	pop    %ebp
+ 7cb:	c3                   	ret
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d0:	39 c1                	cmp    %eax,%ecx
+ 7d2:	72 d0                	jb     7a4 <free+0x24>
+ 7d4:	eb c2                	jmp    798 <free+0x18>
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7e0:	03 70 04             	add    0x4(%eax),%esi
+ 7e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7e6:	8b 02                	mov    (%edx),%eax
+ 7e8:	8b 00                	mov    (%eax),%eax
+ 7ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 7f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7f3:	39 f1                	cmp    %esi,%ecx
+ 7f5:	75 c8                	jne    7bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 7f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7fa:	89 15 80 0d 00 00    	mov    %edx,0xd80
+    p->s.size += bp->s.size;
+ 800:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 803:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 806:	89 0a                	mov    %ecx,(%edx)
+}
+ 808:	5b                   	pop    %ebx
+ 809:	5e                   	pop    %esi
+ 80a:	5f                   	pop    %edi
+ 80b:	5d                   	pop    %ebp
+ 80c:	c3                   	ret
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000810 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 819:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 81c:	8b 15 80 0d 00 00    	mov    0xd80,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 822:	8d 78 07             	lea    0x7(%eax),%edi
+ 825:	c1 ef 03             	shr    $0x3,%edi
+ 828:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 82b:	85 d2                	test   %edx,%edx
+ 82d:	0f 84 8d 00 00 00    	je     8c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 833:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 835:	8b 48 04             	mov    0x4(%eax),%ecx
+ 838:	39 f9                	cmp    %edi,%ecx
+ 83a:	73 64                	jae    8a0 <malloc+0x90>
+  if(nu < 4096)
+ 83c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 841:	39 df                	cmp    %ebx,%edi
+ 843:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 846:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 84d:	eb 0a                	jmp    859 <malloc+0x49>
+ 84f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 850:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 852:	8b 48 04             	mov    0x4(%eax),%ecx
+ 855:	39 f9                	cmp    %edi,%ecx
+ 857:	73 47                	jae    8a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 859:	89 c2                	mov    %eax,%edx
+ 85b:	39 05 80 0d 00 00    	cmp    %eax,0xd80
+ 861:	75 ed                	jne    850 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	56                   	push   %esi
+ 867:	e8 4f fc ff ff       	call   4bb <sbrk>
+  if(p == (char*)-1)
+ 86c:	83 c4 10             	add    $0x10,%esp
+ 86f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 872:	74 1c                	je     890 <malloc+0x80>
+  hp->s.size = nu;
+ 874:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 877:	83 ec 0c             	sub    $0xc,%esp
+ 87a:	83 c0 08             	add    $0x8,%eax
+ 87d:	50                   	push   %eax
+ 87e:	e8 fd fe ff ff       	call   780 <free>
+  return freep;
+ 883:	8b 15 80 0d 00 00    	mov    0xd80,%edx
+      if((p = morecore(nunits)) == 0)
+ 889:	83 c4 10             	add    $0x10,%esp
+ 88c:	85 d2                	test   %edx,%edx
+ 88e:	75 c0                	jne    850 <malloc+0x40>
+        return 0;
+  }
+}
+ 890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 893:	31 c0                	xor    %eax,%eax
+}
+ 895:	5b                   	pop    %ebx
+ 896:	5e                   	pop    %esi
+ 897:	5f                   	pop    %edi
+ 898:	5d                   	pop    %ebp
+ 899:	c3                   	ret
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8a0:	39 cf                	cmp    %ecx,%edi
+ 8a2:	74 4c                	je     8f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8a4:	29 f9                	sub    %edi,%ecx
+ 8a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8af:	89 15 80 0d 00 00    	mov    %edx,0xd80
+}
+ 8b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8b8:	83 c0 08             	add    $0x8,%eax
+}
+ 8bb:	5b                   	pop    %ebx
+ 8bc:	5e                   	pop    %esi
+ 8bd:	5f                   	pop    %edi
+ 8be:	5d                   	pop    %ebp
+ 8bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8c0:	c7 05 80 0d 00 00 84 	movl   $0xd84,0xd80
+ 8c7:	0d 00 00 
+    base.s.size = 0;
+ 8ca:	b8 84 0d 00 00       	mov    $0xd84,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8cf:	c7 05 84 0d 00 00 84 	movl   $0xd84,0xd84
+ 8d6:	0d 00 00 
+    base.s.size = 0;
+ 8d9:	c7 05 88 0d 00 00 00 	movl   $0x0,0xd88
+ 8e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8e3:	e9 54 ff ff ff       	jmp    83c <malloc+0x2c>
+ 8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8f0:	8b 08                	mov    (%eax),%ecx
+ 8f2:	89 0a                	mov    %ecx,(%edx)
+ 8f4:	eb b9                	jmp    8af <malloc+0x9f>
@@ -41,7 +41,10 @@ int main(int argc, char *argv[])
         printf(1, "type: %s\n", "Extent File");    
         printf(1, "size: %d\n", statObj.size);
 
-        for(int i = 0; i < statObj.numExtents; i++) {
+        printf(1, "extents: %d\n", statObj.numExtents);
+
+        for(int i = 0; i < statObj.numExtents && i < sizeof(statObj.extentz)/sizeof(statObj.extentz[0]); i++) {
+            printf(1,"Extent No. %d Logical Start: %d\n", i+1, statObj.extentz[i].logicalStart);
             printf(1,"Extent No. %d Start Address: %d\n", i+1, statObj.extentz[i].startingAddress);
             printf(1,"Extent No. %d Length: %d\n", i+1, statObj.extentz[i].length);
         }
@@ -5,6 +5,7 @@
 #define T_EXTENT 5 // Project 4 - Part 4 
 
 struct statExtent {
+  uint logicalStart; // the first block of the file that the extent holds
   uint length; // the number of blocks that span the length of our extent
   uint startingAddress; // the first block that we start with for our extent
 };
@@ -18,4 +19,5 @@ struct stat {
   uint addrs[12]; // addresses of the inodez - NDIRECT + 1 = 12
   uint numExtents;
   struct statExtent extentz[11];
+  uint dirty;  // has changes not yet committed to the log
 };
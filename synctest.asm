@@ -0,0 +1,1697 @@
+
+_synctest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 30             	sub    $0x30,%esp
+  int fd, i, p[2];
+
+  printf(1, "synctest starting\n");
+  19:	68 ba 0c 00 00       	push   $0xcba
+  1e:	6a 01                	push   $0x1
+  20:	e8 1b 09 00 00       	call   940 <printf>
+
+  // Writes followed by fsync().
+  unlink("sync.a");
+  25:	c7 04 24 cd 0c 00 00 	movl   $0xccd,(%esp)
+  2c:	e8 c2 07 00 00       	call   7f3 <unlink>
+  if((fd = open("sync.a", O_CREATE|O_RDWR)) < 0)
+  31:	5b                   	pop    %ebx
+  32:	5e                   	pop    %esi
+  33:	68 02 02 00 00       	push   $0x202
+  38:	68 cd 0c 00 00       	push   $0xccd
+  3d:	31 f6                	xor    %esi,%esi
+  3f:	e8 9f 07 00 00       	call   7e3 <open>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  4a:	85 c0                	test   %eax,%eax
+  4c:	0f 88 96 00 00 00    	js     e8 <main+0xe8>
+  52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(j = 0; j < BSIZE; j++)
+  58:	31 db                	xor    %ebx,%ebx
+  5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    buf[j] = 'a' + (i + j) % 26;
+  60:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  for(j = 0; j < BSIZE; j++)
+  63:	83 c3 01             	add    $0x1,%ebx
+    buf[j] = 'a' + (i + j) % 26;
+  66:	89 c8                	mov    %ecx,%eax
+  68:	f7 e7                	mul    %edi
+  6a:	c1 ea 03             	shr    $0x3,%edx
+  6d:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  70:	29 d1                	sub    %edx,%ecx
+  72:	83 c1 61             	add    $0x61,%ecx
+  75:	88 8b df 11 00 00    	mov    %cl,0x11df(%ebx)
+  for(j = 0; j < BSIZE; j++)
+  7b:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  81:	75 dd                	jne    60 <main+0x60>
+    fail("cannot create file");
+  for(i = 0; i < NBLOCK; i++){
+    fill(i);
+    if(write(fd, buf, BSIZE) != BSIZE)
+  83:	83 ec 04             	sub    $0x4,%esp
+  86:	68 00 02 00 00       	push   $0x200
+  8b:	68 e0 11 00 00       	push   $0x11e0
+  90:	ff 75 d4             	push   -0x2c(%ebp)
+  93:	e8 2b 07 00 00       	call   7c3 <write>
+  98:	83 c4 10             	add    $0x10,%esp
+  9b:	3d 00 02 00 00       	cmp    $0x200,%eax
+  a0:	75 53                	jne    f5 <main+0xf5>
+  for(i = 0; i < NBLOCK; i++){
+  a2:	83 c6 01             	add    $0x1,%esi
+  a5:	83 fe 14             	cmp    $0x14,%esi
+  a8:	75 ae                	jne    58 <main+0x58>
+      fail("write");
+  }
+  if(fsync(fd) != 0)
+  aa:	83 ec 0c             	sub    $0xc,%esp
+  ad:	ff 75 d4             	push   -0x2c(%ebp)
+  b0:	e8 d6 07 00 00       	call   88b <fsync>
+  b5:	83 c4 10             	add    $0x10,%esp
+  b8:	85 c0                	test   %eax,%eax
+  ba:	75 46                	jne    102 <main+0x102>
+    fail("fsync");
+  committed(fd, "fsync returned before the commit");
+  bc:	51                   	push   %ecx
+  bd:	51                   	push   %ecx
+  be:	68 c4 0d 00 00       	push   $0xdc4
+  c3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  c6:	57                   	push   %edi
+  c7:	e8 64 03 00 00       	call   430 <committed>
+  if(fsync(fd) != 0)
+  cc:	89 3c 24             	mov    %edi,(%esp)
+  cf:	e8 b7 07 00 00       	call   88b <fsync>
+  d4:	83 c4 10             	add    $0x10,%esp
+  d7:	85 c0                	test   %eax,%eax
+  d9:	74 34                	je     10f <main+0x10f>
+    fail("fsync with nothing to commit");
+  db:	83 ec 0c             	sub    $0xc,%esp
+  de:	68 ed 0c 00 00       	push   $0xced
+  e3:	e8 e8 02 00 00       	call   3d0 <fail>
+    fail("cannot create file");
+  e8:	83 ec 0c             	sub    $0xc,%esp
+  eb:	68 d4 0c 00 00       	push   $0xcd4
+  f0:	e8 db 02 00 00       	call   3d0 <fail>
+      fail("write");
+  f5:	83 ec 0c             	sub    $0xc,%esp
+  f8:	68 32 0d 00 00       	push   $0xd32
+  fd:	e8 ce 02 00 00       	call   3d0 <fail>
+    fail("fsync");
+ 102:	83 ec 0c             	sub    $0xc,%esp
+ 105:	68 e7 0c 00 00       	push   $0xce7
+ 10a:	e8 c1 02 00 00       	call   3d0 <fail>
+  close(fd);
+ 10f:	83 ec 0c             	sub    $0xc,%esp
+ 112:	ff 75 d4             	push   -0x2c(%ebp)
+
+  // O_SYNC writes, to a regular and to an extent file.
+  unlink("sync.b");
+  if((fd = open("sync.b", O_CREATE|O_RDWR|O_SYNC)) < 0)
+    fail("cannot create O_SYNC file");
+  for(i = 0; i < NBLOCK; i++){
+ 115:	31 f6                	xor    %esi,%esi
+    buf[j] = 'a' + (i + j) % 26;
+ 117:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+  close(fd);
+ 11c:	e8 aa 06 00 00       	call   7cb <close>
+  check("sync.a");
+ 121:	c7 04 24 cd 0c 00 00 	movl   $0xccd,(%esp)
+ 128:	e8 43 03 00 00       	call   470 <check>
+  unlink("sync.a");
+ 12d:	c7 04 24 cd 0c 00 00 	movl   $0xccd,(%esp)
+ 134:	e8 ba 06 00 00       	call   7f3 <unlink>
+  unlink("sync.b");
+ 139:	c7 04 24 0a 0d 00 00 	movl   $0xd0a,(%esp)
+ 140:	e8 ae 06 00 00       	call   7f3 <unlink>
+  if((fd = open("sync.b", O_CREATE|O_RDWR|O_SYNC)) < 0)
+ 145:	58                   	pop    %eax
+ 146:	5a                   	pop    %edx
+ 147:	68 02 06 00 00       	push   $0x602
+ 14c:	68 0a 0d 00 00       	push   $0xd0a
+ 151:	e8 8d 06 00 00       	call   7e3 <open>
+ 156:	83 c4 10             	add    $0x10,%esp
+ 159:	85 c0                	test   %eax,%eax
+ 15b:	0f 88 6c 01 00 00    	js     2cd <main+0x2cd>
+ 161:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(j = 0; j < BSIZE; j++)
+ 164:	31 db                	xor    %ebx,%ebx
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[j] = 'a' + (i + j) % 26;
+ 170:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  for(j = 0; j < BSIZE; j++)
+ 173:	83 c3 01             	add    $0x1,%ebx
+    buf[j] = 'a' + (i + j) % 26;
+ 176:	89 c8                	mov    %ecx,%eax
+ 178:	f7 e7                	mul    %edi
+ 17a:	c1 ea 03             	shr    $0x3,%edx
+ 17d:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 180:	29 d1                	sub    %edx,%ecx
+ 182:	83 c1 61             	add    $0x61,%ecx
+ 185:	88 8b df 11 00 00    	mov    %cl,0x11df(%ebx)
+  for(j = 0; j < BSIZE; j++)
+ 18b:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+ 191:	75 dd                	jne    170 <main+0x170>
+    fill(i);
+    if(write(fd, buf, BSIZE) != BSIZE)
+ 193:	50                   	push   %eax
+ 194:	68 00 02 00 00       	push   $0x200
+ 199:	68 e0 11 00 00       	push   $0x11e0
+ 19e:	ff 75 d4             	push   -0x2c(%ebp)
+ 1a1:	e8 1d 06 00 00       	call   7c3 <write>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+ 1a9:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1ae:	0f 85 d7 01 00 00    	jne    38b <main+0x38b>
+      fail("O_SYNC write");
+    committed(fd, "O_SYNC write returned before the commit");
+ 1b4:	50                   	push   %eax
+  for(i = 0; i < NBLOCK; i++){
+ 1b5:	83 c6 01             	add    $0x1,%esi
+    committed(fd, "O_SYNC write returned before the commit");
+ 1b8:	50                   	push   %eax
+ 1b9:	68 e8 0d 00 00       	push   $0xde8
+ 1be:	ff 75 d4             	push   -0x2c(%ebp)
+ 1c1:	e8 6a 02 00 00       	call   430 <committed>
+  for(i = 0; i < NBLOCK; i++){
+ 1c6:	83 c4 10             	add    $0x10,%esp
+ 1c9:	83 fe 14             	cmp    $0x14,%esi
+ 1cc:	75 96                	jne    164 <main+0x164>
+  }
+  close(fd);
+ 1ce:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1d1:	83 ec 0c             	sub    $0xc,%esp
+ 1d4:	50                   	push   %eax
+ 1d5:	e8 f1 05 00 00       	call   7cb <close>
+  check("sync.b");
+ 1da:	c7 04 24 0a 0d 00 00 	movl   $0xd0a,(%esp)
+ 1e1:	e8 8a 02 00 00       	call   470 <check>
+  unlink("sync.b");
+ 1e6:	c7 04 24 0a 0d 00 00 	movl   $0xd0a,(%esp)
+ 1ed:	e8 01 06 00 00       	call   7f3 <unlink>
+
+  unlink("sync.c");
+ 1f2:	c7 04 24 38 0d 00 00 	movl   $0xd38,(%esp)
+ 1f9:	e8 f5 05 00 00       	call   7f3 <unlink>
+  if((fd = open("sync.c", O_EXTENT)) < 0)
+ 1fe:	59                   	pop    %ecx
+ 1ff:	5b                   	pop    %ebx
+ 200:	6a 04                	push   $0x4
+ 202:	68 38 0d 00 00       	push   $0xd38
+ 207:	e8 d7 05 00 00       	call   7e3 <open>
+ 20c:	83 c4 10             	add    $0x10,%esp
+ 20f:	85 c0                	test   %eax,%eax
+ 211:	0f 88 67 01 00 00    	js     37e <main+0x37e>
+    fail("cannot create extent file");
+  close(fd);
+ 217:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open("sync.c", O_RDWR|O_SYNC)) < 0)
+    fail("cannot open extent file O_SYNC");
+  for(i = 0; i < NBLOCK; i++){
+ 21a:	31 f6                	xor    %esi,%esi
+    buf[j] = 'a' + (i + j) % 26;
+ 21c:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+  close(fd);
+ 221:	50                   	push   %eax
+ 222:	e8 a4 05 00 00       	call   7cb <close>
+  if((fd = open("sync.c", O_RDWR|O_SYNC)) < 0)
+ 227:	58                   	pop    %eax
+ 228:	5a                   	pop    %edx
+ 229:	68 02 04 00 00       	push   $0x402
+ 22e:	68 38 0d 00 00       	push   $0xd38
+ 233:	e8 ab 05 00 00       	call   7e3 <open>
+ 238:	83 c4 10             	add    $0x10,%esp
+ 23b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 23e:	85 c0                	test   %eax,%eax
+ 240:	0f 88 94 00 00 00    	js     2da <main+0x2da>
+  for(j = 0; j < BSIZE; j++)
+ 246:	31 db                	xor    %ebx,%ebx
+ 248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+    buf[j] = 'a' + (i + j) % 26;
+ 250:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  for(j = 0; j < BSIZE; j++)
+ 253:	83 c3 01             	add    $0x1,%ebx
+    buf[j] = 'a' + (i + j) % 26;
+ 256:	89 c8                	mov    %ecx,%eax
+ 258:	f7 e7                	mul    %edi
+ 25a:	c1 ea 03             	shr    $0x3,%edx
+ 25d:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 260:	29 d1                	sub    %edx,%ecx
+ 262:	83 c1 61             	add    $0x61,%ecx
+ 265:	88 8b df 11 00 00    	mov    %cl,0x11df(%ebx)
+  for(j = 0; j < BSIZE; j++)
+ 26b:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+ 271:	75 dd                	jne    250 <main+0x250>
+    fill(i);
+    if(write(fd, buf, BSIZE) != BSIZE)
+ 273:	50                   	push   %eax
+ 274:	68 00 02 00 00       	push   $0x200
+ 279:	68 e0 11 00 00       	push   $0x11e0
+ 27e:	ff 75 d4             	push   -0x2c(%ebp)
+ 281:	e8 3d 05 00 00       	call   7c3 <write>
+ 286:	83 c4 10             	add    $0x10,%esp
+ 289:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 28e:	0f 85 97 00 00 00    	jne    32b <main+0x32b>
+      fail("O_SYNC write to extent file");
+    committed(fd, "O_SYNC write returned before the commit");
+ 294:	53                   	push   %ebx
+  for(i = 0; i < NBLOCK; i++){
+ 295:	83 c6 01             	add    $0x1,%esi
+    committed(fd, "O_SYNC write returned before the commit");
+ 298:	53                   	push   %ebx
+ 299:	68 e8 0d 00 00       	push   $0xde8
+ 29e:	ff 75 d4             	push   -0x2c(%ebp)
+ 2a1:	e8 8a 01 00 00       	call   430 <committed>
+  for(i = 0; i < NBLOCK; i++){
+ 2a6:	83 c4 10             	add    $0x10,%esp
+ 2a9:	83 fe 14             	cmp    $0x14,%esi
+ 2ac:	75 98                	jne    246 <main+0x246>
+  }
+  if(fsync(fd) != 0)
+ 2ae:	83 ec 0c             	sub    $0xc,%esp
+ 2b1:	ff 75 d4             	push   -0x2c(%ebp)
+ 2b4:	e8 d2 05 00 00       	call   88b <fsync>
+ 2b9:	83 c4 10             	add    $0x10,%esp
+ 2bc:	85 c0                	test   %eax,%eax
+ 2be:	74 27                	je     2e7 <main+0x2e7>
+    fail("fsync of extent file");
+ 2c0:	83 ec 0c             	sub    $0xc,%esp
+ 2c3:	68 75 0d 00 00       	push   $0xd75
+ 2c8:	e8 03 01 00 00       	call   3d0 <fail>
+    fail("cannot create O_SYNC file");
+ 2cd:	83 ec 0c             	sub    $0xc,%esp
+ 2d0:	68 11 0d 00 00       	push   $0xd11
+ 2d5:	e8 f6 00 00 00       	call   3d0 <fail>
+    fail("cannot open extent file O_SYNC");
+ 2da:	83 ec 0c             	sub    $0xc,%esp
+ 2dd:	68 10 0e 00 00       	push   $0xe10
+ 2e2:	e8 e9 00 00 00       	call   3d0 <fail>
+  close(fd);
+ 2e7:	83 ec 0c             	sub    $0xc,%esp
+ 2ea:	ff 75 d4             	push   -0x2c(%ebp)
+ 2ed:	e8 d9 04 00 00       	call   7cb <close>
+  check("sync.c");
+ 2f2:	c7 04 24 38 0d 00 00 	movl   $0xd38,(%esp)
+ 2f9:	e8 72 01 00 00       	call   470 <check>
+  unlink("sync.c");
+ 2fe:	c7 04 24 38 0d 00 00 	movl   $0xd38,(%esp)
+ 305:	e8 e9 04 00 00       	call   7f3 <unlink>
+
+  // Only files can be synced.
+  if(fsync(-1) != -1 || fsync(fd) != -1)
+ 30a:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+ 311:	e8 75 05 00 00       	call   88b <fsync>
+ 316:	83 c4 10             	add    $0x10,%esp
+ 319:	83 c0 01             	add    $0x1,%eax
+ 31c:	74 1a                	je     338 <main+0x338>
+    fail("fsync of a bad descriptor");
+ 31e:	83 ec 0c             	sub    $0xc,%esp
+ 321:	68 8a 0d 00 00       	push   $0xd8a
+ 326:	e8 a5 00 00 00       	call   3d0 <fail>
+      fail("O_SYNC write to extent file");
+ 32b:	83 ec 0c             	sub    $0xc,%esp
+ 32e:	68 59 0d 00 00       	push   $0xd59
+ 333:	e8 98 00 00 00       	call   3d0 <fail>
+  if(fsync(-1) != -1 || fsync(fd) != -1)
+ 338:	83 ec 0c             	sub    $0xc,%esp
+ 33b:	ff 75 d4             	push   -0x2c(%ebp)
+ 33e:	e8 48 05 00 00       	call   88b <fsync>
+ 343:	83 c4 10             	add    $0x10,%esp
+ 346:	83 c0 01             	add    $0x1,%eax
+ 349:	75 d3                	jne    31e <main+0x31e>
+  if(pipe(p) < 0)
+ 34b:	83 ec 0c             	sub    $0xc,%esp
+ 34e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 351:	50                   	push   %eax
+ 352:	e8 5c 04 00 00       	call   7b3 <pipe>
+ 357:	83 c4 10             	add    $0x10,%esp
+ 35a:	85 c0                	test   %eax,%eax
+ 35c:	78 61                	js     3bf <main+0x3bf>
+    fail("pipe");
+  if(fsync(p[0]) != -1)
+ 35e:	83 ec 0c             	sub    $0xc,%esp
+ 361:	ff 75 e0             	push   -0x20(%ebp)
+ 364:	e8 22 05 00 00       	call   88b <fsync>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	83 c0 01             	add    $0x1,%eax
+ 36f:	74 27                	je     398 <main+0x398>
+    fail("fsync of a pipe");
+ 371:	83 ec 0c             	sub    $0xc,%esp
+ 374:	68 a4 0d 00 00       	push   $0xda4
+ 379:	e8 52 00 00 00       	call   3d0 <fail>
+    fail("cannot create extent file");
+ 37e:	83 ec 0c             	sub    $0xc,%esp
+ 381:	68 3f 0d 00 00       	push   $0xd3f
+ 386:	e8 45 00 00 00       	call   3d0 <fail>
+      fail("O_SYNC write");
+ 38b:	83 ec 0c             	sub    $0xc,%esp
+ 38e:	68 2b 0d 00 00       	push   $0xd2b
+ 393:	e8 38 00 00 00       	call   3d0 <fail>
+  close(p[0]);
+ 398:	83 ec 0c             	sub    $0xc,%esp
+ 39b:	ff 75 e0             	push   -0x20(%ebp)
+ 39e:	e8 28 04 00 00       	call   7cb <close>
+  close(p[1]);
+ 3a3:	58                   	pop    %eax
+ 3a4:	ff 75 e4             	push   -0x1c(%ebp)
+ 3a7:	e8 1f 04 00 00       	call   7cb <close>
+
+  printf(1, "synctest ok\n");
+ 3ac:	5a                   	pop    %edx
+ 3ad:	59                   	pop    %ecx
+ 3ae:	68 b4 0d 00 00       	push   $0xdb4
+ 3b3:	6a 01                	push   $0x1
+ 3b5:	e8 86 05 00 00       	call   940 <printf>
+  exit();
+ 3ba:	e8 e4 03 00 00       	call   7a3 <exit>
+    fail("pipe");
+ 3bf:	83 ec 0c             	sub    $0xc,%esp
+ 3c2:	68 af 0d 00 00       	push   $0xdaf
+ 3c7:	e8 04 00 00 00       	call   3d0 <fail>
+ 3cc:	66 90                	xchg   %ax,%ax
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <fail>:
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "synctest failed: %s\n", msg);
+ 3d6:	ff 75 08             	push   0x8(%ebp)
+ 3d9:	68 68 0c 00 00       	push   $0xc68
+ 3de:	6a 01                	push   $0x1
+ 3e0:	e8 5b 05 00 00       	call   940 <printf>
+  exit();
+ 3e5:	e8 b9 03 00 00       	call   7a3 <exit>
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003f0 <fill>:
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+    buf[j] = 'a' + (i + j) % 26;
+ 3f5:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+{
+ 3fa:	53                   	push   %ebx
+ 3fb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(j = 0; j < BSIZE; j++)
+ 3fe:	31 db                	xor    %ebx,%ebx
+    buf[j] = 'a' + (i + j) % 26;
+ 400:	8d 0c 1f             	lea    (%edi,%ebx,1),%ecx
+  for(j = 0; j < BSIZE; j++)
+ 403:	83 c3 01             	add    $0x1,%ebx
+    buf[j] = 'a' + (i + j) % 26;
+ 406:	89 c8                	mov    %ecx,%eax
+ 408:	f7 ee                	imul   %esi
+ 40a:	89 c8                	mov    %ecx,%eax
+ 40c:	c1 f8 1f             	sar    $0x1f,%eax
+ 40f:	c1 fa 03             	sar    $0x3,%edx
+ 412:	29 c2                	sub    %eax,%edx
+ 414:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 417:	29 d1                	sub    %edx,%ecx
+ 419:	83 c1 61             	add    $0x61,%ecx
+ 41c:	88 8b df 11 00 00    	mov    %cl,0x11df(%ebx)
+  for(j = 0; j < BSIZE; j++)
+ 422:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+ 428:	75 d6                	jne    400 <fill+0x10>
+}
+ 42a:	5b                   	pop    %ebx
+ 42b:	5e                   	pop    %esi
+ 42c:	5f                   	pop    %edi
+ 42d:	5d                   	pop    %ebp
+ 42e:	c3                   	ret
+ 42f:	90                   	nop
+
+00000430 <committed>:
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	81 ec e0 00 00 00    	sub    $0xe0,%esp
+  if(fstat(fd, &st) < 0)
+ 439:	8d 85 28 ff ff ff    	lea    -0xd8(%ebp),%eax
+ 43f:	50                   	push   %eax
+ 440:	ff 75 08             	push   0x8(%ebp)
+ 443:	e8 b3 03 00 00       	call   7fb <fstat>
+ 448:	83 c4 10             	add    $0x10,%esp
+ 44b:	85 c0                	test   %eax,%eax
+ 44d:	78 09                	js     458 <committed+0x28>
+  if(st.dirty)
+ 44f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 452:	85 c0                	test   %eax,%eax
+ 454:	75 0f                	jne    465 <committed+0x35>
+}
+ 456:	c9                   	leave
+ 457:	c3                   	ret
+    fail("fstat");
+ 458:	83 ec 0c             	sub    $0xc,%esp
+ 45b:	68 7d 0c 00 00       	push   $0xc7d
+ 460:	e8 6b ff ff ff       	call   3d0 <fail>
+    fail(msg);
+ 465:	83 ec 0c             	sub    $0xc,%esp
+ 468:	ff 75 0c             	push   0xc(%ebp)
+ 46b:	e8 60 ff ff ff       	call   3d0 <fail>
+
+00000470 <check>:
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	83 ec 24             	sub    $0x24,%esp
+  if((fd = open(name, O_RDONLY)) < 0)
+ 479:	6a 00                	push   $0x0
+ 47b:	ff 75 08             	push   0x8(%ebp)
+ 47e:	e8 60 03 00 00       	call   7e3 <open>
+ 483:	83 c4 10             	add    $0x10,%esp
+ 486:	85 c0                	test   %eax,%eax
+ 488:	0f 88 ab 00 00 00    	js     539 <check+0xc9>
+      if(buf[j] != 'a' + (i + j) % 26)
+ 48e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < NBLOCK; i++){
+ 491:	31 ff                	xor    %edi,%edi
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+    if(read(fd, buf, BSIZE) != BSIZE)
+ 498:	83 ec 04             	sub    $0x4,%esp
+ 49b:	68 00 02 00 00       	push   $0x200
+ 4a0:	68 e0 11 00 00       	push   $0x11e0
+ 4a5:	ff 75 e4             	push   -0x1c(%ebp)
+ 4a8:	e8 0e 03 00 00       	call   7bb <read>
+ 4ad:	83 c4 10             	add    $0x10,%esp
+ 4b0:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 4b5:	75 75                	jne    52c <check+0xbc>
+    for(j = 0; j < BSIZE; j++)
+ 4b7:	31 db                	xor    %ebx,%ebx
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(buf[j] != 'a' + (i + j) % 26)
+ 4c0:	8d 0c 1f             	lea    (%edi,%ebx,1),%ecx
+ 4c3:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+ 4c8:	0f be b3 e0 11 00 00 	movsbl 0x11e0(%ebx),%esi
+ 4cf:	f7 e1                	mul    %ecx
+ 4d1:	c1 ea 03             	shr    $0x3,%edx
+ 4d4:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 4d7:	29 d1                	sub    %edx,%ecx
+ 4d9:	83 c1 61             	add    $0x61,%ecx
+ 4dc:	39 ce                	cmp    %ecx,%esi
+ 4de:	75 3f                	jne    51f <check+0xaf>
+    for(j = 0; j < BSIZE; j++)
+ 4e0:	83 c3 01             	add    $0x1,%ebx
+ 4e3:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+ 4e9:	75 d5                	jne    4c0 <check+0x50>
+  for(i = 0; i < NBLOCK; i++){
+ 4eb:	83 c7 01             	add    $0x1,%edi
+ 4ee:	83 ff 14             	cmp    $0x14,%edi
+ 4f1:	75 a5                	jne    498 <check+0x28>
+  if(read(fd, buf, BSIZE) != 0)
+ 4f3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 4f6:	83 ec 04             	sub    $0x4,%esp
+ 4f9:	68 00 02 00 00       	push   $0x200
+ 4fe:	68 e0 11 00 00       	push   $0x11e0
+ 503:	56                   	push   %esi
+ 504:	e8 b2 02 00 00       	call   7bb <read>
+ 509:	83 c4 10             	add    $0x10,%esp
+ 50c:	85 c0                	test   %eax,%eax
+ 50e:	75 36                	jne    546 <check+0xd6>
+  close(fd);
+ 510:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+ 513:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 516:	5b                   	pop    %ebx
+ 517:	5e                   	pop    %esi
+ 518:	5f                   	pop    %edi
+ 519:	5d                   	pop    %ebp
+  close(fd);
+ 51a:	e9 ac 02 00 00       	jmp    7cb <close>
+        fail("wrong data");
+ 51f:	83 ec 0c             	sub    $0xc,%esp
+ 522:	68 a1 0c 00 00       	push   $0xca1
+ 527:	e8 a4 fe ff ff       	call   3d0 <fail>
+      fail("short read");
+ 52c:	83 ec 0c             	sub    $0xc,%esp
+ 52f:	68 96 0c 00 00       	push   $0xc96
+ 534:	e8 97 fe ff ff       	call   3d0 <fail>
+    fail("cannot reopen file");
+ 539:	83 ec 0c             	sub    $0xc,%esp
+ 53c:	68 83 0c 00 00       	push   $0xc83
+ 541:	e8 8a fe ff ff       	call   3d0 <fail>
+    fail("file too long");
+ 546:	83 ec 0c             	sub    $0xc,%esp
+ 549:	68 ac 0c 00 00       	push   $0xcac
+ 54e:	e8 7d fe ff ff       	call   3d0 <fail>
+ 553:	66 90                	xchg   %ax,%ax
+ 555:	66 90                	xchg   %ax,%ax
+ 557:	66 90                	xchg   %ax,%ax
+ 559:	66 90                	xchg   %ax,%ax
+ 55b:	66 90                	xchg   %ax,%ax
+ 55d:	66 90                	xchg   %ax,%ax
+ 55f:	90                   	nop
+
+00000560 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 560:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 561:	31 c0                	xor    %eax,%eax
+{
+ 563:	89 e5                	mov    %esp,%ebp
+ 565:	53                   	push   %ebx
+ 566:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 569:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 570:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 574:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 577:	83 c0 01             	add    $0x1,%eax
+ 57a:	84 d2                	test   %dl,%dl
+ 57c:	75 f2                	jne    570 <strcpy+0x10>
+    ;
+  return os;
+}
+ 57e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 581:	89 c8                	mov    %ecx,%eax
+ 583:	c9                   	leave
+ 584:	c3                   	ret
+ 585:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	53                   	push   %ebx
+ 594:	8b 55 08             	mov    0x8(%ebp),%edx
+ 597:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 59a:	0f b6 02             	movzbl (%edx),%eax
+ 59d:	84 c0                	test   %al,%al
+ 59f:	75 17                	jne    5b8 <strcmp+0x28>
+ 5a1:	eb 3a                	jmp    5dd <strcmp+0x4d>
+ 5a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5a7:	90                   	nop
+ 5a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 5ac:	83 c2 01             	add    $0x1,%edx
+ 5af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 5b2:	84 c0                	test   %al,%al
+ 5b4:	74 1a                	je     5d0 <strcmp+0x40>
+    p++, q++;
+ 5b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 5b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 5bb:	38 c3                	cmp    %al,%bl
+ 5bd:	74 e9                	je     5a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 5bf:	29 d8                	sub    %ebx,%eax
+}
+ 5c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5c4:	c9                   	leave
+ 5c5:	c3                   	ret
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5d4:	31 c0                	xor    %eax,%eax
+ 5d6:	29 d8                	sub    %ebx,%eax
+}
+ 5d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5db:	c9                   	leave
+ 5dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 5e0:	31 c0                	xor    %eax,%eax
+ 5e2:	eb db                	jmp    5bf <strcmp+0x2f>
+ 5e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+
+000005f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5f9:	74 15                	je     610 <strlen+0x20>
+ 5fb:	31 c0                	xor    %eax,%eax
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 600:	83 c0 01             	add    $0x1,%eax
+ 603:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 607:	89 c1                	mov    %eax,%ecx
+ 609:	75 f5                	jne    600 <strlen+0x10>
+    ;
+  return n;
+}
+ 60b:	89 c8                	mov    %ecx,%eax
+ 60d:	5d                   	pop    %ebp
+ 60e:	c3                   	ret
+ 60f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 610:	31 c9                	xor    %ecx,%ecx
+}
+ 612:	5d                   	pop    %ebp
+ 613:	89 c8                	mov    %ecx,%eax
+ 615:	c3                   	ret
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000620 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 627:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 62a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 62d:	89 d7                	mov    %edx,%edi
+ 62f:	fc                   	cld
+ 630:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 632:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 635:	89 d0                	mov    %edx,%eax
+ 637:	c9                   	leave
+ 638:	c3                   	ret
+ 639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 64a:	0f b6 10             	movzbl (%eax),%edx
+ 64d:	84 d2                	test   %dl,%dl
+ 64f:	75 12                	jne    663 <strchr+0x23>
+ 651:	eb 1d                	jmp    670 <strchr+0x30>
+ 653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 657:	90                   	nop
+ 658:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 65c:	83 c0 01             	add    $0x1,%eax
+ 65f:	84 d2                	test   %dl,%dl
+ 661:	74 0d                	je     670 <strchr+0x30>
+    if(*s == c)
+ 663:	38 d1                	cmp    %dl,%cl
+ 665:	75 f1                	jne    658 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 667:	5d                   	pop    %ebp
+ 668:	c3                   	ret
+ 669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 670:	31 c0                	xor    %eax,%eax
+}
+ 672:	5d                   	pop    %ebp
+ 673:	c3                   	ret
+ 674:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+
+00000680 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 685:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 688:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 689:	31 db                	xor    %ebx,%ebx
+{
+ 68b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 68e:	eb 27                	jmp    6b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	6a 01                	push   $0x1
+ 695:	56                   	push   %esi
+ 696:	6a 00                	push   $0x0
+ 698:	e8 1e 01 00 00       	call   7bb <read>
+    if(cc < 1)
+ 69d:	83 c4 10             	add    $0x10,%esp
+ 6a0:	85 c0                	test   %eax,%eax
+ 6a2:	7e 1d                	jle    6c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 6a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 6a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 6af:	3c 0a                	cmp    $0xa,%al
+ 6b1:	74 10                	je     6c3 <gets+0x43>
+ 6b3:	3c 0d                	cmp    $0xd,%al
+ 6b5:	74 0c                	je     6c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 6b7:	89 df                	mov    %ebx,%edi
+ 6b9:	83 c3 01             	add    $0x1,%ebx
+ 6bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 6bf:	7c cf                	jl     690 <gets+0x10>
+ 6c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 6ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6cd:	5b                   	pop    %ebx
+ 6ce:	5e                   	pop    %esi
+ 6cf:	5f                   	pop    %edi
+ 6d0:	5d                   	pop    %ebp
+ 6d1:	c3                   	ret
+ 6d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <stat>:
+
+int stat(const char *n, struct stat *st)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	56                   	push   %esi
+ 6e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6e5:	83 ec 08             	sub    $0x8,%esp
+ 6e8:	6a 00                	push   $0x0
+ 6ea:	ff 75 08             	push   0x8(%ebp)
+ 6ed:	e8 f1 00 00 00       	call   7e3 <open>
+  if(fd < 0)
+ 6f2:	83 c4 10             	add    $0x10,%esp
+ 6f5:	85 c0                	test   %eax,%eax
+ 6f7:	78 27                	js     720 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 6f9:	83 ec 08             	sub    $0x8,%esp
+ 6fc:	ff 75 0c             	push   0xc(%ebp)
+ 6ff:	89 c3                	mov    %eax,%ebx
+ 701:	50                   	push   %eax
+ 702:	e8 f4 00 00 00       	call   7fb <fstat>
+  close(fd);
+ 707:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 70a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 70c:	e8 ba 00 00 00       	call   7cb <close>
+  return r;
+ 711:	83 c4 10             	add    $0x10,%esp
+}
+ 714:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 717:	89 f0                	mov    %esi,%eax
+ 719:	5b                   	pop    %ebx
+ 71a:	5e                   	pop    %esi
+ 71b:	5d                   	pop    %ebp
+ 71c:	c3                   	ret
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 720:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 725:	eb ed                	jmp    714 <stat+0x34>
+ 727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72e:	66 90                	xchg   %ax,%ax
+
+00000730 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	53                   	push   %ebx
+ 734:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 737:	0f be 02             	movsbl (%edx),%eax
+ 73a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 73d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 740:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 745:	77 1e                	ja     765 <atoi+0x35>
+ 747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 750:	83 c2 01             	add    $0x1,%edx
+ 753:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 756:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 75a:	0f be 02             	movsbl (%edx),%eax
+ 75d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 760:	80 fb 09             	cmp    $0x9,%bl
+ 763:	76 eb                	jbe    750 <atoi+0x20>
+  return n;
+}
+ 765:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 768:	89 c8                	mov    %ecx,%eax
+ 76a:	c9                   	leave
+ 76b:	c3                   	ret
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000770 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	8b 45 10             	mov    0x10(%ebp),%eax
+ 778:	8b 55 08             	mov    0x8(%ebp),%edx
+ 77b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 77e:	85 c0                	test   %eax,%eax
+ 780:	7e 13                	jle    795 <memmove+0x25>
+ 782:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 784:	89 d7                	mov    %edx,%edi
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 790:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 791:	39 f8                	cmp    %edi,%eax
+ 793:	75 fb                	jne    790 <memmove+0x20>
+  return vdst;
+}
+ 795:	5e                   	pop    %esi
+ 796:	89 d0                	mov    %edx,%eax
+ 798:	5f                   	pop    %edi
+ 799:	5d                   	pop    %ebp
+ 79a:	c3                   	ret
+
+0000079b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 79b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <exit>:
+SYSCALL(exit)
+ 7a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <wait>:
+SYSCALL(wait)
+ 7ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <pipe>:
+SYSCALL(pipe)
+ 7b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <read>:
+SYSCALL(read)
+ 7bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <write>:
+SYSCALL(write)
+ 7c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <close>:
+SYSCALL(close)
+ 7cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <kill>:
+SYSCALL(kill)
+ 7d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <exec>:
+SYSCALL(exec)
+ 7db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <open>:
+SYSCALL(open)
+ 7e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <mknod>:
+SYSCALL(mknod)
+ 7eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <unlink>:
+SYSCALL(unlink)
+ 7f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <fstat>:
+SYSCALL(fstat)
+ 7fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <link>:
+SYSCALL(link)
+ 803:	b8 13 00 00 00       	mov    $0x13,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <mkdir>:
+SYSCALL(mkdir)
+ 80b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <chdir>:
+SYSCALL(chdir)
+ 813:	b8 09 00 00 00       	mov    $0x9,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <dup>:
+SYSCALL(dup)
+ 81b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <getpid>:
+SYSCALL(getpid)
+ 823:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <sbrk>:
+SYSCALL(sbrk)
+ 82b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <sleep>:
+SYSCALL(sleep)
+ 833:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <uptime>:
+SYSCALL(uptime)
+ 83b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <time_scheduled>:
+SYSCALL(time_scheduled)
+ 843:	b8 16 00 00 00       	mov    $0x16,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <set_sched_priority>:
+SYSCALL(set_sched_priority)
+ 84b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <get_sched_priority>:
+SYSCALL(get_sched_priority)
+ 853:	b8 18 00 00 00       	mov    $0x18,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <fifo_position>:
+SYSCALL(fifo_position)
+ 85b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <printProcessTable>:
+SYSCALL(printProcessTable)
+ 863:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <symlink>:
+SYSCALL(symlink)
+ 86b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <lseek>:
+SYSCALL(lseek)
+ 873:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <fallocate>:
+SYSCALL(fallocate)
+ 87b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <iostats>:
+SYSCALL(iostats)
+ 883:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <fsync>:
+SYSCALL(fsync)
+ 88b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+ 893:	66 90                	xchg   %ax,%ax
+ 895:	66 90                	xchg   %ax,%ax
+ 897:	66 90                	xchg   %ax,%ax
+ 899:	66 90                	xchg   %ax,%ax
+ 89b:	66 90                	xchg   %ax,%ax
+ 89d:	66 90                	xchg   %ax,%ax
+ 89f:	90                   	nop
+
+000008a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	57                   	push   %edi
+ 8a4:	56                   	push   %esi
+ 8a5:	53                   	push   %ebx
+ 8a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8a8:	89 d1                	mov    %edx,%ecx
+{
+ 8aa:	83 ec 3c             	sub    $0x3c,%esp
+ 8ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8b0:	85 d2                	test   %edx,%edx
+ 8b2:	0f 89 80 00 00 00    	jns    938 <printint+0x98>
+ 8b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8bc:	74 7a                	je     938 <printint+0x98>
+    x = -xx;
+ 8be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8c8:	31 f6                	xor    %esi,%esi
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8d0:	89 c8                	mov    %ecx,%eax
+ 8d2:	31 d2                	xor    %edx,%edx
+ 8d4:	89 f7                	mov    %esi,%edi
+ 8d6:	f7 f3                	div    %ebx
+ 8d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8db:	0f b6 92 90 0e 00 00 	movzbl 0xe90(%edx),%edx
+ 8e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8e6:	89 ca                	mov    %ecx,%edx
+ 8e8:	89 c1                	mov    %eax,%ecx
+ 8ea:	39 da                	cmp    %ebx,%edx
+ 8ec:	73 e2                	jae    8d0 <printint+0x30>
+  if(neg)
+ 8ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8f1:	85 c0                	test   %eax,%eax
+ 8f3:	74 07                	je     8fc <printint+0x5c>
+    buf[i++] = '-';
+ 8f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8fa:	89 f7                	mov    %esi,%edi
+ 8fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 902:	01 df                	add    %ebx,%edi
+ 904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 908:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 90b:	83 ec 04             	sub    $0x4,%esp
+ 90e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 911:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 914:	6a 01                	push   $0x1
+ 916:	50                   	push   %eax
+ 917:	56                   	push   %esi
+ 918:	e8 a6 fe ff ff       	call   7c3 <write>
+  while(--i >= 0)
+ 91d:	89 f8                	mov    %edi,%eax
+ 91f:	83 c4 10             	add    $0x10,%esp
+ 922:	83 ef 01             	sub    $0x1,%edi
+ 925:	39 d8                	cmp    %ebx,%eax
+ 927:	75 df                	jne    908 <printint+0x68>
+}
+ 929:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 92c:	5b                   	pop    %ebx
+ 92d:	5e                   	pop    %esi
+ 92e:	5f                   	pop    %edi
+ 92f:	5d                   	pop    %ebp
+ 930:	c3                   	ret
+ 931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 938:	31 c0                	xor    %eax,%eax
+ 93a:	eb 89                	jmp    8c5 <printint+0x25>
+ 93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000940 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 949:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 94c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 94f:	0f b6 1e             	movzbl (%esi),%ebx
+ 952:	83 c6 01             	add    $0x1,%esi
+ 955:	84 db                	test   %bl,%bl
+ 957:	74 67                	je     9c0 <printf+0x80>
+ 959:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 95c:	31 d2                	xor    %edx,%edx
+ 95e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 961:	eb 34                	jmp    997 <printf+0x57>
+ 963:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 967:	90                   	nop
+ 968:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 96b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 970:	83 f8 25             	cmp    $0x25,%eax
+ 973:	74 18                	je     98d <printf+0x4d>
+  write(fd, &c, 1);
+ 975:	83 ec 04             	sub    $0x4,%esp
+ 978:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 97b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 97e:	6a 01                	push   $0x1
+ 980:	50                   	push   %eax
+ 981:	57                   	push   %edi
+ 982:	e8 3c fe ff ff       	call   7c3 <write>
+ 987:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 98a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 98d:	0f b6 1e             	movzbl (%esi),%ebx
+ 990:	83 c6 01             	add    $0x1,%esi
+ 993:	84 db                	test   %bl,%bl
+ 995:	74 29                	je     9c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 997:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 99a:	85 d2                	test   %edx,%edx
+ 99c:	74 ca                	je     968 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 99e:	83 fa 25             	cmp    $0x25,%edx
+ 9a1:	75 ea                	jne    98d <printf+0x4d>
+      if(c == 'd'){
+ 9a3:	83 f8 25             	cmp    $0x25,%eax
+ 9a6:	0f 84 24 01 00 00    	je     ad0 <printf+0x190>
+ 9ac:	83 e8 63             	sub    $0x63,%eax
+ 9af:	83 f8 15             	cmp    $0x15,%eax
+ 9b2:	77 1c                	ja     9d0 <printf+0x90>
+ 9b4:	ff 24 85 38 0e 00 00 	jmp    *0xe38(,%eax,4)
+ 9bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9c3:	5b                   	pop    %ebx
+ 9c4:	5e                   	pop    %esi
+ 9c5:	5f                   	pop    %edi
+ 9c6:	5d                   	pop    %ebp
+ 9c7:	c3                   	ret
+ 9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9da:	6a 01                	push   $0x1
+ 9dc:	52                   	push   %edx
+ 9dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9e0:	57                   	push   %edi
+ 9e1:	e8 dd fd ff ff       	call   7c3 <write>
+ 9e6:	83 c4 0c             	add    $0xc,%esp
+ 9e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ec:	6a 01                	push   $0x1
+ 9ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9f1:	52                   	push   %edx
+ 9f2:	57                   	push   %edi
+ 9f3:	e8 cb fd ff ff       	call   7c3 <write>
+        putc(fd, c);
+ 9f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9fb:	31 d2                	xor    %edx,%edx
+ 9fd:	eb 8e                	jmp    98d <printf+0x4d>
+ 9ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a0b:	8b 13                	mov    (%ebx),%edx
+ a0d:	6a 00                	push   $0x0
+ a0f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a11:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a14:	e8 87 fe ff ff       	call   8a0 <printint>
+        ap++;
+ a19:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a1c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a1f:	31 d2                	xor    %edx,%edx
+ a21:	e9 67 ff ff ff       	jmp    98d <printf+0x4d>
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a30:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a33:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a35:	83 c0 04             	add    $0x4,%eax
+ a38:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a3b:	85 db                	test   %ebx,%ebx
+ a3d:	0f 84 9d 00 00 00    	je     ae0 <printf+0x1a0>
+        while(*s != 0){
+ a43:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a46:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a48:	84 c0                	test   %al,%al
+ a4a:	0f 84 3d ff ff ff    	je     98d <printf+0x4d>
+ a50:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a53:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a56:	89 de                	mov    %ebx,%esi
+ a58:	89 d3                	mov    %edx,%ebx
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a60:	83 ec 04             	sub    $0x4,%esp
+ a63:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a66:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a69:	6a 01                	push   $0x1
+ a6b:	53                   	push   %ebx
+ a6c:	57                   	push   %edi
+ a6d:	e8 51 fd ff ff       	call   7c3 <write>
+        while(*s != 0){
+ a72:	0f b6 06             	movzbl (%esi),%eax
+ a75:	83 c4 10             	add    $0x10,%esp
+ a78:	84 c0                	test   %al,%al
+ a7a:	75 e4                	jne    a60 <printf+0x120>
+      state = 0;
+ a7c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a7f:	31 d2                	xor    %edx,%edx
+ a81:	e9 07 ff ff ff       	jmp    98d <printf+0x4d>
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a93:	83 ec 0c             	sub    $0xc,%esp
+ a96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a9b:	8b 13                	mov    (%ebx),%edx
+ a9d:	6a 01                	push   $0x1
+ a9f:	e9 6b ff ff ff       	jmp    a0f <printf+0xcf>
+ aa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ aa8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ aab:	83 ec 04             	sub    $0x4,%esp
+ aae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ab1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ab3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ab6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ab9:	6a 01                	push   $0x1
+ abb:	52                   	push   %edx
+ abc:	57                   	push   %edi
+ abd:	e8 01 fd ff ff       	call   7c3 <write>
+        ap++;
+ ac2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ac5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ac8:	31 d2                	xor    %edx,%edx
+ aca:	e9 be fe ff ff       	jmp    98d <printf+0x4d>
+ acf:	90                   	nop
+  write(fd, &c, 1);
+ ad0:	83 ec 04             	sub    $0x4,%esp
+ ad3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ad6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ad9:	6a 01                	push   $0x1
+ adb:	e9 11 ff ff ff       	jmp    9f1 <printf+0xb1>
+ ae0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ae5:	bb 2f 0e 00 00       	mov    $0xe2f,%ebx
+ aea:	e9 61 ff ff ff       	jmp    a50 <printf+0x110>
+ aef:	90                   	nop
+
+00000af0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ af0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ af1:	a1 e0 13 00 00       	mov    0x13e0,%eax
+{
+ af6:	89 e5                	mov    %esp,%ebp
+ af8:	57                   	push   %edi
+ af9:	56                   	push   %esi
+ afa:	53                   	push   %ebx
+ afb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ afe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b0c:	39 ca                	cmp    %ecx,%edx
+ b0e:	73 30                	jae    b40 <free+0x50>
+ b10:	39 c1                	cmp    %eax,%ecx
+ b12:	72 04                	jb     b18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b14:	39 c2                	cmp    %eax,%edx
+ b16:	72 f0                	jb     b08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b1e:	39 f8                	cmp    %edi,%eax
+ b20:	74 2e                	je     b50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b25:	8b 42 04             	mov    0x4(%edx),%eax
+ b28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b2b:	39 f1                	cmp    %esi,%ecx
+ b2d:	74 38                	je     b67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b31:	5b                   	pop    %ebx
+  freep = p;
+ b32:	89 15 e0 13 00 00    	mov    %edx,0x13e0
+}
+ b38:	5e                   	pop    %esi
+ b39:	5f                   	pop    %edi
+ b3a:	5d                   	pop    %ebp
+ b3b:	c3                   	ret
+ b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b40:	39 c1                	cmp    %eax,%ecx
+ b42:	72 d0                	jb     b14 <free+0x24>
+ b44:	eb c2                	jmp    b08 <free+0x18>
+ b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b50:	03 70 04             	add    0x4(%eax),%esi
+ b53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b56:	8b 02                	mov    (%edx),%eax
+ b58:	8b 00                	mov    (%eax),%eax
+ b5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b5d:	8b 42 04             	mov    0x4(%edx),%eax
+ b60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b63:	39 f1                	cmp    %esi,%ecx
+ b65:	75 c8                	jne    b2f <free+0x3f>
+    p->s.size += bp->s.size;
+ b67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b6a:	89 15 e0 13 00 00    	mov    %edx,0x13e0
+    p->s.size += bp->s.size;
+ b70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b76:	89 0a                	mov    %ecx,(%edx)
+}
+ b78:	5b                   	pop    %ebx
+ b79:	5e                   	pop    %esi
+ b7a:	5f                   	pop    %edi
+ b7b:	5d                   	pop    %ebp
+ b7c:	c3                   	ret
+ b7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	57                   	push   %edi
+ b84:	56                   	push   %esi
+ b85:	53                   	push   %ebx
+ b86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b8c:	8b 15 e0 13 00 00    	mov    0x13e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b92:	8d 78 07             	lea    0x7(%eax),%edi
+ b95:	c1 ef 03             	shr    $0x3,%edi
+ b98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b9b:	85 d2                	test   %edx,%edx
+ b9d:	0f 84 8d 00 00 00    	je     c30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ba5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ba8:	39 f9                	cmp    %edi,%ecx
+ baa:	73 64                	jae    c10 <malloc+0x90>
+  if(nu < 4096)
+ bac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ bb1:	39 df                	cmp    %ebx,%edi
+ bb3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bb6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bbd:	eb 0a                	jmp    bc9 <malloc+0x49>
+ bbf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bc0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bc2:	8b 48 04             	mov    0x4(%eax),%ecx
+ bc5:	39 f9                	cmp    %edi,%ecx
+ bc7:	73 47                	jae    c10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ bc9:	89 c2                	mov    %eax,%edx
+ bcb:	39 05 e0 13 00 00    	cmp    %eax,0x13e0
+ bd1:	75 ed                	jne    bc0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ bd3:	83 ec 0c             	sub    $0xc,%esp
+ bd6:	56                   	push   %esi
+ bd7:	e8 4f fc ff ff       	call   82b <sbrk>
+  if(p == (char*)-1)
+ bdc:	83 c4 10             	add    $0x10,%esp
+ bdf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ be2:	74 1c                	je     c00 <malloc+0x80>
+  hp->s.size = nu;
+ be4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ be7:	83 ec 0c             	sub    $0xc,%esp
+ bea:	83 c0 08             	add    $0x8,%eax
+ bed:	50                   	push   %eax
+ bee:	e8 fd fe ff ff       	call   af0 <free>
+  return freep;
+ bf3:	8b 15 e0 13 00 00    	mov    0x13e0,%edx
+      if((p = morecore(nunits)) == 0)
+ bf9:	83 c4 10             	add    $0x10,%esp
+ bfc:	85 d2                	test   %edx,%edx
+ bfe:	75 c0                	jne    bc0 <malloc+0x40>
+        return 0;
+  }
+}
+ c00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c03:	31 c0                	xor    %eax,%eax
+}
+ c05:	5b                   	pop    %ebx
+ c06:	5e                   	pop    %esi
+ c07:	5f                   	pop    %edi
+ c08:	5d                   	pop    %ebp
+ c09:	c3                   	ret
+ c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c10:	39 cf                	cmp    %ecx,%edi
+ c12:	74 4c                	je     c60 <malloc+0xe0>
+        p->s.size -= nunits;
+ c14:	29 f9                	sub    %edi,%ecx
+ c16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c1f:	89 15 e0 13 00 00    	mov    %edx,0x13e0
+}
+ c25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c28:	83 c0 08             	add    $0x8,%eax
+}
+ c2b:	5b                   	pop    %ebx
+ c2c:	5e                   	pop    %esi
+ c2d:	5f                   	pop    %edi
+ c2e:	5d                   	pop    %ebp
+ c2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c30:	c7 05 e0 13 00 00 e4 	movl   $0x13e4,0x13e0
+ c37:	13 00 00 
+    base.s.size = 0;
+ c3a:	b8 e4 13 00 00       	mov    $0x13e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ c3f:	c7 05 e4 13 00 00 e4 	movl   $0x13e4,0x13e4
+ c46:	13 00 00 
+    base.s.size = 0;
+ c49:	c7 05 e8 13 00 00 00 	movl   $0x0,0x13e8
+ c50:	00 00 00 
+    if(p->s.size >= nunits){
+ c53:	e9 54 ff ff ff       	jmp    bac <malloc+0x2c>
+ c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c60:	8b 08                	mov    (%eax),%ecx
+ c62:	89 0a                	mov    %ecx,(%edx)
+ c64:	eb b9                	jmp    c1f <malloc+0x9f>
@@ -0,0 +1,132 @@
+// Test fsync() and O_SYNC: both return once the data is
+// committed, which fstat() reports in st.dirty, and leave it
+// readable; fsync() refuses descriptors that are not files.
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+
+#define NBLOCK 20
+
+char buf[BSIZE];
+
+void
+fail(char *msg)
+{
+  printf(1, "synctest failed: %s\n", msg);
+  exit();
+}
+
+// Fill buf with the pattern for block i of a file.
+void
+fill(int i)
+{
+  int j;
+
+  for(j = 0; j < BSIZE; j++)
+    buf[j] = 'a' + (i + j) % 26;
+}
+
+// Check that the changes to fd have committed.
+void
+committed(int fd, char *msg)
+{
+  struct stat st;
+
+  if(fstat(fd, &st) < 0)
+    fail("fstat");
+  if(st.dirty)
+    fail(msg);
+}
+
+// Check that name holds NBLOCK blocks of the pattern.
+void
+check(char *name)
+{
+  int fd, i, j;
+
+  if((fd = open(name, O_RDONLY)) < 0)
+    fail("cannot reopen file");
+  for(i = 0; i < NBLOCK; i++){
+    if(read(fd, buf, BSIZE) != BSIZE)
+      fail("short read");
+    for(j = 0; j < BSIZE; j++)
+      if(buf[j] != 'a' + (i + j) % 26)
+        fail("wrong data");
+  }
+  if(read(fd, buf, BSIZE) != 0)
+    fail("file too long");
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, p[2];
+
+  printf(1, "synctest starting\n");
+
+  // Writes followed by fsync().
+  unlink("sync.a");
+  if((fd = open("sync.a", O_CREATE|O_RDWR)) < 0)
+    fail("cannot create file");
+  for(i = 0; i < NBLOCK; i++){
+    fill(i);
+    if(write(fd, buf, BSIZE) != BSIZE)
+      fail("write");
+  }
+  if(fsync(fd) != 0)
+    fail("fsync");
+  committed(fd, "fsync returned before the commit");
+  if(fsync(fd) != 0)
+    fail("fsync with nothing to commit");
+  close(fd);
+  check("sync.a");
+  unlink("sync.a");
+
+  // O_SYNC writes, to a regular and to an extent file.
+  unlink("sync.b");
+  if((fd = open("sync.b", O_CREATE|O_RDWR|O_SYNC)) < 0)
+    fail("cannot create O_SYNC file");
+  for(i = 0; i < NBLOCK; i++){
+    fill(i);
+    if(write(fd, buf, BSIZE) != BSIZE)
+      fail("O_SYNC write");
+    committed(fd, "O_SYNC write returned before the commit");
+  }
+  close(fd);
+  check("sync.b");
+  unlink("sync.b");
+
+  unlink("sync.c");
+  if((fd = open("sync.c", O_EXTENT)) < 0)
+    fail("cannot create extent file");
+  close(fd);
+  if((fd = open("sync.c", O_RDWR|O_SYNC)) < 0)
+    fail("cannot open extent file O_SYNC");
+  for(i = 0; i < NBLOCK; i++){
+    fill(i);
+    if(write(fd, buf, BSIZE) != BSIZE)
+      fail("O_SYNC write to extent file");
+    committed(fd, "O_SYNC write returned before the commit");
+  }
+  if(fsync(fd) != 0)
+    fail("fsync of extent file");
+  close(fd);
+  check("sync.c");
+  unlink("sync.c");
+
+  // Only files can be synced.
+  if(fsync(-1) != -1 || fsync(fd) != -1)
+    fail("fsync of a bad descriptor");
+  if(pipe(p) < 0)
+    fail("pipe");
+  if(fsync(p[0]) != -1)
+    fail("fsync of a pipe");
+  close(p[0]);
+  close(p[1]);
+
+  printf(1, "synctest ok\n");
+  exit();
+}
@@ -118,6 +118,9 @@ extern int sys_symlink(void);
 
 //JTM - Add lseek system call
 extern int sys_lseek(void);
+extern int sys_fallocate(void);
+extern int sys_iostats(void);
+extern int sys_fsync(void);
 
 
 static int (*syscalls[])(void) = {
@@ -149,6 +152,9 @@ static int (*syscalls[])(void) = {
 [SYS_printProcessTable] sys_printProcessTable,
 [SYS_symlink] sys_symlink,
 [SYS_lseek] sys_lseek,
+[SYS_fallocate] sys_fallocate,
+[SYS_iostats] sys_iostats,
+[SYS_fsync] sys_fsync,
 };
 
 void
@@ -27,4 +27,6 @@
 #define SYS_printProcessTable 26
 #define SYS_symlink 27
 #define SYS_lseek 28
-
+#define SYS_fallocate 29
+#define SYS_iostats 30
+#define SYS_fsync 31
@@ -62,6 +62,58 @@ argfd(int n, int *pfd, struct file **pf)
   return 0;
 }
 
+// Reserve disk space for bytes [off, off+len) of an extent file
+// without writing it.  The blocks read as zeros until written.
+int
+sys_fallocate(void)
+{
+  struct file *f;
+  int off, len, r;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &len) < 0)
+    return -1;
+  if(f->type != FD_INODE || f->writable == 0 || off < 0 || len <= 0)
+    return -1;
+
+  // One run of blocks per transaction, to stay within the log.
+  do {
+    begin_op();
+    ilock(f->ip);
+    r = falloci(f->ip, off, len);
+    iunlock(f->ip);
+    end_op();
+  } while(r > 0);
+
+  return r;
+}
+
+// Wait until the changes to fd's file are on disk.  Other
+// changes in the same transactions go with them.
+int
+sys_fsync(void)
+{
+  struct file *f;
+  uint t;
+
+  if(argfd(0, 0, &f) < 0 || f->type != FD_INODE)
+    return -1;
+  ilock(f->ip);
+  t = f->ip->txn;
+  iunlock(f->ip);
+  log_sync(t);
+  return 0;
+}
+
+// Print file system I/O counters on the console.
+int
+sys_iostats(void)
+{
+  bstats();
+  idestats();
+  logstats();
+  return 0;
+}
+
 // Allocate a file descriptor for the given file.
 // Takes over file reference from caller on success.
 static int
@@ -260,42 +312,44 @@ bad:
   return -1;
 }
 
+// Open the locked inode ip as a file of the given type, and end
+// the caller's op.  Every open ends here, so this is where inodes
+// that cannot be opened are refused.
+static int
+openinode(struct inode *ip, int type, int omode)
+{
+  struct file *f;
+  int fd;
+
+  f = 0;
+  if((ip->type == T_DIR && omode != O_RDONLY) || ip->ebad ||
+     (f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+    if(f)
+      fileclose(f);
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+  end_op();
+
+  f->type = type;
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+  f->sync = (omode & O_SYNC) != 0;
+  return fd;
+}
+
 // Project 4 - Part 2 - Stuff n thingz.
 int openSymLink(char* path, int omode, struct inode* ip, int depth) {
   struct inode *indexNodeTarget;
-  struct file *targetFile;
-  int fd;
 
   // If the O_NOFOLLOW Flag is specified, open the symlink file, not the symlink's target
   if(omode & O_NOFOLLOW) {
      omode = O_RDONLY; // change OMODE to O_RDONLY so we can read the symlink
-
-     indexNodeTarget = ip;
-        
-      iunlock(ip); // we no longer need the symlink's index node.
-
-      if((targetFile = filealloc()) == 0 || (fd = fdalloc(targetFile)) < 0) {
-          // Something went wrong.
-          cprintf("Symlink O_NOFOLLOW file open error: Something went wrong opening the target file.");
-
-          if(targetFile) {
-            fileclose(targetFile);
-          }
-
-          iunlockput(indexNodeTarget);
-          end_op();
-          return -1;
-      }
-
-      end_op();
-
-      targetFile->type = SYMLINK;
-      targetFile->ip = indexNodeTarget;
-      targetFile->off = 0;
-      targetFile->readable = !(omode & O_WRONLY);
-      targetFile->writable = (omode & O_WRONLY) || (omode & O_RDWR);
-
-      return fd;
+     return openinode(ip, SYMLINK, omode);
   } else {
       if((indexNodeTarget = namei((char*)ip->addrs)) == 0) {
           // Something went wrong. Project 4 Requirements: If the symlink's target file does not exist, then open fails. 
@@ -312,42 +366,16 @@ int openSymLink(char* path, int omode, struct inode* ip, int depth) {
           return -1;
         }
 
+      iunlock(ip); // we no longer need the symlink's index node.
+      ilock(indexNodeTarget);
+
       // Check if the file we opened is just another symlink, if so then recursively follow
       // until we get to an actual target file (and not a symlink file) and then open that (or fail if it doesnt exist)
       if (indexNodeTarget->type == T_SYMLINK) {
-          depth++;
-          iunlock(ip); // we no longer need the symlink's index node.
-          ilock(indexNodeTarget);
-          fd = openSymLink(path, omode, indexNodeTarget, depth);
-          return fd;
-      } else {
-        depth = 0;
-      }
-
-      iunlock(ip); // we no longer need the symlink's index node.
-
-      if((targetFile = filealloc()) == 0 || (fd = fdalloc(targetFile)) < 0) {
-          // Something went wrong.
-          cprintf("Symlink file open error: Something went wrong opening the target file.");
-
-          if(targetFile) {
-            fileclose(targetFile);
-          }
-
-          iunlockput(indexNodeTarget);
-          end_op();
-          return -1;
+          return openSymLink(path, omode, indexNodeTarget, depth + 1);
       }
 
-      end_op();
-
-      targetFile->type = FD_INODE;
-      targetFile->ip = indexNodeTarget;
-      targetFile->off = 0;
-      targetFile->readable = !(omode & O_WRONLY);
-      targetFile->writable = (omode & O_WRONLY) || (omode & O_RDWR);
-
-      return fd;
+      return openinode(indexNodeTarget, FD_INODE, omode);
   } // end if-else O_NOFOLLOW
 } // end openSymLink()
 
@@ -424,8 +452,7 @@ static struct inode* create(char *path, short type, short major, short minor, ch
 
 int sys_open(void) {
   char *path;
-  int fd, omode;
-  struct file *f;
+  int omode;
   struct inode *ip;
   
   if(argstr(0, &path) < 0 || argint(1, &omode) < 0) {
@@ -447,11 +474,6 @@ int sys_open(void) {
       end_op();
       return -1;
     }
-    
-    ip->numExtents = 0;
-    ip->sisterblocks = 0;
-    ip->eOffset = 0;
-    ip->lOffset = 0;
 
   } else {
         if((ip = namei(path)) == 0){
@@ -459,40 +481,14 @@ int sys_open(void) {
           return -1;
         }
         ilock(ip);
-        if(ip->type == T_DIR && omode != O_RDONLY){
-          iunlockput(ip);
-          end_op();
-          return -1;
-        }
   } // end if-else omode create
 
   // Check for SymLinks, if so then we open the symLinkFile, and then find it's target file, and then actually open that target file.
   if (ip->type == T_SYMLINK) {
-      fd = openSymLink(path, omode, ip, 0);
-      return fd;
+      return openSymLink(path, omode, ip, 0);
   }
 
-  if ((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0) {
-    if(f) {
-      fileclose(f);
-    }
-
-    iunlockput(ip);
-    end_op();
-    return -1;
-  }
-  ip->eOffset = 0;
-  ip->lOffset = 0;
-  iunlock(ip);
-  end_op();
-
-  f->type = FD_INODE;
-  f->ip = ip;
-  f->off = 0;
-  f->readable = !(omode & O_WRONLY);
-  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
-
-  return fd;
+  return openinode(ip, FD_INODE, omode);
 } // end sys_open()
 
 int
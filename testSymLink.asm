@@ -0,0 +1,1973 @@
+
+_testSymLink:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    close(fileDescriptor2);
+}// end symLinkTest6()
+
+// start main()
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+
+    // Test 1: Create a symlink to an existing file. Prove the symlink works by opening and printing out the symlink. (no flags)
+    // We will be creating a symlink to the README file, and then proving it works.
+    printf(1, "\n\n---------------------------------------------------------------------------------------------------------------\n");
+  11:	68 44 1b 00 00       	push   $0x1b44
+  16:	6a 01                	push   $0x1
+  18:	e8 03 0c 00 00       	call   c20 <printf>
+    symLinkTest1("README", "symA");
+  1d:	58                   	pop    %eax
+  1e:	5a                   	pop    %edx
+  1f:	68 4f 1c 00 00       	push   $0x1c4f
+  24:	68 7a 1c 00 00       	push   $0x1c7a
+  29:	e8 32 01 00 00       	call   160 <symLinkTest1>
+
+    // Test 2: Project 4 Part 2 Requirement Demo: "Target does not need to exist for symlink to succeed, but if it does not, then open must fail."
+    // In this test we are creating a symlink to a non-existant file and then attempting to open it.
+    printf(1, "\n\n---------------------------------------------------------------------------------------------------------------\n");
+  2e:	59                   	pop    %ecx
+  2f:	58                   	pop    %eax
+  30:	68 44 1b 00 00       	push   $0x1b44
+  35:	6a 01                	push   $0x1
+  37:	e8 e4 0b 00 00       	call   c20 <printf>
+    symLinkTest2("DEADFILE", "symB");
+  3c:	58                   	pop    %eax
+  3d:	5a                   	pop    %edx
+  3e:	68 81 1c 00 00       	push   $0x1c81
+  43:	68 86 1c 00 00       	push   $0x1c86
+  48:	e8 23 02 00 00       	call   270 <symLinkTest2>
+    unlink("symB"); // clean up
+  4d:	c7 04 24 81 1c 00 00 	movl   $0x1c81,(%esp)
+  54:	e8 7a 0a 00 00       	call   ad3 <unlink>
+
+    // Test 3: Project 4 Part 2 Requirement Demo: "O_NOFOLLOW flags should open the symlink (and not follow the symbolic link)."
+    printf(1, "\n\n---------------------------------------------------------------------------------------------------------------\n");
+  59:	59                   	pop    %ecx
+  5a:	58                   	pop    %eax
+  5b:	68 44 1b 00 00       	push   $0x1b44
+  60:	6a 01                	push   $0x1
+  62:	e8 b9 0b 00 00       	call   c20 <printf>
+    symLinkTest3("README", "symC");
+  67:	58                   	pop    %eax
+  68:	5a                   	pop    %edx
+  69:	68 8f 1c 00 00       	push   $0x1c8f
+  6e:	68 7a 1c 00 00       	push   $0x1c7a
+  73:	e8 88 02 00 00       	call   300 <symLinkTest3>
+    unlink("symC"); // clean up
+  78:	c7 04 24 8f 1c 00 00 	movl   $0x1c8f,(%esp)
+  7f:	e8 4f 0a 00 00       	call   ad3 <unlink>
+
+    // Test 4: Project 4 - Part 2 Requirement: Recursively follow symlinks until a non-link file is reached. If links form a cycle and depth of
+    // 10 is reached, then print out an error about this.
+    printf(1, "\n\n---------------------------------------------------------------------------------------------------------------\n");
+  84:	59                   	pop    %ecx
+  85:	58                   	pop    %eax
+  86:	68 44 1b 00 00       	push   $0x1b44
+  8b:	6a 01                	push   $0x1
+  8d:	e8 8e 0b 00 00       	call   c20 <printf>
+    symLinkTest4("README");
+  92:	c7 04 24 7a 1c 00 00 	movl   $0x1c7a,(%esp)
+  99:	e8 62 03 00 00       	call   400 <symLinkTest4>
+
+    // Test 5: Demonstrate that if we are in a recursive symlink loop, and a depth of 10 is already reached, we print out an error and stop.
+    printf(1, "\n\n---------------------------------------------------------------------------------------------------------------\n");
+  9e:	58                   	pop    %eax
+  9f:	5a                   	pop    %edx
+  a0:	68 44 1b 00 00       	push   $0x1b44
+  a5:	6a 01                	push   $0x1
+  a7:	e8 74 0b 00 00       	call   c20 <printf>
+    symLinkTest5();
+  ac:	e8 6f 05 00 00       	call   620 <symLinkTest5>
+
+    // Test 6: Demonstrate that linking and unlinking operate on the symbolic link itself.
+    printf(1, "\n\n---------------------------------------------------------------------------------------------------------------\n");
+  b1:	59                   	pop    %ecx
+  b2:	58                   	pop    %eax
+  b3:	68 44 1b 00 00       	push   $0x1b44
+  b8:	6a 01                	push   $0x1
+  ba:	e8 61 0b 00 00       	call   c20 <printf>
+    symLinkTest6();
+  bf:	e8 ec 05 00 00       	call   6b0 <symLinkTest6>
+    unlink("symA"); // clean up
+  c4:	c7 04 24 4f 1c 00 00 	movl   $0x1c4f,(%esp)
+  cb:	e8 03 0a 00 00       	call   ad3 <unlink>
+
+    // Doing some final cleanup...
+    unlink("sym1");
+  d0:	c7 04 24 f0 1b 00 00 	movl   $0x1bf0,(%esp)
+  d7:	e8 f7 09 00 00       	call   ad3 <unlink>
+    unlink("sym2");
+  dc:	c7 04 24 f5 1b 00 00 	movl   $0x1bf5,(%esp)
+  e3:	e8 eb 09 00 00       	call   ad3 <unlink>
+    unlink("sym3");
+  e8:	c7 04 24 fa 1b 00 00 	movl   $0x1bfa,(%esp)
+  ef:	e8 df 09 00 00       	call   ad3 <unlink>
+    unlink("sym4");
+  f4:	c7 04 24 ff 1b 00 00 	movl   $0x1bff,(%esp)
+  fb:	e8 d3 09 00 00       	call   ad3 <unlink>
+    unlink("sym5");
+ 100:	c7 04 24 04 1c 00 00 	movl   $0x1c04,(%esp)
+ 107:	e8 c7 09 00 00       	call   ad3 <unlink>
+    unlink("sym6");
+ 10c:	c7 04 24 09 1c 00 00 	movl   $0x1c09,(%esp)
+ 113:	e8 bb 09 00 00       	call   ad3 <unlink>
+    unlink("sym7");
+ 118:	c7 04 24 0e 1c 00 00 	movl   $0x1c0e,(%esp)
+ 11f:	e8 af 09 00 00       	call   ad3 <unlink>
+    unlink("sym8");
+ 124:	c7 04 24 13 1c 00 00 	movl   $0x1c13,(%esp)
+ 12b:	e8 a3 09 00 00       	call   ad3 <unlink>
+    unlink("sym9");
+ 130:	c7 04 24 18 1c 00 00 	movl   $0x1c18,(%esp)
+ 137:	e8 97 09 00 00       	call   ad3 <unlink>
+    unlink("sym10");
+ 13c:	c7 04 24 1d 1c 00 00 	movl   $0x1c1d,(%esp)
+ 143:	e8 8b 09 00 00       	call   ad3 <unlink>
+    unlink("sym11"); 
+ 148:	c7 04 24 40 1c 00 00 	movl   $0x1c40,(%esp)
+ 14f:	e8 7f 09 00 00       	call   ad3 <unlink>
+
+    exit();
+ 154:	e8 2a 09 00 00       	call   a83 <exit>
+ 159:	66 90                	xchg   %ax,%ax
+ 15b:	66 90                	xchg   %ax,%ax
+ 15d:	66 90                	xchg   %ax,%ax
+ 15f:	90                   	nop
+
+00000160 <symLinkTest1>:
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+ 165:	53                   	push   %ebx
+ 166:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ 16c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    printf(1, "\nSymlink Test 1: Prove that the symlink works in general.\n");
+ 16f:	68 48 0f 00 00       	push   $0xf48
+ 174:	6a 01                	push   $0x1
+ 176:	e8 a5 0a 00 00       	call   c20 <printf>
+    printf(1, "Symlink Test 1: To prove that symlink() works, we will create a symlink called symA to the README file. We will then open symA, and print out its contents.. which should print out the README file contents. Running Test 1...\n\n");
+ 17b:	59                   	pop    %ecx
+ 17c:	5e                   	pop    %esi
+ 17d:	68 84 0f 00 00       	push   $0xf84
+ 182:	6a 01                	push   $0x1
+ 184:	e8 97 0a 00 00       	call   c20 <printf>
+    int symlinkTest = symlink(target, path);
+ 189:	5f                   	pop    %edi
+ 18a:	58                   	pop    %eax
+ 18b:	53                   	push   %ebx
+ 18c:	ff 75 08             	push   0x8(%ebp)
+ 18f:	e8 b7 09 00 00       	call   b4b <symlink>
+    if (symlinkTest < 0)
+ 194:	83 c4 10             	add    $0x10,%esp
+ 197:	85 c0                	test   %eax,%eax
+ 199:	78 75                	js     210 <symLinkTest1+0xb0>
+    if ((fileDescriptor = open(path, O_RDONLY)) < 0)
+ 19b:	83 ec 08             	sub    $0x8,%esp
+ 19e:	6a 00                	push   $0x0
+ 1a0:	53                   	push   %ebx
+ 1a1:	e8 1d 09 00 00       	call   ac3 <open>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+ 1a9:	89 c7                	mov    %eax,%edi
+ 1ab:	85 c0                	test   %eax,%eax
+ 1ad:	0f 88 9b 00 00 00    	js     24e <symLinkTest1+0xee>
+ 1b3:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+ 1b9:	eb 18                	jmp    1d3 <symLinkTest1+0x73>
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+        if (write(1, buf, n) != n)
+ 1c0:	83 ec 04             	sub    $0x4,%esp
+ 1c3:	53                   	push   %ebx
+ 1c4:	56                   	push   %esi
+ 1c5:	6a 01                	push   $0x1
+ 1c7:	e8 d7 08 00 00       	call   aa3 <write>
+ 1cc:	83 c4 10             	add    $0x10,%esp
+ 1cf:	39 d8                	cmp    %ebx,%eax
+ 1d1:	75 54                	jne    227 <symLinkTest1+0xc7>
+    while ((n = read(fileDescriptor, buf, sizeof(buf))) > 0)
+ 1d3:	83 ec 04             	sub    $0x4,%esp
+ 1d6:	68 00 02 00 00       	push   $0x200
+ 1db:	56                   	push   %esi
+ 1dc:	57                   	push   %edi
+ 1dd:	e8 b9 08 00 00       	call   a9b <read>
+ 1e2:	83 c4 10             	add    $0x10,%esp
+ 1e5:	89 c3                	mov    %eax,%ebx
+ 1e7:	85 c0                	test   %eax,%eax
+ 1e9:	7f d5                	jg     1c0 <symLinkTest1+0x60>
+    if (n < 0)
+ 1eb:	75 4e                	jne    23b <symLinkTest1+0xdb>
+    printf(1, "\n\nSymlink Test 1 passed! :)\n");
+ 1ed:	83 ec 08             	sub    $0x8,%esp
+ 1f0:	68 b7 1b 00 00       	push   $0x1bb7
+ 1f5:	6a 01                	push   $0x1
+ 1f7:	e8 24 0a 00 00       	call   c20 <printf>
+    close(fileDescriptor);
+ 1fc:	89 3c 24             	mov    %edi,(%esp)
+ 1ff:	e8 a7 08 00 00       	call   aab <close>
+} // end symLinkTest1()
+ 204:	83 c4 10             	add    $0x10,%esp
+ 207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 20a:	5b                   	pop    %ebx
+ 20b:	5e                   	pop    %esi
+ 20c:	5f                   	pop    %edi
+ 20d:	5d                   	pop    %ebp
+ 20e:	c3                   	ret
+ 20f:	90                   	nop
+        printf(1, "Symlink Test 1 Error: Failed to create symlink.");
+ 210:	83 ec 08             	sub    $0x8,%esp
+ 213:	68 68 10 00 00       	push   $0x1068
+ 218:	6a 01                	push   $0x1
+ 21a:	e8 01 0a 00 00       	call   c20 <printf>
+ 21f:	83 c4 10             	add    $0x10,%esp
+ 222:	e9 74 ff ff ff       	jmp    19b <symLinkTest1+0x3b>
+            printf(1, "Symlink Test 1 Error: Cannot write out file.\n");
+ 227:	83 ec 08             	sub    $0x8,%esp
+ 22a:	68 c0 10 00 00       	push   $0x10c0
+ 22f:	6a 01                	push   $0x1
+ 231:	e8 ea 09 00 00       	call   c20 <printf>
+            exit();
+ 236:	e8 48 08 00 00       	call   a83 <exit>
+        printf(1, "Symlink Test 1 Error: Something went wrong :(.\n");
+ 23b:	50                   	push   %eax
+ 23c:	50                   	push   %eax
+ 23d:	68 f0 10 00 00       	push   $0x10f0
+ 242:	6a 01                	push   $0x1
+ 244:	e8 d7 09 00 00       	call   c20 <printf>
+        exit();
+ 249:	e8 35 08 00 00       	call   a83 <exit>
+        printf(2, "Symlink Test 1 Error: cannot open %s\n", path);
+ 24e:	52                   	push   %edx
+ 24f:	53                   	push   %ebx
+ 250:	68 98 10 00 00       	push   $0x1098
+ 255:	6a 02                	push   $0x2
+ 257:	e8 c4 09 00 00       	call   c20 <printf>
+        exit();
+ 25c:	e8 22 08 00 00       	call   a83 <exit>
+ 261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <symLinkTest2>:
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+ 275:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 278:	8b 75 0c             	mov    0xc(%ebp),%esi
+    printf(1, "\n\nSymlink Test 2: Prove that we can create a symlink to a non-existant file. Prove that if we try to open and read our symlink, it will fail as the target does not exist. \n");
+ 27b:	83 ec 08             	sub    $0x8,%esp
+ 27e:	68 20 11 00 00       	push   $0x1120
+ 283:	6a 01                	push   $0x1
+ 285:	e8 96 09 00 00       	call   c20 <printf>
+    int symlinkTest = symlink(target, path);
+ 28a:	5a                   	pop    %edx
+ 28b:	59                   	pop    %ecx
+ 28c:	56                   	push   %esi
+ 28d:	53                   	push   %ebx
+ 28e:	e8 b8 08 00 00       	call   b4b <symlink>
+    if (symlinkTest < 0)
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	78 47                	js     2e1 <symLinkTest2+0x71>
+    if ((fileDescriptor = open(path, O_RDONLY)) < 0)
+ 29a:	83 ec 08             	sub    $0x8,%esp
+ 29d:	6a 00                	push   $0x0
+ 29f:	56                   	push   %esi
+ 2a0:	e8 1e 08 00 00       	call   ac3 <open>
+ 2a5:	83 c4 10             	add    $0x10,%esp
+ 2a8:	89 c3                	mov    %eax,%ebx
+ 2aa:	85 c0                	test   %eax,%eax
+ 2ac:	78 12                	js     2c0 <symLinkTest2+0x50>
+    close(fileDescriptor);
+ 2ae:	89 5d 08             	mov    %ebx,0x8(%ebp)
+} // end symLinkTest2()
+ 2b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2b4:	5b                   	pop    %ebx
+ 2b5:	5e                   	pop    %esi
+ 2b6:	5d                   	pop    %ebp
+    close(fileDescriptor);
+ 2b7:	e9 ef 07 00 00       	jmp    aab <close>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(2, "\nSymlink Test 2 Error: cannot open file: %s.\n\n Test 2 has passed! :)\n\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	56                   	push   %esi
+ 2c4:	68 04 12 00 00       	push   $0x1204
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 50 09 00 00       	call   c20 <printf>
+    close(fileDescriptor);
+ 2d0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+        printf(2, "\nSymlink Test 2 Error: cannot open file: %s.\n\n Test 2 has passed! :)\n\n", path);
+ 2d3:	83 c4 10             	add    $0x10,%esp
+} // end symLinkTest2()
+ 2d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+    close(fileDescriptor);
+ 2dc:	e9 ca 07 00 00       	jmp    aab <close>
+        printf(1, "\nSymlink Test 2 Error: Failed to create symlink.");
+ 2e1:	50                   	push   %eax
+ 2e2:	50                   	push   %eax
+ 2e3:	68 d0 11 00 00       	push   $0x11d0
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 31 09 00 00       	call   c20 <printf>
+        exit();
+ 2ef:	e8 8f 07 00 00       	call   a83 <exit>
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <symLinkTest3>:
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	53                   	push   %ebx
+ 306:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ 30c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    printf(1, "\nSymlink Test 3: Open a symlink using the O_NOFOLLOW flag. We will open a symlink called symB that targets the README file. Opening symB with the O_NOFOLLOW flag should print out the symB's contents.. which is README\n\n");
+ 30f:	68 4c 12 00 00       	push   $0x124c
+ 314:	6a 01                	push   $0x1
+ 316:	e8 05 09 00 00       	call   c20 <printf>
+    int symlinkTest = symlink(target, path);
+ 31b:	5e                   	pop    %esi
+ 31c:	5f                   	pop    %edi
+ 31d:	53                   	push   %ebx
+ 31e:	ff 75 08             	push   0x8(%ebp)
+ 321:	e8 25 08 00 00       	call   b4b <symlink>
+    if (symlinkTest < 0)
+ 326:	83 c4 10             	add    $0x10,%esp
+ 329:	85 c0                	test   %eax,%eax
+ 32b:	0f 88 a5 00 00 00    	js     3d6 <symLinkTest3+0xd6>
+    if ((fileDescriptor = open(path, O_NOFOLLOW)) < 0)
+ 331:	83 ec 08             	sub    $0x8,%esp
+ 334:	6a 03                	push   $0x3
+ 336:	53                   	push   %ebx
+ 337:	e8 87 07 00 00       	call   ac3 <open>
+ 33c:	83 c4 10             	add    $0x10,%esp
+ 33f:	89 c7                	mov    %eax,%edi
+ 341:	85 c0                	test   %eax,%eax
+ 343:	78 7e                	js     3c3 <symLinkTest3+0xc3>
+    printf(1, "Symlink Test 3: Successfully opened symlink using O_NOFOLLOW. Printing out symlink file...\n\n");
+ 345:	83 ec 08             	sub    $0x8,%esp
+ 348:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+ 34e:	68 8c 13 00 00       	push   $0x138c
+ 353:	6a 01                	push   $0x1
+ 355:	e8 c6 08 00 00       	call   c20 <printf>
+    while ((n = read(fileDescriptor, buf, sizeof(buf))) > 0)
+ 35a:	83 c4 10             	add    $0x10,%esp
+ 35d:	eb 14                	jmp    373 <symLinkTest3+0x73>
+ 35f:	90                   	nop
+        if (write(1, buf, n) != n)
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	53                   	push   %ebx
+ 364:	56                   	push   %esi
+ 365:	6a 01                	push   $0x1
+ 367:	e8 37 07 00 00       	call   aa3 <write>
+ 36c:	83 c4 10             	add    $0x10,%esp
+ 36f:	39 d8                	cmp    %ebx,%eax
+ 371:	75 3c                	jne    3af <symLinkTest3+0xaf>
+    while ((n = read(fileDescriptor, buf, sizeof(buf))) > 0)
+ 373:	83 ec 04             	sub    $0x4,%esp
+ 376:	68 00 02 00 00       	push   $0x200
+ 37b:	56                   	push   %esi
+ 37c:	57                   	push   %edi
+ 37d:	e8 19 07 00 00       	call   a9b <read>
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	89 c3                	mov    %eax,%ebx
+ 387:	85 c0                	test   %eax,%eax
+ 389:	7f d5                	jg     360 <symLinkTest3+0x60>
+    if (n < 0)
+ 38b:	75 5c                	jne    3e9 <symLinkTest3+0xe9>
+    printf(1, "\nSymlink Test 3 passed! :)\n");
+ 38d:	83 ec 08             	sub    $0x8,%esp
+ 390:	68 d4 1b 00 00       	push   $0x1bd4
+ 395:	6a 01                	push   $0x1
+ 397:	e8 84 08 00 00       	call   c20 <printf>
+    close(fileDescriptor);
+ 39c:	89 3c 24             	mov    %edi,(%esp)
+ 39f:	e8 07 07 00 00       	call   aab <close>
+} // end symLinkTest3()
+ 3a4:	83 c4 10             	add    $0x10,%esp
+ 3a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3aa:	5b                   	pop    %ebx
+ 3ab:	5e                   	pop    %esi
+ 3ac:	5f                   	pop    %edi
+ 3ad:	5d                   	pop    %ebp
+ 3ae:	c3                   	ret
+            printf(1, "Symlink Test 3 Error: Cannot write out file.\n");
+ 3af:	83 ec 08             	sub    $0x8,%esp
+ 3b2:	68 ec 13 00 00       	push   $0x13ec
+ 3b7:	6a 01                	push   $0x1
+ 3b9:	e8 62 08 00 00       	call   c20 <printf>
+            exit();
+ 3be:	e8 c0 06 00 00       	call   a83 <exit>
+        printf(2, "Symlink Test 3 Error: cannot open %s\n", path);
+ 3c3:	52                   	push   %edx
+ 3c4:	53                   	push   %ebx
+ 3c5:	68 64 13 00 00       	push   $0x1364
+ 3ca:	6a 02                	push   $0x2
+ 3cc:	e8 4f 08 00 00       	call   c20 <printf>
+        exit();
+ 3d1:	e8 ad 06 00 00       	call   a83 <exit>
+        printf(1, "Symlink Test 3 Error: Failed to create symlink. Exiting...");
+ 3d6:	51                   	push   %ecx
+ 3d7:	51                   	push   %ecx
+ 3d8:	68 28 13 00 00       	push   $0x1328
+ 3dd:	6a 01                	push   $0x1
+ 3df:	e8 3c 08 00 00       	call   c20 <printf>
+        exit();
+ 3e4:	e8 9a 06 00 00       	call   a83 <exit>
+        printf(1, "Symlink Test 3 Error: Something went wrong :(.\n");
+ 3e9:	50                   	push   %eax
+ 3ea:	50                   	push   %eax
+ 3eb:	68 1c 14 00 00       	push   $0x141c
+ 3f0:	6a 01                	push   $0x1
+ 3f2:	e8 29 08 00 00       	call   c20 <printf>
+        exit();
+ 3f7:	e8 87 06 00 00       	call   a83 <exit>
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <symLinkTest4>:
+void symLinkTest4(char *target) {
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	53                   	push   %ebx
+ 406:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ 40c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    printf(1, "\nSymlink Test 4: Recursively follow symlinks to symlinks until non-symlink file is reached.\n");
+ 40f:	68 4c 14 00 00       	push   $0x144c
+ 414:	6a 01                	push   $0x1
+ 416:	e8 05 08 00 00       	call   c20 <printf>
+    printf(1, "\nSymlink Test 4: Make up to 10 symlinks to prove we can do it first and that they recursively follow each other if we open them.\n");
+ 41b:	59                   	pop    %ecx
+ 41c:	5e                   	pop    %esi
+ 41d:	68 ac 14 00 00       	push   $0x14ac
+ 422:	6a 01                	push   $0x1
+ 424:	e8 f7 07 00 00       	call   c20 <printf>
+    if (symlink(target, "sym1") < 0) {
+ 429:	5f                   	pop    %edi
+ 42a:	58                   	pop    %eax
+ 42b:	68 f0 1b 00 00       	push   $0x1bf0
+ 430:	53                   	push   %ebx
+ 431:	e8 15 07 00 00       	call   b4b <symlink>
+ 436:	83 c4 10             	add    $0x10,%esp
+ 439:	85 c0                	test   %eax,%eax
+ 43b:	0f 88 a2 01 00 00    	js     5e3 <symLinkTest4+0x1e3>
+    if (symlink("sym1", "sym2") < 0) {
+ 441:	83 ec 08             	sub    $0x8,%esp
+ 444:	68 f5 1b 00 00       	push   $0x1bf5
+ 449:	68 f0 1b 00 00       	push   $0x1bf0
+ 44e:	e8 f8 06 00 00       	call   b4b <symlink>
+ 453:	83 c4 10             	add    $0x10,%esp
+ 456:	85 c0                	test   %eax,%eax
+ 458:	0f 88 85 01 00 00    	js     5e3 <symLinkTest4+0x1e3>
+    if (symlink("sym2", "sym3") < 0) {
+ 45e:	83 ec 08             	sub    $0x8,%esp
+ 461:	68 fa 1b 00 00       	push   $0x1bfa
+ 466:	68 f5 1b 00 00       	push   $0x1bf5
+ 46b:	e8 db 06 00 00       	call   b4b <symlink>
+ 470:	83 c4 10             	add    $0x10,%esp
+ 473:	85 c0                	test   %eax,%eax
+ 475:	0f 88 68 01 00 00    	js     5e3 <symLinkTest4+0x1e3>
+    if (symlink("sym3", "sym4") < 0) {
+ 47b:	83 ec 08             	sub    $0x8,%esp
+ 47e:	68 ff 1b 00 00       	push   $0x1bff
+ 483:	68 fa 1b 00 00       	push   $0x1bfa
+ 488:	e8 be 06 00 00       	call   b4b <symlink>
+ 48d:	83 c4 10             	add    $0x10,%esp
+ 490:	85 c0                	test   %eax,%eax
+ 492:	0f 88 4b 01 00 00    	js     5e3 <symLinkTest4+0x1e3>
+    if (symlink("sym4", "sym5") < 0) {
+ 498:	83 ec 08             	sub    $0x8,%esp
+ 49b:	68 04 1c 00 00       	push   $0x1c04
+ 4a0:	68 ff 1b 00 00       	push   $0x1bff
+ 4a5:	e8 a1 06 00 00       	call   b4b <symlink>
+ 4aa:	83 c4 10             	add    $0x10,%esp
+ 4ad:	85 c0                	test   %eax,%eax
+ 4af:	0f 88 2e 01 00 00    	js     5e3 <symLinkTest4+0x1e3>
+    if (symlink("sym5", "sym6") < 0) {
+ 4b5:	83 ec 08             	sub    $0x8,%esp
+ 4b8:	68 09 1c 00 00       	push   $0x1c09
+ 4bd:	68 04 1c 00 00       	push   $0x1c04
+ 4c2:	e8 84 06 00 00       	call   b4b <symlink>
+ 4c7:	83 c4 10             	add    $0x10,%esp
+ 4ca:	85 c0                	test   %eax,%eax
+ 4cc:	0f 88 11 01 00 00    	js     5e3 <symLinkTest4+0x1e3>
+    if (symlink("sym6", "sym7") < 0) {
+ 4d2:	83 ec 08             	sub    $0x8,%esp
+ 4d5:	68 0e 1c 00 00       	push   $0x1c0e
+ 4da:	68 09 1c 00 00       	push   $0x1c09
+ 4df:	e8 67 06 00 00       	call   b4b <symlink>
+ 4e4:	83 c4 10             	add    $0x10,%esp
+ 4e7:	85 c0                	test   %eax,%eax
+ 4e9:	0f 88 f4 00 00 00    	js     5e3 <symLinkTest4+0x1e3>
+    if (symlink("sym7", "sym8") < 0) {
+ 4ef:	83 ec 08             	sub    $0x8,%esp
+ 4f2:	68 13 1c 00 00       	push   $0x1c13
+ 4f7:	68 0e 1c 00 00       	push   $0x1c0e
+ 4fc:	e8 4a 06 00 00       	call   b4b <symlink>
+ 501:	83 c4 10             	add    $0x10,%esp
+ 504:	85 c0                	test   %eax,%eax
+ 506:	0f 88 d7 00 00 00    	js     5e3 <symLinkTest4+0x1e3>
+     if (symlink("sym8", "sym9") < 0) {
+ 50c:	83 ec 08             	sub    $0x8,%esp
+ 50f:	68 18 1c 00 00       	push   $0x1c18
+ 514:	68 13 1c 00 00       	push   $0x1c13
+ 519:	e8 2d 06 00 00       	call   b4b <symlink>
+ 51e:	83 c4 10             	add    $0x10,%esp
+ 521:	85 c0                	test   %eax,%eax
+ 523:	0f 88 ba 00 00 00    	js     5e3 <symLinkTest4+0x1e3>
+     if (symlink("sym9", "sym10") < 0) {
+ 529:	83 ec 08             	sub    $0x8,%esp
+ 52c:	68 1d 1c 00 00       	push   $0x1c1d
+ 531:	68 18 1c 00 00       	push   $0x1c18
+ 536:	e8 10 06 00 00       	call   b4b <symlink>
+ 53b:	83 c4 10             	add    $0x10,%esp
+ 53e:	85 c0                	test   %eax,%eax
+ 540:	0f 88 9d 00 00 00    	js     5e3 <symLinkTest4+0x1e3>
+    if ((fileDescriptor = open("sym10", O_RDONLY)) < 0) {
+ 546:	83 ec 08             	sub    $0x8,%esp
+ 549:	6a 00                	push   $0x0
+ 54b:	68 1d 1c 00 00       	push   $0x1c1d
+ 550:	e8 6e 05 00 00       	call   ac3 <open>
+ 555:	83 c4 10             	add    $0x10,%esp
+ 558:	89 c7                	mov    %eax,%edi
+ 55a:	85 c0                	test   %eax,%eax
+ 55c:	0f 88 95 00 00 00    	js     5f7 <symLinkTest4+0x1f7>
+    printf(1, "Symlink Test 4: Successfully opened the target file. Printing out target file...\n\n");
+ 562:	83 ec 08             	sub    $0x8,%esp
+ 565:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+ 56b:	68 8c 15 00 00       	push   $0x158c
+ 570:	6a 01                	push   $0x1
+ 572:	e8 a9 06 00 00       	call   c20 <printf>
+    while ((n = read(fileDescriptor, buf, sizeof(buf))) > 0)
+ 577:	83 c4 10             	add    $0x10,%esp
+ 57a:	eb 17                	jmp    593 <symLinkTest4+0x193>
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        if (write(1, buf, n) != n)
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	53                   	push   %ebx
+ 584:	56                   	push   %esi
+ 585:	6a 01                	push   $0x1
+ 587:	e8 17 05 00 00       	call   aa3 <write>
+ 58c:	83 c4 10             	add    $0x10,%esp
+ 58f:	39 d8                	cmp    %ebx,%eax
+ 591:	75 3c                	jne    5cf <symLinkTest4+0x1cf>
+    while ((n = read(fileDescriptor, buf, sizeof(buf))) > 0)
+ 593:	83 ec 04             	sub    $0x4,%esp
+ 596:	68 00 02 00 00       	push   $0x200
+ 59b:	56                   	push   %esi
+ 59c:	57                   	push   %edi
+ 59d:	e8 f9 04 00 00       	call   a9b <read>
+ 5a2:	83 c4 10             	add    $0x10,%esp
+ 5a5:	89 c3                	mov    %eax,%ebx
+ 5a7:	85 c0                	test   %eax,%eax
+ 5a9:	7f d5                	jg     580 <symLinkTest4+0x180>
+    if (n < 0)
+ 5ab:	75 5d                	jne    60a <symLinkTest4+0x20a>
+    printf(1, "\n\nSymlink Test 4 passed! :)\n");
+ 5ad:	83 ec 08             	sub    $0x8,%esp
+ 5b0:	68 23 1c 00 00       	push   $0x1c23
+ 5b5:	6a 01                	push   $0x1
+ 5b7:	e8 64 06 00 00       	call   c20 <printf>
+    close(fileDescriptor);
+ 5bc:	89 3c 24             	mov    %edi,(%esp)
+ 5bf:	e8 e7 04 00 00       	call   aab <close>
+} // end symLinkTest4()
+ 5c4:	83 c4 10             	add    $0x10,%esp
+ 5c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ca:	5b                   	pop    %ebx
+ 5cb:	5e                   	pop    %esi
+ 5cc:	5f                   	pop    %edi
+ 5cd:	5d                   	pop    %ebp
+ 5ce:	c3                   	ret
+            printf(1, "Symlink Test 4 Error: Cannot write out file.\n");
+ 5cf:	83 ec 08             	sub    $0x8,%esp
+ 5d2:	68 e0 15 00 00       	push   $0x15e0
+ 5d7:	6a 01                	push   $0x1
+ 5d9:	e8 42 06 00 00       	call   c20 <printf>
+            exit();
+ 5de:	e8 a0 04 00 00       	call   a83 <exit>
+        printf(1, "Symlink Test 4 Error: Failed to create symlink 1.");
+ 5e3:	83 ec 08             	sub    $0x8,%esp
+ 5e6:	68 30 15 00 00       	push   $0x1530
+ 5eb:	6a 01                	push   $0x1
+ 5ed:	e8 2e 06 00 00       	call   c20 <printf>
+        exit();
+ 5f2:	e8 8c 04 00 00       	call   a83 <exit>
+        printf(2, "Symlink Test 4 Error: cannot open %s\n", target);
+ 5f7:	52                   	push   %edx
+ 5f8:	53                   	push   %ebx
+ 5f9:	68 64 15 00 00       	push   $0x1564
+ 5fe:	6a 02                	push   $0x2
+ 600:	e8 1b 06 00 00       	call   c20 <printf>
+        exit();
+ 605:	e8 79 04 00 00       	call   a83 <exit>
+        printf(1, "Symlink Test 4 Error: Something went wrong :(.\n");
+ 60a:	50                   	push   %eax
+ 60b:	50                   	push   %eax
+ 60c:	68 10 16 00 00       	push   $0x1610
+ 611:	6a 01                	push   $0x1
+ 613:	e8 08 06 00 00       	call   c20 <printf>
+        exit();
+ 618:	e8 66 04 00 00       	call   a83 <exit>
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000620 <symLinkTest5>:
+void symLinkTest5() {
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	53                   	push   %ebx
+ 624:	83 ec 0c             	sub    $0xc,%esp
+    printf(1, "\n\nSymlink Test 5: Demonstrate a depth of 10 symlinks to recursively follow to throw an error. This test is successful upon printing out that error.\n");
+ 627:	68 40 16 00 00       	push   $0x1640
+ 62c:	6a 01                	push   $0x1
+ 62e:	e8 ed 05 00 00       	call   c20 <printf>
+    if (symlink("sym10", "sym11") < 0) {
+ 633:	5a                   	pop    %edx
+ 634:	59                   	pop    %ecx
+ 635:	68 40 1c 00 00       	push   $0x1c40
+ 63a:	68 1d 1c 00 00       	push   $0x1c1d
+ 63f:	e8 07 05 00 00       	call   b4b <symlink>
+ 644:	83 c4 10             	add    $0x10,%esp
+ 647:	85 c0                	test   %eax,%eax
+ 649:	78 44                	js     68f <symLinkTest5+0x6f>
+    if ((fileDescriptor = open("sym11", O_RDONLY)) < 0) {
+ 64b:	83 ec 08             	sub    $0x8,%esp
+ 64e:	6a 00                	push   $0x0
+ 650:	68 40 1c 00 00       	push   $0x1c40
+ 655:	e8 69 04 00 00       	call   ac3 <open>
+ 65a:	83 c4 10             	add    $0x10,%esp
+ 65d:	89 c3                	mov    %eax,%ebx
+ 65f:	85 c0                	test   %eax,%eax
+ 661:	78 0d                	js     670 <symLinkTest5+0x50>
+} // end symLinkTest5()
+ 663:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 666:	c9                   	leave
+ 667:	c3                   	ret
+ 668:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        printf(2, "Symlink Test 5 Error: cannot open file.\n\nTest 5 has passed :), this file should not be able to open since we have reached our symlink depth limit.\n");
+ 670:	83 ec 08             	sub    $0x8,%esp
+ 673:	68 08 17 00 00       	push   $0x1708
+ 678:	6a 02                	push   $0x2
+ 67a:	e8 a1 05 00 00       	call   c20 <printf>
+        close(fileDescriptor);
+ 67f:	89 1c 24             	mov    %ebx,(%esp)
+ 682:	e8 24 04 00 00       	call   aab <close>
+} // end symLinkTest5()
+ 687:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+        close(fileDescriptor);
+ 68a:	83 c4 10             	add    $0x10,%esp
+} // end symLinkTest5()
+ 68d:	c9                   	leave
+ 68e:	c3                   	ret
+        printf(1, "Symlink Test 5 Error: Failed to create symlink.");
+ 68f:	50                   	push   %eax
+ 690:	50                   	push   %eax
+ 691:	68 d8 16 00 00       	push   $0x16d8
+ 696:	6a 01                	push   $0x1
+ 698:	e8 83 05 00 00       	call   c20 <printf>
+        exit();
+ 69d:	e8 e1 03 00 00       	call   a83 <exit>
+ 6a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <symLinkTest6>:
+void symLinkTest6() {
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    printf(1, "\n\nSymlink Test 6: Prove that system calls like link and unlink operate on the symbolic link itself.\n");
+ 6bc:	68 9c 17 00 00       	push   $0x179c
+ 6c1:	6a 01                	push   $0x1
+ 6c3:	e8 58 05 00 00       	call   c20 <printf>
+    printf(1, "Symlink Test 6: Creating a link called hardlink to symlink symA\n");
+ 6c8:	59                   	pop    %ecx
+ 6c9:	5b                   	pop    %ebx
+ 6ca:	68 04 18 00 00       	push   $0x1804
+ 6cf:	6a 01                	push   $0x1
+ 6d1:	e8 4a 05 00 00       	call   c20 <printf>
+    if(link("symA", "hardlink") < 0) {
+ 6d6:	5e                   	pop    %esi
+ 6d7:	5f                   	pop    %edi
+ 6d8:	68 46 1c 00 00       	push   $0x1c46
+ 6dd:	68 4f 1c 00 00       	push   $0x1c4f
+ 6e2:	e8 fc 03 00 00       	call   ae3 <link>
+ 6e7:	83 c4 10             	add    $0x10,%esp
+ 6ea:	85 c0                	test   %eax,%eax
+ 6ec:	0f 88 e6 00 00 00    	js     7d8 <symLinkTest6+0x128>
+    printf(1, "Successfully created the hard link to our symlink...\n");
+ 6f2:	83 ec 08             	sub    $0x8,%esp
+ 6f5:	68 48 18 00 00       	push   $0x1848
+ 6fa:	6a 01                	push   $0x1
+ 6fc:	e8 1f 05 00 00       	call   c20 <printf>
+    if ((fileDescriptor = open("hardlink", O_NOFOLLOW)) < 0) {
+ 701:	58                   	pop    %eax
+ 702:	5a                   	pop    %edx
+ 703:	6a 03                	push   $0x3
+ 705:	68 46 1c 00 00       	push   $0x1c46
+ 70a:	e8 b4 03 00 00       	call   ac3 <open>
+ 70f:	83 c4 10             	add    $0x10,%esp
+ 712:	89 c7                	mov    %eax,%edi
+ 714:	85 c0                	test   %eax,%eax
+ 716:	0f 88 0f 01 00 00    	js     82b <symLinkTest6+0x17b>
+    printf(1, "Successfully opened the hard link... now reading the hard link ... if successful this should print out the symbolic links target file path: README\n");
+ 71c:	83 ec 08             	sub    $0x8,%esp
+ 71f:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+ 725:	68 ac 18 00 00       	push   $0x18ac
+ 72a:	6a 01                	push   $0x1
+ 72c:	e8 ef 04 00 00       	call   c20 <printf>
+    while ((n = read(fileDescriptor, buf, sizeof(buf))) > 0)
+ 731:	83 c4 10             	add    $0x10,%esp
+ 734:	eb 21                	jmp    757 <symLinkTest6+0xa7>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        if (write(1, buf, n) != n)
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	53                   	push   %ebx
+ 744:	56                   	push   %esi
+ 745:	6a 01                	push   $0x1
+ 747:	e8 57 03 00 00       	call   aa3 <write>
+ 74c:	83 c4 10             	add    $0x10,%esp
+ 74f:	39 d8                	cmp    %ebx,%eax
+ 751:	0f 85 ad 00 00 00    	jne    804 <symLinkTest6+0x154>
+    while ((n = read(fileDescriptor, buf, sizeof(buf))) > 0)
+ 757:	83 ec 04             	sub    $0x4,%esp
+ 75a:	68 00 02 00 00       	push   $0x200
+ 75f:	56                   	push   %esi
+ 760:	57                   	push   %edi
+ 761:	e8 35 03 00 00       	call   a9b <read>
+ 766:	83 c4 10             	add    $0x10,%esp
+ 769:	89 c3                	mov    %eax,%ebx
+ 76b:	85 c0                	test   %eax,%eax
+ 76d:	7f d1                	jg     740 <symLinkTest6+0x90>
+    if (n < 0)
+ 76f:	0f 85 a3 00 00 00    	jne    818 <symLinkTest6+0x168>
+    printf(1, "\nSymlink Test 6 Part 1 has passed! We were able to successfully link to a symlink and open that hard link.\n");
+ 775:	83 ec 08             	sub    $0x8,%esp
+ 778:	68 a0 19 00 00       	push   $0x19a0
+ 77d:	6a 01                	push   $0x1
+ 77f:	e8 9c 04 00 00       	call   c20 <printf>
+    printf(1, "\nTest 6 Part 2: Now we will unlink our new hard link and attempt to open and read again. This part of the test should fail.\n");
+ 784:	58                   	pop    %eax
+ 785:	5a                   	pop    %edx
+ 786:	68 0c 1a 00 00       	push   $0x1a0c
+ 78b:	6a 01                	push   $0x1
+ 78d:	e8 8e 04 00 00       	call   c20 <printf>
+    unlink("hardlink");
+ 792:	c7 04 24 46 1c 00 00 	movl   $0x1c46,(%esp)
+ 799:	e8 35 03 00 00       	call   ad3 <unlink>
+    if ((fileDescriptor2 = open("testLink", O_NOFOLLOW)) < 0) {
+ 79e:	59                   	pop    %ecx
+ 79f:	5b                   	pop    %ebx
+ 7a0:	6a 03                	push   $0x3
+ 7a2:	68 71 1c 00 00       	push   $0x1c71
+ 7a7:	e8 17 03 00 00       	call   ac3 <open>
+ 7ac:	83 c4 10             	add    $0x10,%esp
+ 7af:	89 c3                	mov    %eax,%ebx
+ 7b1:	85 c0                	test   %eax,%eax
+ 7b3:	78 3b                	js     7f0 <symLinkTest6+0x140>
+    close(fileDescriptor);
+ 7b5:	83 ec 0c             	sub    $0xc,%esp
+ 7b8:	57                   	push   %edi
+ 7b9:	e8 ed 02 00 00       	call   aab <close>
+    close(fileDescriptor2);
+ 7be:	89 1c 24             	mov    %ebx,(%esp)
+ 7c1:	e8 e5 02 00 00       	call   aab <close>
+}// end symLinkTest6()
+ 7c6:	83 c4 10             	add    $0x10,%esp
+ 7c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7cc:	5b                   	pop    %ebx
+ 7cd:	5e                   	pop    %esi
+ 7ce:	5f                   	pop    %edi
+ 7cf:	5d                   	pop    %ebp
+ 7d0:	c3                   	ret
+ 7d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printf(2, "Symlink Test 6: Link failed\n");
+ 7d8:	83 ec 08             	sub    $0x8,%esp
+ 7db:	68 54 1c 00 00       	push   $0x1c54
+ 7e0:	6a 02                	push   $0x2
+ 7e2:	e8 39 04 00 00       	call   c20 <printf>
+ 7e7:	83 c4 10             	add    $0x10,%esp
+ 7ea:	e9 03 ff ff ff       	jmp    6f2 <symLinkTest6+0x42>
+ 7ef:	90                   	nop
+        printf(2, "Symlink Test 6 Error: cannot open file.\n\nTest 6 Part 2 has passed :). This is a success as we have unlinked this hard link and should not be able to open it. Test 6 Part 2 Passed.\n");
+ 7f0:	83 ec 08             	sub    $0x8,%esp
+ 7f3:	68 8c 1a 00 00       	push   $0x1a8c
+ 7f8:	6a 02                	push   $0x2
+ 7fa:	e8 21 04 00 00       	call   c20 <printf>
+ 7ff:	83 c4 10             	add    $0x10,%esp
+ 802:	eb b1                	jmp    7b5 <symLinkTest6+0x105>
+            printf(1, "Symlink Test 6 Error: Cannot write out file.\n");
+ 804:	83 ec 08             	sub    $0x8,%esp
+ 807:	68 40 19 00 00       	push   $0x1940
+ 80c:	6a 01                	push   $0x1
+ 80e:	e8 0d 04 00 00       	call   c20 <printf>
+            exit();
+ 813:	e8 6b 02 00 00       	call   a83 <exit>
+        printf(1, "Symlink Test 6 Error: Something went wrong :(.\n");
+ 818:	56                   	push   %esi
+ 819:	56                   	push   %esi
+ 81a:	68 70 19 00 00       	push   $0x1970
+ 81f:	6a 01                	push   $0x1
+ 821:	e8 fa 03 00 00       	call   c20 <printf>
+        exit();
+ 826:	e8 58 02 00 00       	call   a83 <exit>
+        printf(2, "Symlink Test 6 Error: cannot open file.\n");
+ 82b:	57                   	push   %edi
+ 82c:	57                   	push   %edi
+ 82d:	68 80 18 00 00       	push   $0x1880
+ 832:	6a 02                	push   $0x2
+ 834:	e8 e7 03 00 00       	call   c20 <printf>
+        exit();
+ 839:	e8 45 02 00 00       	call   a83 <exit>
+ 83e:	66 90                	xchg   %ax,%ax
+
+00000840 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 840:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 841:	31 c0                	xor    %eax,%eax
+{
+ 843:	89 e5                	mov    %esp,%ebp
+ 845:	53                   	push   %ebx
+ 846:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 849:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 850:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 854:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 857:	83 c0 01             	add    $0x1,%eax
+ 85a:	84 d2                	test   %dl,%dl
+ 85c:	75 f2                	jne    850 <strcpy+0x10>
+    ;
+  return os;
+}
+ 85e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 861:	89 c8                	mov    %ecx,%eax
+ 863:	c9                   	leave
+ 864:	c3                   	ret
+ 865:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	53                   	push   %ebx
+ 874:	8b 55 08             	mov    0x8(%ebp),%edx
+ 877:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 87a:	0f b6 02             	movzbl (%edx),%eax
+ 87d:	84 c0                	test   %al,%al
+ 87f:	75 17                	jne    898 <strcmp+0x28>
+ 881:	eb 3a                	jmp    8bd <strcmp+0x4d>
+ 883:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 887:	90                   	nop
+ 888:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 88c:	83 c2 01             	add    $0x1,%edx
+ 88f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 892:	84 c0                	test   %al,%al
+ 894:	74 1a                	je     8b0 <strcmp+0x40>
+    p++, q++;
+ 896:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 898:	0f b6 19             	movzbl (%ecx),%ebx
+ 89b:	38 c3                	cmp    %al,%bl
+ 89d:	74 e9                	je     888 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 89f:	29 d8                	sub    %ebx,%eax
+}
+ 8a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8a4:	c9                   	leave
+ 8a5:	c3                   	ret
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 8b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 8b4:	31 c0                	xor    %eax,%eax
+ 8b6:	29 d8                	sub    %ebx,%eax
+}
+ 8b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8bb:	c9                   	leave
+ 8bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 8bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 8c0:	31 c0                	xor    %eax,%eax
+ 8c2:	eb db                	jmp    89f <strcmp+0x2f>
+ 8c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+
+000008d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 8d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 8d9:	74 15                	je     8f0 <strlen+0x20>
+ 8db:	31 c0                	xor    %eax,%eax
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 8e0:	83 c0 01             	add    $0x1,%eax
+ 8e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 8e7:	89 c1                	mov    %eax,%ecx
+ 8e9:	75 f5                	jne    8e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 8eb:	89 c8                	mov    %ecx,%eax
+ 8ed:	5d                   	pop    %ebp
+ 8ee:	c3                   	ret
+ 8ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 8f0:	31 c9                	xor    %ecx,%ecx
+}
+ 8f2:	5d                   	pop    %ebp
+ 8f3:	89 c8                	mov    %ecx,%eax
+ 8f5:	c3                   	ret
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000900 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 907:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 90a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 90d:	89 d7                	mov    %edx,%edi
+ 90f:	fc                   	cld
+ 910:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 912:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 915:	89 d0                	mov    %edx,%eax
+ 917:	c9                   	leave
+ 918:	c3                   	ret
+ 919:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	8b 45 08             	mov    0x8(%ebp),%eax
+ 926:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 92a:	0f b6 10             	movzbl (%eax),%edx
+ 92d:	84 d2                	test   %dl,%dl
+ 92f:	75 12                	jne    943 <strchr+0x23>
+ 931:	eb 1d                	jmp    950 <strchr+0x30>
+ 933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 937:	90                   	nop
+ 938:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 93c:	83 c0 01             	add    $0x1,%eax
+ 93f:	84 d2                	test   %dl,%dl
+ 941:	74 0d                	je     950 <strchr+0x30>
+    if(*s == c)
+ 943:	38 d1                	cmp    %dl,%cl
+ 945:	75 f1                	jne    938 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 947:	5d                   	pop    %ebp
+ 948:	c3                   	ret
+ 949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 950:	31 c0                	xor    %eax,%eax
+}
+ 952:	5d                   	pop    %ebp
+ 953:	c3                   	ret
+ 954:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+
+00000960 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 965:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 968:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 969:	31 db                	xor    %ebx,%ebx
+{
+ 96b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 96e:	eb 27                	jmp    997 <gets+0x37>
+    cc = read(0, &c, 1);
+ 970:	83 ec 04             	sub    $0x4,%esp
+ 973:	6a 01                	push   $0x1
+ 975:	56                   	push   %esi
+ 976:	6a 00                	push   $0x0
+ 978:	e8 1e 01 00 00       	call   a9b <read>
+    if(cc < 1)
+ 97d:	83 c4 10             	add    $0x10,%esp
+ 980:	85 c0                	test   %eax,%eax
+ 982:	7e 1d                	jle    9a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 984:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 988:	8b 55 08             	mov    0x8(%ebp),%edx
+ 98b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 98f:	3c 0a                	cmp    $0xa,%al
+ 991:	74 10                	je     9a3 <gets+0x43>
+ 993:	3c 0d                	cmp    $0xd,%al
+ 995:	74 0c                	je     9a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 997:	89 df                	mov    %ebx,%edi
+ 999:	83 c3 01             	add    $0x1,%ebx
+ 99c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 99f:	7c cf                	jl     970 <gets+0x10>
+ 9a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 9a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 9aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9ad:	5b                   	pop    %ebx
+ 9ae:	5e                   	pop    %esi
+ 9af:	5f                   	pop    %edi
+ 9b0:	5d                   	pop    %ebp
+ 9b1:	c3                   	ret
+ 9b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009c0 <stat>:
+
+int stat(const char *n, struct stat *st)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	56                   	push   %esi
+ 9c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 9c5:	83 ec 08             	sub    $0x8,%esp
+ 9c8:	6a 00                	push   $0x0
+ 9ca:	ff 75 08             	push   0x8(%ebp)
+ 9cd:	e8 f1 00 00 00       	call   ac3 <open>
+  if(fd < 0)
+ 9d2:	83 c4 10             	add    $0x10,%esp
+ 9d5:	85 c0                	test   %eax,%eax
+ 9d7:	78 27                	js     a00 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 9d9:	83 ec 08             	sub    $0x8,%esp
+ 9dc:	ff 75 0c             	push   0xc(%ebp)
+ 9df:	89 c3                	mov    %eax,%ebx
+ 9e1:	50                   	push   %eax
+ 9e2:	e8 f4 00 00 00       	call   adb <fstat>
+  close(fd);
+ 9e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 9ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 9ec:	e8 ba 00 00 00       	call   aab <close>
+  return r;
+ 9f1:	83 c4 10             	add    $0x10,%esp
+}
+ 9f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9f7:	89 f0                	mov    %esi,%eax
+ 9f9:	5b                   	pop    %ebx
+ 9fa:	5e                   	pop    %esi
+ 9fb:	5d                   	pop    %ebp
+ 9fc:	c3                   	ret
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ a00:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ a05:	eb ed                	jmp    9f4 <stat+0x34>
+ a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0e:	66 90                	xchg   %ax,%ax
+
+00000a10 <atoi>:
+
+int
+atoi(const char *s)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	53                   	push   %ebx
+ a14:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ a17:	0f be 02             	movsbl (%edx),%eax
+ a1a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ a1d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ a20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ a25:	77 1e                	ja     a45 <atoi+0x35>
+ a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ a30:	83 c2 01             	add    $0x1,%edx
+ a33:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ a36:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ a3a:	0f be 02             	movsbl (%edx),%eax
+ a3d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ a40:	80 fb 09             	cmp    $0x9,%bl
+ a43:	76 eb                	jbe    a30 <atoi+0x20>
+  return n;
+}
+ a45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a48:	89 c8                	mov    %ecx,%eax
+ a4a:	c9                   	leave
+ a4b:	c3                   	ret
+ a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a50 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	8b 45 10             	mov    0x10(%ebp),%eax
+ a58:	8b 55 08             	mov    0x8(%ebp),%edx
+ a5b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ a5e:	85 c0                	test   %eax,%eax
+ a60:	7e 13                	jle    a75 <memmove+0x25>
+ a62:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ a64:	89 d7                	mov    %edx,%edi
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ a70:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ a71:	39 f8                	cmp    %edi,%eax
+ a73:	75 fb                	jne    a70 <memmove+0x20>
+  return vdst;
+}
+ a75:	5e                   	pop    %esi
+ a76:	89 d0                	mov    %edx,%eax
+ a78:	5f                   	pop    %edi
+ a79:	5d                   	pop    %ebp
+ a7a:	c3                   	ret
+
+00000a7b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ a7b:	b8 01 00 00 00       	mov    $0x1,%eax
+ a80:	cd 40                	int    $0x40
+ a82:	c3                   	ret
+
+00000a83 <exit>:
+SYSCALL(exit)
+ a83:	b8 02 00 00 00       	mov    $0x2,%eax
+ a88:	cd 40                	int    $0x40
+ a8a:	c3                   	ret
+
+00000a8b <wait>:
+SYSCALL(wait)
+ a8b:	b8 03 00 00 00       	mov    $0x3,%eax
+ a90:	cd 40                	int    $0x40
+ a92:	c3                   	ret
+
+00000a93 <pipe>:
+SYSCALL(pipe)
+ a93:	b8 04 00 00 00       	mov    $0x4,%eax
+ a98:	cd 40                	int    $0x40
+ a9a:	c3                   	ret
+
+00000a9b <read>:
+SYSCALL(read)
+ a9b:	b8 05 00 00 00       	mov    $0x5,%eax
+ aa0:	cd 40                	int    $0x40
+ aa2:	c3                   	ret
+
+00000aa3 <write>:
+SYSCALL(write)
+ aa3:	b8 10 00 00 00       	mov    $0x10,%eax
+ aa8:	cd 40                	int    $0x40
+ aaa:	c3                   	ret
+
+00000aab <close>:
+SYSCALL(close)
+ aab:	b8 15 00 00 00       	mov    $0x15,%eax
+ ab0:	cd 40                	int    $0x40
+ ab2:	c3                   	ret
+
+00000ab3 <kill>:
+SYSCALL(kill)
+ ab3:	b8 06 00 00 00       	mov    $0x6,%eax
+ ab8:	cd 40                	int    $0x40
+ aba:	c3                   	ret
+
+00000abb <exec>:
+SYSCALL(exec)
+ abb:	b8 07 00 00 00       	mov    $0x7,%eax
+ ac0:	cd 40                	int    $0x40
+ ac2:	c3                   	ret
+
+00000ac3 <open>:
+SYSCALL(open)
+ ac3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ ac8:	cd 40                	int    $0x40
+ aca:	c3                   	ret
+
+00000acb <mknod>:
+SYSCALL(mknod)
+ acb:	b8 11 00 00 00       	mov    $0x11,%eax
+ ad0:	cd 40                	int    $0x40
+ ad2:	c3                   	ret
+
+00000ad3 <unlink>:
+SYSCALL(unlink)
+ ad3:	b8 12 00 00 00       	mov    $0x12,%eax
+ ad8:	cd 40                	int    $0x40
+ ada:	c3                   	ret
+
+00000adb <fstat>:
+SYSCALL(fstat)
+ adb:	b8 08 00 00 00       	mov    $0x8,%eax
+ ae0:	cd 40                	int    $0x40
+ ae2:	c3                   	ret
+
+00000ae3 <link>:
+SYSCALL(link)
+ ae3:	b8 13 00 00 00       	mov    $0x13,%eax
+ ae8:	cd 40                	int    $0x40
+ aea:	c3                   	ret
+
+00000aeb <mkdir>:
+SYSCALL(mkdir)
+ aeb:	b8 14 00 00 00       	mov    $0x14,%eax
+ af0:	cd 40                	int    $0x40
+ af2:	c3                   	ret
+
+00000af3 <chdir>:
+SYSCALL(chdir)
+ af3:	b8 09 00 00 00       	mov    $0x9,%eax
+ af8:	cd 40                	int    $0x40
+ afa:	c3                   	ret
+
+00000afb <dup>:
+SYSCALL(dup)
+ afb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ b00:	cd 40                	int    $0x40
+ b02:	c3                   	ret
+
+00000b03 <getpid>:
+SYSCALL(getpid)
+ b03:	b8 0b 00 00 00       	mov    $0xb,%eax
+ b08:	cd 40                	int    $0x40
+ b0a:	c3                   	ret
+
+00000b0b <sbrk>:
+SYSCALL(sbrk)
+ b0b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ b10:	cd 40                	int    $0x40
+ b12:	c3                   	ret
+
+00000b13 <sleep>:
+SYSCALL(sleep)
+ b13:	b8 0d 00 00 00       	mov    $0xd,%eax
+ b18:	cd 40                	int    $0x40
+ b1a:	c3                   	ret
+
+00000b1b <uptime>:
+SYSCALL(uptime)
+ b1b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ b20:	cd 40                	int    $0x40
+ b22:	c3                   	ret
+
+00000b23 <time_scheduled>:
+SYSCALL(time_scheduled)
+ b23:	b8 16 00 00 00       	mov    $0x16,%eax
+ b28:	cd 40                	int    $0x40
+ b2a:	c3                   	ret
+
+00000b2b <set_sched_priority>:
+SYSCALL(set_sched_priority)
+ b2b:	b8 17 00 00 00       	mov    $0x17,%eax
+ b30:	cd 40                	int    $0x40
+ b32:	c3                   	ret
+
+00000b33 <get_sched_priority>:
+SYSCALL(get_sched_priority)
+ b33:	b8 18 00 00 00       	mov    $0x18,%eax
+ b38:	cd 40                	int    $0x40
+ b3a:	c3                   	ret
+
+00000b3b <fifo_position>:
+SYSCALL(fifo_position)
+ b3b:	b8 19 00 00 00       	mov    $0x19,%eax
+ b40:	cd 40                	int    $0x40
+ b42:	c3                   	ret
+
+00000b43 <printProcessTable>:
+SYSCALL(printProcessTable)
+ b43:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ b48:	cd 40                	int    $0x40
+ b4a:	c3                   	ret
+
+00000b4b <symlink>:
+SYSCALL(symlink)
+ b4b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ b50:	cd 40                	int    $0x40
+ b52:	c3                   	ret
+
+00000b53 <lseek>:
+SYSCALL(lseek)
+ b53:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ b58:	cd 40                	int    $0x40
+ b5a:	c3                   	ret
+
+00000b5b <fallocate>:
+SYSCALL(fallocate)
+ b5b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ b60:	cd 40                	int    $0x40
+ b62:	c3                   	ret
+
+00000b63 <iostats>:
+SYSCALL(iostats)
+ b63:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ b68:	cd 40                	int    $0x40
+ b6a:	c3                   	ret
+
+00000b6b <fsync>:
+SYSCALL(fsync)
+ b6b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ b70:	cd 40                	int    $0x40
+ b72:	c3                   	ret
+ b73:	66 90                	xchg   %ax,%ax
+ b75:	66 90                	xchg   %ax,%ax
+ b77:	66 90                	xchg   %ax,%ax
+ b79:	66 90                	xchg   %ax,%ax
+ b7b:	66 90                	xchg   %ax,%ax
+ b7d:	66 90                	xchg   %ax,%ax
+ b7f:	90                   	nop
+
+00000b80 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	57                   	push   %edi
+ b84:	56                   	push   %esi
+ b85:	53                   	push   %ebx
+ b86:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ b88:	89 d1                	mov    %edx,%ecx
+{
+ b8a:	83 ec 3c             	sub    $0x3c,%esp
+ b8d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ b90:	85 d2                	test   %edx,%edx
+ b92:	0f 89 80 00 00 00    	jns    c18 <printint+0x98>
+ b98:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ b9c:	74 7a                	je     c18 <printint+0x98>
+    x = -xx;
+ b9e:	f7 d9                	neg    %ecx
+    neg = 1;
+ ba0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ ba5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ ba8:	31 f6                	xor    %esi,%esi
+ baa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ bb0:	89 c8                	mov    %ecx,%eax
+ bb2:	31 d2                	xor    %edx,%edx
+ bb4:	89 f7                	mov    %esi,%edi
+ bb6:	f7 f3                	div    %ebx
+ bb8:	8d 76 01             	lea    0x1(%esi),%esi
+ bbb:	0f b6 92 f4 1c 00 00 	movzbl 0x1cf4(%edx),%edx
+ bc2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ bc6:	89 ca                	mov    %ecx,%edx
+ bc8:	89 c1                	mov    %eax,%ecx
+ bca:	39 da                	cmp    %ebx,%edx
+ bcc:	73 e2                	jae    bb0 <printint+0x30>
+  if(neg)
+ bce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ bd1:	85 c0                	test   %eax,%eax
+ bd3:	74 07                	je     bdc <printint+0x5c>
+    buf[i++] = '-';
+ bd5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ bda:	89 f7                	mov    %esi,%edi
+ bdc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ bdf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ be2:	01 df                	add    %ebx,%edi
+ be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ be8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ beb:	83 ec 04             	sub    $0x4,%esp
+ bee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ bf1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ bf4:	6a 01                	push   $0x1
+ bf6:	50                   	push   %eax
+ bf7:	56                   	push   %esi
+ bf8:	e8 a6 fe ff ff       	call   aa3 <write>
+  while(--i >= 0)
+ bfd:	89 f8                	mov    %edi,%eax
+ bff:	83 c4 10             	add    $0x10,%esp
+ c02:	83 ef 01             	sub    $0x1,%edi
+ c05:	39 d8                	cmp    %ebx,%eax
+ c07:	75 df                	jne    be8 <printint+0x68>
+}
+ c09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c0c:	5b                   	pop    %ebx
+ c0d:	5e                   	pop    %esi
+ c0e:	5f                   	pop    %edi
+ c0f:	5d                   	pop    %ebp
+ c10:	c3                   	ret
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ c18:	31 c0                	xor    %eax,%eax
+ c1a:	eb 89                	jmp    ba5 <printint+0x25>
+ c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c20 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	57                   	push   %edi
+ c24:	56                   	push   %esi
+ c25:	53                   	push   %ebx
+ c26:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ c29:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ c2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ c2f:	0f b6 1e             	movzbl (%esi),%ebx
+ c32:	83 c6 01             	add    $0x1,%esi
+ c35:	84 db                	test   %bl,%bl
+ c37:	74 67                	je     ca0 <printf+0x80>
+ c39:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ c3c:	31 d2                	xor    %edx,%edx
+ c3e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ c41:	eb 34                	jmp    c77 <printf+0x57>
+ c43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c47:	90                   	nop
+ c48:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ c4b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ c50:	83 f8 25             	cmp    $0x25,%eax
+ c53:	74 18                	je     c6d <printf+0x4d>
+  write(fd, &c, 1);
+ c55:	83 ec 04             	sub    $0x4,%esp
+ c58:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ c5b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c5e:	6a 01                	push   $0x1
+ c60:	50                   	push   %eax
+ c61:	57                   	push   %edi
+ c62:	e8 3c fe ff ff       	call   aa3 <write>
+ c67:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ c6a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ c6d:	0f b6 1e             	movzbl (%esi),%ebx
+ c70:	83 c6 01             	add    $0x1,%esi
+ c73:	84 db                	test   %bl,%bl
+ c75:	74 29                	je     ca0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ c77:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ c7a:	85 d2                	test   %edx,%edx
+ c7c:	74 ca                	je     c48 <printf+0x28>
+      }
+    } else if(state == '%'){
+ c7e:	83 fa 25             	cmp    $0x25,%edx
+ c81:	75 ea                	jne    c6d <printf+0x4d>
+      if(c == 'd'){
+ c83:	83 f8 25             	cmp    $0x25,%eax
+ c86:	0f 84 24 01 00 00    	je     db0 <printf+0x190>
+ c8c:	83 e8 63             	sub    $0x63,%eax
+ c8f:	83 f8 15             	cmp    $0x15,%eax
+ c92:	77 1c                	ja     cb0 <printf+0x90>
+ c94:	ff 24 85 9c 1c 00 00 	jmp    *0x1c9c(,%eax,4)
+ c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c9f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ ca0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ca3:	5b                   	pop    %ebx
+ ca4:	5e                   	pop    %esi
+ ca5:	5f                   	pop    %edi
+ ca6:	5d                   	pop    %ebp
+ ca7:	c3                   	ret
+ ca8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ caf:	90                   	nop
+  write(fd, &c, 1);
+ cb0:	83 ec 04             	sub    $0x4,%esp
+ cb3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ cb6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ cba:	6a 01                	push   $0x1
+ cbc:	52                   	push   %edx
+ cbd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ cc0:	57                   	push   %edi
+ cc1:	e8 dd fd ff ff       	call   aa3 <write>
+ cc6:	83 c4 0c             	add    $0xc,%esp
+ cc9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ccc:	6a 01                	push   $0x1
+ cce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ cd1:	52                   	push   %edx
+ cd2:	57                   	push   %edi
+ cd3:	e8 cb fd ff ff       	call   aa3 <write>
+        putc(fd, c);
+ cd8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ cdb:	31 d2                	xor    %edx,%edx
+ cdd:	eb 8e                	jmp    c6d <printf+0x4d>
+ cdf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ ce0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ce3:	83 ec 0c             	sub    $0xc,%esp
+ ce6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ ceb:	8b 13                	mov    (%ebx),%edx
+ ced:	6a 00                	push   $0x0
+ cef:	89 f8                	mov    %edi,%eax
+        ap++;
+ cf1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ cf4:	e8 87 fe ff ff       	call   b80 <printint>
+        ap++;
+ cf9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ cfc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ cff:	31 d2                	xor    %edx,%edx
+ d01:	e9 67 ff ff ff       	jmp    c6d <printf+0x4d>
+ d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ d10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ d13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ d15:	83 c0 04             	add    $0x4,%eax
+ d18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ d1b:	85 db                	test   %ebx,%ebx
+ d1d:	0f 84 9d 00 00 00    	je     dc0 <printf+0x1a0>
+        while(*s != 0){
+ d23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ d26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ d28:	84 c0                	test   %al,%al
+ d2a:	0f 84 3d ff ff ff    	je     c6d <printf+0x4d>
+ d30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ d33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ d36:	89 de                	mov    %ebx,%esi
+ d38:	89 d3                	mov    %edx,%ebx
+ d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ d40:	83 ec 04             	sub    $0x4,%esp
+ d43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ d46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ d49:	6a 01                	push   $0x1
+ d4b:	53                   	push   %ebx
+ d4c:	57                   	push   %edi
+ d4d:	e8 51 fd ff ff       	call   aa3 <write>
+        while(*s != 0){
+ d52:	0f b6 06             	movzbl (%esi),%eax
+ d55:	83 c4 10             	add    $0x10,%esp
+ d58:	84 c0                	test   %al,%al
+ d5a:	75 e4                	jne    d40 <printf+0x120>
+      state = 0;
+ d5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ d5f:	31 d2                	xor    %edx,%edx
+ d61:	e9 07 ff ff ff       	jmp    c6d <printf+0x4d>
+ d66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ d70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ d73:	83 ec 0c             	sub    $0xc,%esp
+ d76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ d7b:	8b 13                	mov    (%ebx),%edx
+ d7d:	6a 01                	push   $0x1
+ d7f:	e9 6b ff ff ff       	jmp    cef <printf+0xcf>
+ d84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ d88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ d8b:	83 ec 04             	sub    $0x4,%esp
+ d8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ d91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ d93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ d96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ d99:	6a 01                	push   $0x1
+ d9b:	52                   	push   %edx
+ d9c:	57                   	push   %edi
+ d9d:	e8 01 fd ff ff       	call   aa3 <write>
+        ap++;
+ da2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ da5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ da8:	31 d2                	xor    %edx,%edx
+ daa:	e9 be fe ff ff       	jmp    c6d <printf+0x4d>
+ daf:	90                   	nop
+  write(fd, &c, 1);
+ db0:	83 ec 04             	sub    $0x4,%esp
+ db3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ db6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ db9:	6a 01                	push   $0x1
+ dbb:	e9 11 ff ff ff       	jmp    cd1 <printf+0xb1>
+ dc0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ dc5:	bb 94 1c 00 00       	mov    $0x1c94,%ebx
+ dca:	e9 61 ff ff ff       	jmp    d30 <printf+0x110>
+ dcf:	90                   	nop
+
+00000dd0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ dd0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ dd1:	a1 b8 20 00 00       	mov    0x20b8,%eax
+{
+ dd6:	89 e5                	mov    %esp,%ebp
+ dd8:	57                   	push   %edi
+ dd9:	56                   	push   %esi
+ dda:	53                   	push   %ebx
+ ddb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ dde:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ de1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ de8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ dea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ dec:	39 ca                	cmp    %ecx,%edx
+ dee:	73 30                	jae    e20 <free+0x50>
+ df0:	39 c1                	cmp    %eax,%ecx
+ df2:	72 04                	jb     df8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ df4:	39 c2                	cmp    %eax,%edx
+ df6:	72 f0                	jb     de8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ df8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ dfb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ dfe:	39 f8                	cmp    %edi,%eax
+ e00:	74 2e                	je     e30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ e05:	8b 42 04             	mov    0x4(%edx),%eax
+ e08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e0b:	39 f1                	cmp    %esi,%ecx
+ e0d:	74 38                	je     e47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ e0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ e11:	5b                   	pop    %ebx
+  freep = p;
+ e12:	89 15 b8 20 00 00    	mov    %edx,0x20b8
+}
+ e18:	5e                   	pop    %esi
+ e19:	5f                   	pop    %edi
+ e1a:	5d                   	pop    %ebp
+ e1b:	c3                   	ret
+ e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e20:	39 c1                	cmp    %eax,%ecx
+ e22:	72 d0                	jb     df4 <free+0x24>
+ e24:	eb c2                	jmp    de8 <free+0x18>
+ e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ e30:	03 70 04             	add    0x4(%eax),%esi
+ e33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e36:	8b 02                	mov    (%edx),%eax
+ e38:	8b 00                	mov    (%eax),%eax
+ e3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ e3d:	8b 42 04             	mov    0x4(%edx),%eax
+ e40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e43:	39 f1                	cmp    %esi,%ecx
+ e45:	75 c8                	jne    e0f <free+0x3f>
+    p->s.size += bp->s.size;
+ e47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ e4a:	89 15 b8 20 00 00    	mov    %edx,0x20b8
+    p->s.size += bp->s.size;
+ e50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ e53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ e56:	89 0a                	mov    %ecx,(%edx)
+}
+ e58:	5b                   	pop    %ebx
+ e59:	5e                   	pop    %esi
+ e5a:	5f                   	pop    %edi
+ e5b:	5d                   	pop    %ebp
+ e5c:	c3                   	ret
+ e5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	57                   	push   %edi
+ e64:	56                   	push   %esi
+ e65:	53                   	push   %ebx
+ e66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ e6c:	8b 15 b8 20 00 00    	mov    0x20b8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e72:	8d 78 07             	lea    0x7(%eax),%edi
+ e75:	c1 ef 03             	shr    $0x3,%edi
+ e78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ e7b:	85 d2                	test   %edx,%edx
+ e7d:	0f 84 8d 00 00 00    	je     f10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e85:	8b 48 04             	mov    0x4(%eax),%ecx
+ e88:	39 f9                	cmp    %edi,%ecx
+ e8a:	73 64                	jae    ef0 <malloc+0x90>
+  if(nu < 4096)
+ e8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e91:	39 df                	cmp    %ebx,%edi
+ e93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e9d:	eb 0a                	jmp    ea9 <malloc+0x49>
+ e9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ea0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ea2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ea5:	39 f9                	cmp    %edi,%ecx
+ ea7:	73 47                	jae    ef0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ea9:	89 c2                	mov    %eax,%edx
+ eab:	39 05 b8 20 00 00    	cmp    %eax,0x20b8
+ eb1:	75 ed                	jne    ea0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ eb3:	83 ec 0c             	sub    $0xc,%esp
+ eb6:	56                   	push   %esi
+ eb7:	e8 4f fc ff ff       	call   b0b <sbrk>
+  if(p == (char*)-1)
+ ebc:	83 c4 10             	add    $0x10,%esp
+ ebf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ec2:	74 1c                	je     ee0 <malloc+0x80>
+  hp->s.size = nu;
+ ec4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ec7:	83 ec 0c             	sub    $0xc,%esp
+ eca:	83 c0 08             	add    $0x8,%eax
+ ecd:	50                   	push   %eax
+ ece:	e8 fd fe ff ff       	call   dd0 <free>
+  return freep;
+ ed3:	8b 15 b8 20 00 00    	mov    0x20b8,%edx
+      if((p = morecore(nunits)) == 0)
+ ed9:	83 c4 10             	add    $0x10,%esp
+ edc:	85 d2                	test   %edx,%edx
+ ede:	75 c0                	jne    ea0 <malloc+0x40>
+        return 0;
+  }
+}
+ ee0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ee3:	31 c0                	xor    %eax,%eax
+}
+ ee5:	5b                   	pop    %ebx
+ ee6:	5e                   	pop    %esi
+ ee7:	5f                   	pop    %edi
+ ee8:	5d                   	pop    %ebp
+ ee9:	c3                   	ret
+ eea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ef0:	39 cf                	cmp    %ecx,%edi
+ ef2:	74 4c                	je     f40 <malloc+0xe0>
+        p->s.size -= nunits;
+ ef4:	29 f9                	sub    %edi,%ecx
+ ef6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ef9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ efc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ eff:	89 15 b8 20 00 00    	mov    %edx,0x20b8
+}
+ f05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ f08:	83 c0 08             	add    $0x8,%eax
+}
+ f0b:	5b                   	pop    %ebx
+ f0c:	5e                   	pop    %esi
+ f0d:	5f                   	pop    %edi
+ f0e:	5d                   	pop    %ebp
+ f0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ f10:	c7 05 b8 20 00 00 bc 	movl   $0x20bc,0x20b8
+ f17:	20 00 00 
+    base.s.size = 0;
+ f1a:	b8 bc 20 00 00       	mov    $0x20bc,%eax
+    base.s.ptr = freep = prevp = &base;
+ f1f:	c7 05 bc 20 00 00 bc 	movl   $0x20bc,0x20bc
+ f26:	20 00 00 
+    base.s.size = 0;
+ f29:	c7 05 c0 20 00 00 00 	movl   $0x0,0x20c0
+ f30:	00 00 00 
+    if(p->s.size >= nunits){
+ f33:	e9 54 ff ff ff       	jmp    e8c <malloc+0x2c>
+ f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ f40:	8b 08                	mov    (%eax),%ecx
+ f42:	89 0a                	mov    %ecx,(%edx)
+ f44:	eb b9                	jmp    eff <malloc+0x9f>
@@ -135,6 +135,7 @@ trap(struct trapframe *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      log_tick();
     }
     lapiceoi();
     break;
@@ -162,6 +163,11 @@ trap(struct trapframe *tf)
 
   //PAGEBREAK: 13
   default:
+    if(virtioirq != 0 && tf->trapno == T_IRQ0 + virtioirq){
+      virtiointr();
+      lapiceoi();
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
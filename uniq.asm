@@ -0,0 +1,1515 @@
+
+_uniq:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+}
+
+//Main method
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 71 04             	mov    0x4(%ecx),%esi
+	int fileDescriptor, argParseIndex;
+	int fileNameLocation = argc - 1;
+
+	//xv6 has a limited string library. Hence, this garbage.
+	//flags = [c, i, d], 1 if enabled, 0 if disabled
+	int flags[] = {0, 0, 0};
+  19:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  20:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  27:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+
+	//Error checking - Check for too few arguments
+	if(argc < 1){
+  2e:	85 db                	test   %ebx,%ebx
+  30:	0f 8e ec 00 00 00    	jle    122 <main+0x122>
+		printf(1, "uniq: too few arguments\n");
+		exit();
+	}
+
+	//Check if pulling from pipe
+	if (argc == 1){
+  36:	83 fb 01             	cmp    $0x1,%ebx
+  39:	74 7a                	je     b5 <main+0xb5>
+	int fileNameLocation = argc - 1;
+  3b:	83 eb 01             	sub    $0x1,%ebx
+		printf(1, "\n");
+		exit();
+	}
+	
+	//Error checking - See if file even opens
+	if ((fileDescriptor = open(argv[fileNameLocation],0)) < 0){
+  3e:	50                   	push   %eax
+  3f:	8d 14 9e             	lea    (%esi,%ebx,4),%edx
+  42:	50                   	push   %eax
+  43:	6a 00                	push   $0x0
+  45:	ff 32                	push   (%edx)
+  47:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  4a:	e8 a4 05 00 00       	call   5f3 <open>
+  4f:	83 c4 10             	add    $0x10,%esp
+  52:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  55:	85 c0                	test   %eax,%eax
+  57:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  5a:	0f 88 d5 00 00 00    	js     135 <main+0x135>
+		printf(1, "uniq: %s cannot be opened\n", argv[fileNameLocation]);
+		exit();
+	}
+
+	//Loop through the array of arguments to find flags
+	for(argParseIndex = 1; argParseIndex < (argc - 1); argParseIndex++){
+  60:	bf 01 00 00 00       	mov    $0x1,%edi
+  65:	83 fb 01             	cmp    $0x1,%ebx
+  68:	75 14                	jne    7e <main+0x7e>
+  6a:	eb 77                	jmp    e3 <main+0xe3>
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+		//If the command contains a flag we want, add it to what we want to pass to uniq
+		if (strcmp(argv[argParseIndex], "-c") == 0){
+			flags[0] = 1;
+  70:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+	for(argParseIndex = 1; argParseIndex < (argc - 1); argParseIndex++){
+  77:	83 c7 01             	add    $0x1,%edi
+  7a:	39 fb                	cmp    %edi,%ebx
+  7c:	74 65                	je     e3 <main+0xe3>
+		if (strcmp(argv[argParseIndex], "-c") == 0){
+  7e:	83 ec 08             	sub    $0x8,%esp
+  81:	68 d0 0a 00 00       	push   $0xad0
+  86:	ff 34 be             	push   (%esi,%edi,4)
+  89:	e8 12 03 00 00       	call   3a0 <strcmp>
+  8e:	83 c4 10             	add    $0x10,%esp
+  91:	85 c0                	test   %eax,%eax
+  93:	74 db                	je     70 <main+0x70>
+
+		}else if (strcmp(argv[argParseIndex], "-i") == 0){
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	68 d3 0a 00 00       	push   $0xad3
+  9d:	ff 34 be             	push   (%esi,%edi,4)
+  a0:	e8 fb 02 00 00       	call   3a0 <strcmp>
+  a5:	83 c4 10             	add    $0x10,%esp
+  a8:	85 c0                	test   %eax,%eax
+  aa:	75 50                	jne    fc <main+0xfc>
+			flags[1] = 1;
+  ac:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+  b3:	eb c2                	jmp    77 <main+0x77>
+		printf(1, "\n");
+  b5:	50                   	push   %eax
+  b6:	50                   	push   %eax
+  b7:	68 ce 0a 00 00       	push   $0xace
+  bc:	6a 01                	push   $0x1
+  be:	e8 8d 06 00 00       	call   750 <printf>
+		uniq(0, flags);
+  c3:	58                   	pop    %eax
+  c4:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  c7:	5a                   	pop    %edx
+  c8:	50                   	push   %eax
+  c9:	6a 00                	push   $0x0
+
+	}
+
+	//Call the command with the arguments, exit when done
+	printf(1, "\n");
+	uniq(fileDescriptor, flags);
+  cb:	e8 80 00 00 00       	call   150 <uniq>
+	printf(1, "\n");
+  d0:	58                   	pop    %eax
+  d1:	5a                   	pop    %edx
+  d2:	68 ce 0a 00 00       	push   $0xace
+  d7:	6a 01                	push   $0x1
+  d9:	e8 72 06 00 00       	call   750 <printf>
+	exit();
+  de:	e8 d0 04 00 00       	call   5b3 <exit>
+	printf(1, "\n");
+  e3:	51                   	push   %ecx
+  e4:	51                   	push   %ecx
+  e5:	68 ce 0a 00 00       	push   $0xace
+  ea:	6a 01                	push   $0x1
+  ec:	e8 5f 06 00 00       	call   750 <printf>
+	uniq(fileDescriptor, flags);
+  f1:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  f4:	5b                   	pop    %ebx
+  f5:	5e                   	pop    %esi
+  f6:	50                   	push   %eax
+  f7:	ff 75 d0             	push   -0x30(%ebp)
+  fa:	eb cf                	jmp    cb <main+0xcb>
+		}else if (strcmp(argv[argParseIndex], "-d") == 0){
+  fc:	50                   	push   %eax
+  fd:	50                   	push   %eax
+  fe:	68 d6 0a 00 00       	push   $0xad6
+ 103:	ff 34 be             	push   (%esi,%edi,4)
+ 106:	e8 95 02 00 00       	call   3a0 <strcmp>
+ 10b:	83 c4 10             	add    $0x10,%esp
+ 10e:	85 c0                	test   %eax,%eax
+ 110:	0f 85 61 ff ff ff    	jne    77 <main+0x77>
+			flags[2] = 1;
+ 116:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+ 11d:	e9 55 ff ff ff       	jmp    77 <main+0x77>
+		printf(1, "uniq: too few arguments\n");
+ 122:	51                   	push   %ecx
+ 123:	51                   	push   %ecx
+ 124:	68 9c 0a 00 00       	push   $0xa9c
+ 129:	6a 01                	push   $0x1
+ 12b:	e8 20 06 00 00       	call   750 <printf>
+		exit();
+ 130:	e8 7e 04 00 00       	call   5b3 <exit>
+		printf(1, "uniq: %s cannot be opened\n", argv[fileNameLocation]);
+ 135:	50                   	push   %eax
+ 136:	ff 32                	push   (%edx)
+ 138:	68 b5 0a 00 00       	push   $0xab5
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 0c 06 00 00       	call   750 <printf>
+		exit();
+ 144:	e8 6a 04 00 00       	call   5b3 <exit>
+ 149:	66 90                	xchg   %ax,%ax
+ 14b:	66 90                	xchg   %ax,%ax
+ 14d:	66 90                	xchg   %ax,%ax
+ 14f:	90                   	nop
+
+00000150 <uniq>:
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+	int isFirstIteration = 1;
+ 154:	bf 01 00 00 00       	mov    $0x1,%edi
+{
+ 159:	56                   	push   %esi
+ 15a:	8d b5 e7 fb ff ff    	lea    -0x419(%ebp),%esi
+ 160:	53                   	push   %ebx
+	int line2len = 0;
+ 161:	31 db                	xor    %ebx,%ebx
+{
+ 163:	81 ec 2c 04 00 00    	sub    $0x42c,%esp
+	int matchesFound = 0;
+ 169:	c7 85 d0 fb ff ff 00 	movl   $0x0,-0x430(%ebp)
+ 170:	00 00 00 
+	int line1len = 0;
+ 173:	c7 85 d4 fb ff ff 00 	movl   $0x0,-0x42c(%ebp)
+ 17a:	00 00 00 
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+	while((hasChar = read(fileDescriptor, &currentChar, 1)) > 0){
+ 180:	83 ec 04             	sub    $0x4,%esp
+ 183:	6a 01                	push   $0x1
+ 185:	56                   	push   %esi
+ 186:	ff 75 08             	push   0x8(%ebp)
+ 189:	e8 3d 04 00 00       	call   5cb <read>
+ 18e:	83 c4 10             	add    $0x10,%esp
+ 191:	85 c0                	test   %eax,%eax
+ 193:	7e 73                	jle    208 <uniq+0xb8>
+		if(currentChar == '\n'){
+ 195:	0f b6 85 e7 fb ff ff 	movzbl -0x419(%ebp),%eax
+ 19c:	3c 0a                	cmp    $0xa,%al
+ 19e:	74 30                	je     1d0 <uniq+0x80>
+			if(flags[1] == 1){
+ 1a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 1a3:	83 79 04 01          	cmpl   $0x1,0x4(%ecx)
+ 1a7:	74 47                	je     1f0 <uniq+0xa0>
+			if(isFirstIteration){
+ 1a9:	85 ff                	test   %edi,%edi
+ 1ab:	74 33                	je     1e0 <uniq+0x90>
+				line1[line1len] = currentChar;
+ 1ad:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+ 1b3:	0f b6 85 e7 fb ff ff 	movzbl -0x419(%ebp),%eax
+ 1ba:	88 84 15 e8 fb ff ff 	mov    %al,-0x418(%ebp,%edx,1)
+				line1len += 1;
+ 1c1:	83 c2 01             	add    $0x1,%edx
+ 1c4:	89 95 d4 fb ff ff    	mov    %edx,-0x42c(%ebp)
+ 1ca:	eb b4                	jmp    180 <uniq+0x30>
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+			if(isFirstIteration){
+ 1d0:	85 ff                	test   %edi,%edi
+ 1d2:	74 7c                	je     250 <uniq+0x100>
+				isFirstIteration = 0;
+ 1d4:	31 ff                	xor    %edi,%edi
+ 1d6:	eb a8                	jmp    180 <uniq+0x30>
+ 1d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+				line2[line2len] = currentChar;
+ 1e0:	88 84 1d e8 fd ff ff 	mov    %al,-0x218(%ebp,%ebx,1)
+				line2len += 1;
+ 1e7:	83 c3 01             	add    $0x1,%ebx
+ 1ea:	eb 94                	jmp    180 <uniq+0x30>
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+				if(currentChar >= 65 && currentChar <= 90){
+ 1f0:	8d 50 bf             	lea    -0x41(%eax),%edx
+ 1f3:	80 fa 19             	cmp    $0x19,%dl
+ 1f6:	77 b1                	ja     1a9 <uniq+0x59>
+					currentChar += 32;
+ 1f8:	83 c0 20             	add    $0x20,%eax
+ 1fb:	88 85 e7 fb ff ff    	mov    %al,-0x419(%ebp)
+ 201:	eb a6                	jmp    1a9 <uniq+0x59>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+	if(hasChar < 0){
+ 208:	0f 85 41 01 00 00    	jne    34f <uniq+0x1ff>
+	if(flags[2] == 1 && matchesFound == 0){
+ 20e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 211:	83 78 08 01          	cmpl   $0x1,0x8(%eax)
+ 215:	75 0a                	jne    221 <uniq+0xd1>
+ 217:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+ 21d:	85 c0                	test   %eax,%eax
+ 21f:	74 25                	je     246 <uniq+0xf6>
+		if(flags[0] == 1){
+ 221:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 224:	83 38 01             	cmpl   $0x1,(%eax)
+ 227:	0f 84 e3 00 00 00    	je     310 <uniq+0x1c0>
+		printf(1, "%s\n", line1);
+ 22d:	83 ec 04             	sub    $0x4,%esp
+ 230:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+ 236:	50                   	push   %eax
+ 237:	68 7d 0a 00 00       	push   $0xa7d
+ 23c:	6a 01                	push   $0x1
+ 23e:	e8 0d 05 00 00       	call   750 <printf>
+ 243:	83 c4 10             	add    $0x10,%esp
+}
+ 246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 249:	5b                   	pop    %ebx
+ 24a:	5e                   	pop    %esi
+ 24b:	5f                   	pop    %edi
+ 24c:	5d                   	pop    %ebp
+ 24d:	c3                   	ret
+ 24e:	66 90                	xchg   %ax,%ax
+				if(strcmp(line1, line2) == 0){
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 259:	50                   	push   %eax
+ 25a:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+ 260:	50                   	push   %eax
+ 261:	e8 3a 01 00 00       	call   3a0 <strcmp>
+ 266:	83 c4 10             	add    $0x10,%esp
+ 269:	85 c0                	test   %eax,%eax
+ 26b:	75 5b                	jne    2c8 <uniq+0x178>
+					matchesFound += 1;
+ 26d:	83 85 d0 fb ff ff 01 	addl   $0x1,-0x430(%ebp)
+				memset(line1, 0, line1len);
+ 274:	83 ec 04             	sub    $0x4,%esp
+ 277:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+ 27d:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+ 283:	6a 00                	push   $0x0
+ 285:	50                   	push   %eax
+ 286:	e8 a5 01 00 00       	call   430 <memset>
+				memmove(line1, line2, line2len);
+ 28b:	83 c4 0c             	add    $0xc,%esp
+ 28e:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 294:	53                   	push   %ebx
+ 295:	50                   	push   %eax
+ 296:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+ 29c:	50                   	push   %eax
+ 29d:	e8 de 02 00 00       	call   580 <memmove>
+				memset(line2, 0, line2len);
+ 2a2:	83 c4 0c             	add    $0xc,%esp
+ 2a5:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 2ab:	53                   	push   %ebx
+ 2ac:	6a 00                	push   $0x0
+ 2ae:	50                   	push   %eax
+ 2af:	e8 7c 01 00 00       	call   430 <memset>
+				line1len = line2len;
+ 2b4:	89 9d d4 fb ff ff    	mov    %ebx,-0x42c(%ebp)
+				memset(line2, 0, line2len);
+ 2ba:	83 c4 10             	add    $0x10,%esp
+				line2len = 0;
+ 2bd:	31 db                	xor    %ebx,%ebx
+ 2bf:	e9 bc fe ff ff       	jmp    180 <uniq+0x30>
+ 2c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+					if(flags[2] == 1 && matchesFound == 0){
+ 2c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2cb:	83 78 08 01          	cmpl   $0x1,0x8(%eax)
+ 2cf:	75 0a                	jne    2db <uniq+0x18b>
+ 2d1:	8b 8d d0 fb ff ff    	mov    -0x430(%ebp),%ecx
+ 2d7:	85 c9                	test   %ecx,%ecx
+ 2d9:	74 21                	je     2fc <uniq+0x1ac>
+						if(flags[0] == 1){
+ 2db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2de:	83 38 01             	cmpl   $0x1,(%eax)
+ 2e1:	74 4e                	je     331 <uniq+0x1e1>
+						printf(1, "%s\n", line1);
+ 2e3:	83 ec 04             	sub    $0x4,%esp
+ 2e6:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+ 2ec:	50                   	push   %eax
+ 2ed:	68 7d 0a 00 00       	push   $0xa7d
+ 2f2:	6a 01                	push   $0x1
+ 2f4:	e8 57 04 00 00       	call   750 <printf>
+ 2f9:	83 c4 10             	add    $0x10,%esp
+{
+ 2fc:	c7 85 d0 fb ff ff 00 	movl   $0x0,-0x430(%ebp)
+ 303:	00 00 00 
+ 306:	e9 69 ff ff ff       	jmp    274 <uniq+0x124>
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+			printf(1, "%d  ", matchesFound + 1);
+ 310:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+ 316:	83 ec 04             	sub    $0x4,%esp
+ 319:	83 c0 01             	add    $0x1,%eax
+ 31c:	50                   	push   %eax
+ 31d:	68 78 0a 00 00       	push   $0xa78
+ 322:	6a 01                	push   $0x1
+ 324:	e8 27 04 00 00       	call   750 <printf>
+ 329:	83 c4 10             	add    $0x10,%esp
+ 32c:	e9 fc fe ff ff       	jmp    22d <uniq+0xdd>
+							printf(1, "%d  ", matchesFound + 1); 
+ 331:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+ 337:	83 ec 04             	sub    $0x4,%esp
+ 33a:	83 c0 01             	add    $0x1,%eax
+ 33d:	50                   	push   %eax
+ 33e:	68 78 0a 00 00       	push   $0xa78
+ 343:	6a 01                	push   $0x1
+ 345:	e8 06 04 00 00       	call   750 <printf>
+ 34a:	83 c4 10             	add    $0x10,%esp
+ 34d:	eb 94                	jmp    2e3 <uniq+0x193>
+		printf(1, "uniq: could not read file\n");
+ 34f:	52                   	push   %edx
+ 350:	52                   	push   %edx
+ 351:	68 81 0a 00 00       	push   $0xa81
+ 356:	6a 01                	push   $0x1
+ 358:	e8 f3 03 00 00       	call   750 <printf>
+		exit();
+ 35d:	e8 51 02 00 00       	call   5b3 <exit>
+ 362:	66 90                	xchg   %ax,%ax
+ 364:	66 90                	xchg   %ax,%ax
+ 366:	66 90                	xchg   %ax,%ax
+ 368:	66 90                	xchg   %ax,%ax
+ 36a:	66 90                	xchg   %ax,%ax
+ 36c:	66 90                	xchg   %ax,%ax
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 370:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 371:	31 c0                	xor    %eax,%eax
+{
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	53                   	push   %ebx
+ 376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 380:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 384:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 387:	83 c0 01             	add    $0x1,%eax
+ 38a:	84 d2                	test   %dl,%dl
+ 38c:	75 f2                	jne    380 <strcpy+0x10>
+    ;
+  return os;
+}
+ 38e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 391:	89 c8                	mov    %ecx,%eax
+ 393:	c9                   	leave
+ 394:	c3                   	ret
+ 395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3aa:	0f b6 02             	movzbl (%edx),%eax
+ 3ad:	84 c0                	test   %al,%al
+ 3af:	75 17                	jne    3c8 <strcmp+0x28>
+ 3b1:	eb 3a                	jmp    3ed <strcmp+0x4d>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3bc:	83 c2 01             	add    $0x1,%edx
+ 3bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3c2:	84 c0                	test   %al,%al
+ 3c4:	74 1a                	je     3e0 <strcmp+0x40>
+    p++, q++;
+ 3c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3cb:	38 c3                	cmp    %al,%bl
+ 3cd:	74 e9                	je     3b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3cf:	29 d8                	sub    %ebx,%eax
+}
+ 3d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d4:	c9                   	leave
+ 3d5:	c3                   	ret
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3e4:	31 c0                	xor    %eax,%eax
+ 3e6:	29 d8                	sub    %ebx,%eax
+}
+ 3e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3eb:	c9                   	leave
+ 3ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 3f0:	31 c0                	xor    %eax,%eax
+ 3f2:	eb db                	jmp    3cf <strcmp+0x2f>
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 406:	80 3a 00             	cmpb   $0x0,(%edx)
+ 409:	74 15                	je     420 <strlen+0x20>
+ 40b:	31 c0                	xor    %eax,%eax
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+ 410:	83 c0 01             	add    $0x1,%eax
+ 413:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 417:	89 c1                	mov    %eax,%ecx
+ 419:	75 f5                	jne    410 <strlen+0x10>
+    ;
+  return n;
+}
+ 41b:	89 c8                	mov    %ecx,%eax
+ 41d:	5d                   	pop    %ebp
+ 41e:	c3                   	ret
+ 41f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 420:	31 c9                	xor    %ecx,%ecx
+}
+ 422:	5d                   	pop    %ebp
+ 423:	89 c8                	mov    %ecx,%eax
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 437:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 43a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43d:	89 d7                	mov    %edx,%edi
+ 43f:	fc                   	cld
+ 440:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 442:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 445:	89 d0                	mov    %edx,%eax
+ 447:	c9                   	leave
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 45a:	0f b6 10             	movzbl (%eax),%edx
+ 45d:	84 d2                	test   %dl,%dl
+ 45f:	75 12                	jne    473 <strchr+0x23>
+ 461:	eb 1d                	jmp    480 <strchr+0x30>
+ 463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 467:	90                   	nop
+ 468:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 46c:	83 c0 01             	add    $0x1,%eax
+ 46f:	84 d2                	test   %dl,%dl
+ 471:	74 0d                	je     480 <strchr+0x30>
+    if(*s == c)
+ 473:	38 d1                	cmp    %dl,%cl
+ 475:	75 f1                	jne    468 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 477:	5d                   	pop    %ebp
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 480:	31 c0                	xor    %eax,%eax
+}
+ 482:	5d                   	pop    %ebp
+ 483:	c3                   	ret
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 495:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 498:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 499:	31 db                	xor    %ebx,%ebx
+{
+ 49b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 49e:	eb 27                	jmp    4c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4a0:	83 ec 04             	sub    $0x4,%esp
+ 4a3:	6a 01                	push   $0x1
+ 4a5:	56                   	push   %esi
+ 4a6:	6a 00                	push   $0x0
+ 4a8:	e8 1e 01 00 00       	call   5cb <read>
+    if(cc < 1)
+ 4ad:	83 c4 10             	add    $0x10,%esp
+ 4b0:	85 c0                	test   %eax,%eax
+ 4b2:	7e 1d                	jle    4d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4bf:	3c 0a                	cmp    $0xa,%al
+ 4c1:	74 10                	je     4d3 <gets+0x43>
+ 4c3:	3c 0d                	cmp    $0xd,%al
+ 4c5:	74 0c                	je     4d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4c7:	89 df                	mov    %ebx,%edi
+ 4c9:	83 c3 01             	add    $0x1,%ebx
+ 4cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4cf:	7c cf                	jl     4a0 <gets+0x10>
+ 4d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4dd:	5b                   	pop    %ebx
+ 4de:	5e                   	pop    %esi
+ 4df:	5f                   	pop    %edi
+ 4e0:	5d                   	pop    %ebp
+ 4e1:	c3                   	ret
+ 4e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <stat>:
+
+int stat(const char *n, struct stat *st)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	56                   	push   %esi
+ 4f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4f5:	83 ec 08             	sub    $0x8,%esp
+ 4f8:	6a 00                	push   $0x0
+ 4fa:	ff 75 08             	push   0x8(%ebp)
+ 4fd:	e8 f1 00 00 00       	call   5f3 <open>
+  if(fd < 0)
+ 502:	83 c4 10             	add    $0x10,%esp
+ 505:	85 c0                	test   %eax,%eax
+ 507:	78 27                	js     530 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 509:	83 ec 08             	sub    $0x8,%esp
+ 50c:	ff 75 0c             	push   0xc(%ebp)
+ 50f:	89 c3                	mov    %eax,%ebx
+ 511:	50                   	push   %eax
+ 512:	e8 f4 00 00 00       	call   60b <fstat>
+  close(fd);
+ 517:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 51a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 51c:	e8 ba 00 00 00       	call   5db <close>
+  return r;
+ 521:	83 c4 10             	add    $0x10,%esp
+}
+ 524:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 527:	89 f0                	mov    %esi,%eax
+ 529:	5b                   	pop    %ebx
+ 52a:	5e                   	pop    %esi
+ 52b:	5d                   	pop    %ebp
+ 52c:	c3                   	ret
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 530:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 535:	eb ed                	jmp    524 <stat+0x34>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 547:	0f be 02             	movsbl (%edx),%eax
+ 54a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 54d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 555:	77 1e                	ja     575 <atoi+0x35>
+ 557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 560:	83 c2 01             	add    $0x1,%edx
+ 563:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 566:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 56a:	0f be 02             	movsbl (%edx),%eax
+ 56d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 570:	80 fb 09             	cmp    $0x9,%bl
+ 573:	76 eb                	jbe    560 <atoi+0x20>
+  return n;
+}
+ 575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 578:	89 c8                	mov    %ecx,%eax
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	8b 45 10             	mov    0x10(%ebp),%eax
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 58e:	85 c0                	test   %eax,%eax
+ 590:	7e 13                	jle    5a5 <memmove+0x25>
+ 592:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 594:	89 d7                	mov    %edx,%edi
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5a1:	39 f8                	cmp    %edi,%eax
+ 5a3:	75 fb                	jne    5a0 <memmove+0x20>
+  return vdst;
+}
+ 5a5:	5e                   	pop    %esi
+ 5a6:	89 d0                	mov    %edx,%eax
+ 5a8:	5f                   	pop    %edi
+ 5a9:	5d                   	pop    %ebp
+ 5aa:	c3                   	ret
+
+000005ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <exit>:
+SYSCALL(exit)
+ 5b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <wait>:
+SYSCALL(wait)
+ 5bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <pipe>:
+SYSCALL(pipe)
+ 5c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <read>:
+SYSCALL(read)
+ 5cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <write>:
+SYSCALL(write)
+ 5d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <close>:
+SYSCALL(close)
+ 5db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <kill>:
+SYSCALL(kill)
+ 5e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <exec>:
+SYSCALL(exec)
+ 5eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <open>:
+SYSCALL(open)
+ 5f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <mknod>:
+SYSCALL(mknod)
+ 5fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <unlink>:
+SYSCALL(unlink)
+ 603:	b8 12 00 00 00       	mov    $0x12,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <fstat>:
+SYSCALL(fstat)
+ 60b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <link>:
+SYSCALL(link)
+ 613:	b8 13 00 00 00       	mov    $0x13,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <mkdir>:
+SYSCALL(mkdir)
+ 61b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <chdir>:
+SYSCALL(chdir)
+ 623:	b8 09 00 00 00       	mov    $0x9,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <dup>:
+SYSCALL(dup)
+ 62b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getpid>:
+SYSCALL(getpid)
+ 633:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <sbrk>:
+SYSCALL(sbrk)
+ 63b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <sleep>:
+SYSCALL(sleep)
+ 643:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <uptime>:
+SYSCALL(uptime)
+ 64b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <time_scheduled>:
+SYSCALL(time_scheduled)
+ 653:	b8 16 00 00 00       	mov    $0x16,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <set_sched_priority>:
+SYSCALL(set_sched_priority)
+ 65b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <get_sched_priority>:
+SYSCALL(get_sched_priority)
+ 663:	b8 18 00 00 00       	mov    $0x18,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <fifo_position>:
+SYSCALL(fifo_position)
+ 66b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <printProcessTable>:
+SYSCALL(printProcessTable)
+ 673:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <symlink>:
+SYSCALL(symlink)
+ 67b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <lseek>:
+SYSCALL(lseek)
+ 683:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <fallocate>:
+SYSCALL(fallocate)
+ 68b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <iostats>:
+SYSCALL(iostats)
+ 693:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <fsync>:
+SYSCALL(fsync)
+ 69b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+ 6a3:	66 90                	xchg   %ax,%ax
+ 6a5:	66 90                	xchg   %ax,%ax
+ 6a7:	66 90                	xchg   %ax,%ax
+ 6a9:	66 90                	xchg   %ax,%ax
+ 6ab:	66 90                	xchg   %ax,%ax
+ 6ad:	66 90                	xchg   %ax,%ax
+ 6af:	90                   	nop
+
+000006b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6b8:	89 d1                	mov    %edx,%ecx
+{
+ 6ba:	83 ec 3c             	sub    $0x3c,%esp
+ 6bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6c0:	85 d2                	test   %edx,%edx
+ 6c2:	0f 89 80 00 00 00    	jns    748 <printint+0x98>
+ 6c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6cc:	74 7a                	je     748 <printint+0x98>
+    x = -xx;
+ 6ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6d8:	31 f6                	xor    %esi,%esi
+ 6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6e0:	89 c8                	mov    %ecx,%eax
+ 6e2:	31 d2                	xor    %edx,%edx
+ 6e4:	89 f7                	mov    %esi,%edi
+ 6e6:	f7 f3                	div    %ebx
+ 6e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6eb:	0f b6 92 38 0b 00 00 	movzbl 0xb38(%edx),%edx
+ 6f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6f6:	89 ca                	mov    %ecx,%edx
+ 6f8:	89 c1                	mov    %eax,%ecx
+ 6fa:	39 da                	cmp    %ebx,%edx
+ 6fc:	73 e2                	jae    6e0 <printint+0x30>
+  if(neg)
+ 6fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 701:	85 c0                	test   %eax,%eax
+ 703:	74 07                	je     70c <printint+0x5c>
+    buf[i++] = '-';
+ 705:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 70a:	89 f7                	mov    %esi,%edi
+ 70c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 70f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 712:	01 df                	add    %ebx,%edi
+ 714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 718:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 71b:	83 ec 04             	sub    $0x4,%esp
+ 71e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 721:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 724:	6a 01                	push   $0x1
+ 726:	50                   	push   %eax
+ 727:	56                   	push   %esi
+ 728:	e8 a6 fe ff ff       	call   5d3 <write>
+  while(--i >= 0)
+ 72d:	89 f8                	mov    %edi,%eax
+ 72f:	83 c4 10             	add    $0x10,%esp
+ 732:	83 ef 01             	sub    $0x1,%edi
+ 735:	39 d8                	cmp    %ebx,%eax
+ 737:	75 df                	jne    718 <printint+0x68>
+}
+ 739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 73c:	5b                   	pop    %ebx
+ 73d:	5e                   	pop    %esi
+ 73e:	5f                   	pop    %edi
+ 73f:	5d                   	pop    %ebp
+ 740:	c3                   	ret
+ 741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 748:	31 c0                	xor    %eax,%eax
+ 74a:	eb 89                	jmp    6d5 <printint+0x25>
+ 74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 759:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 75c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 75f:	0f b6 1e             	movzbl (%esi),%ebx
+ 762:	83 c6 01             	add    $0x1,%esi
+ 765:	84 db                	test   %bl,%bl
+ 767:	74 67                	je     7d0 <printf+0x80>
+ 769:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 76c:	31 d2                	xor    %edx,%edx
+ 76e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 771:	eb 34                	jmp    7a7 <printf+0x57>
+ 773:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 777:	90                   	nop
+ 778:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 77b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 780:	83 f8 25             	cmp    $0x25,%eax
+ 783:	74 18                	je     79d <printf+0x4d>
+  write(fd, &c, 1);
+ 785:	83 ec 04             	sub    $0x4,%esp
+ 788:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 78b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 78e:	6a 01                	push   $0x1
+ 790:	50                   	push   %eax
+ 791:	57                   	push   %edi
+ 792:	e8 3c fe ff ff       	call   5d3 <write>
+ 797:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 79a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 79d:	0f b6 1e             	movzbl (%esi),%ebx
+ 7a0:	83 c6 01             	add    $0x1,%esi
+ 7a3:	84 db                	test   %bl,%bl
+ 7a5:	74 29                	je     7d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7aa:	85 d2                	test   %edx,%edx
+ 7ac:	74 ca                	je     778 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ae:	83 fa 25             	cmp    $0x25,%edx
+ 7b1:	75 ea                	jne    79d <printf+0x4d>
+      if(c == 'd'){
+ 7b3:	83 f8 25             	cmp    $0x25,%eax
+ 7b6:	0f 84 24 01 00 00    	je     8e0 <printf+0x190>
+ 7bc:	83 e8 63             	sub    $0x63,%eax
+ 7bf:	83 f8 15             	cmp    $0x15,%eax
+ 7c2:	77 1c                	ja     7e0 <printf+0x90>
+ 7c4:	ff 24 85 e0 0a 00 00 	jmp    *0xae0(,%eax,4)
+ 7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7d3:	5b                   	pop    %ebx
+ 7d4:	5e                   	pop    %esi
+ 7d5:	5f                   	pop    %edi
+ 7d6:	5d                   	pop    %ebp
+ 7d7:	c3                   	ret
+ 7d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7ea:	6a 01                	push   $0x1
+ 7ec:	52                   	push   %edx
+ 7ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7f0:	57                   	push   %edi
+ 7f1:	e8 dd fd ff ff       	call   5d3 <write>
+ 7f6:	83 c4 0c             	add    $0xc,%esp
+ 7f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7fc:	6a 01                	push   $0x1
+ 7fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 801:	52                   	push   %edx
+ 802:	57                   	push   %edi
+ 803:	e8 cb fd ff ff       	call   5d3 <write>
+        putc(fd, c);
+ 808:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 80b:	31 d2                	xor    %edx,%edx
+ 80d:	eb 8e                	jmp    79d <printf+0x4d>
+ 80f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 810:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 81b:	8b 13                	mov    (%ebx),%edx
+ 81d:	6a 00                	push   $0x0
+ 81f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 821:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 824:	e8 87 fe ff ff       	call   6b0 <printint>
+        ap++;
+ 829:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 82c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 82f:	31 d2                	xor    %edx,%edx
+ 831:	e9 67 ff ff ff       	jmp    79d <printf+0x4d>
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 840:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 843:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 845:	83 c0 04             	add    $0x4,%eax
+ 848:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 84b:	85 db                	test   %ebx,%ebx
+ 84d:	0f 84 9d 00 00 00    	je     8f0 <printf+0x1a0>
+        while(*s != 0){
+ 853:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 856:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 858:	84 c0                	test   %al,%al
+ 85a:	0f 84 3d ff ff ff    	je     79d <printf+0x4d>
+ 860:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 863:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 866:	89 de                	mov    %ebx,%esi
+ 868:	89 d3                	mov    %edx,%ebx
+ 86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 876:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 879:	6a 01                	push   $0x1
+ 87b:	53                   	push   %ebx
+ 87c:	57                   	push   %edi
+ 87d:	e8 51 fd ff ff       	call   5d3 <write>
+        while(*s != 0){
+ 882:	0f b6 06             	movzbl (%esi),%eax
+ 885:	83 c4 10             	add    $0x10,%esp
+ 888:	84 c0                	test   %al,%al
+ 88a:	75 e4                	jne    870 <printf+0x120>
+      state = 0;
+ 88c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 07 ff ff ff       	jmp    79d <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8a3:	83 ec 0c             	sub    $0xc,%esp
+ 8a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8ab:	8b 13                	mov    (%ebx),%edx
+ 8ad:	6a 01                	push   $0x1
+ 8af:	e9 6b ff ff ff       	jmp    81f <printf+0xcf>
+ 8b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8bb:	83 ec 04             	sub    $0x4,%esp
+ 8be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8c9:	6a 01                	push   $0x1
+ 8cb:	52                   	push   %edx
+ 8cc:	57                   	push   %edi
+ 8cd:	e8 01 fd ff ff       	call   5d3 <write>
+        ap++;
+ 8d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8d8:	31 d2                	xor    %edx,%edx
+ 8da:	e9 be fe ff ff       	jmp    79d <printf+0x4d>
+ 8df:	90                   	nop
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	e9 11 ff ff ff       	jmp    801 <printf+0xb1>
+ 8f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8f5:	bb d9 0a 00 00       	mov    $0xad9,%ebx
+ 8fa:	e9 61 ff ff ff       	jmp    860 <printf+0x110>
+ 8ff:	90                   	nop
+
+00000900 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 900:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 901:	a1 14 0e 00 00       	mov    0xe14,%eax
+{
+ 906:	89 e5                	mov    %esp,%ebp
+ 908:	57                   	push   %edi
+ 909:	56                   	push   %esi
+ 90a:	53                   	push   %ebx
+ 90b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 90e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 918:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 91a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 91c:	39 ca                	cmp    %ecx,%edx
+ 91e:	73 30                	jae    950 <free+0x50>
+ 920:	39 c1                	cmp    %eax,%ecx
+ 922:	72 04                	jb     928 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 924:	39 c2                	cmp    %eax,%edx
+ 926:	72 f0                	jb     918 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 928:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 92b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 92e:	39 f8                	cmp    %edi,%eax
+ 930:	74 2e                	je     960 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 932:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 935:	8b 42 04             	mov    0x4(%edx),%eax
+ 938:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 93b:	39 f1                	cmp    %esi,%ecx
+ 93d:	74 38                	je     977 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 93f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 941:	5b                   	pop    %ebx
+  freep = p;
+ 942:	89 15 14 0e 00 00    	mov    %edx,0xe14
+}
+ 948:	5e                   	pop    %esi
+ 949:	5f                   	pop    %edi
+ 94a:	5d                   	pop    %ebp
+ 94b:	c3                   	ret
+ 94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 950:	39 c1                	cmp    %eax,%ecx
+ 952:	72 d0                	jb     924 <free+0x24>
+ 954:	eb c2                	jmp    918 <free+0x18>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 960:	03 70 04             	add    0x4(%eax),%esi
+ 963:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 966:	8b 02                	mov    (%edx),%eax
+ 968:	8b 00                	mov    (%eax),%eax
+ 96a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 96d:	8b 42 04             	mov    0x4(%edx),%eax
+ 970:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 973:	39 f1                	cmp    %esi,%ecx
+ 975:	75 c8                	jne    93f <free+0x3f>
+    p->s.size += bp->s.size;
+ 977:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 97a:	89 15 14 0e 00 00    	mov    %edx,0xe14
+    p->s.size += bp->s.size;
+ 980:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 983:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 986:	89 0a                	mov    %ecx,(%edx)
+}
+ 988:	5b                   	pop    %ebx
+ 989:	5e                   	pop    %esi
+ 98a:	5f                   	pop    %edi
+ 98b:	5d                   	pop    %ebp
+ 98c:	c3                   	ret
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000990 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 999:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 99c:	8b 15 14 0e 00 00    	mov    0xe14,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9a2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9a5:	c1 ef 03             	shr    $0x3,%edi
+ 9a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9ab:	85 d2                	test   %edx,%edx
+ 9ad:	0f 84 8d 00 00 00    	je     a40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9b5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9b8:	39 f9                	cmp    %edi,%ecx
+ 9ba:	73 64                	jae    a20 <malloc+0x90>
+  if(nu < 4096)
+ 9bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9c1:	39 df                	cmp    %ebx,%edi
+ 9c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9cd:	eb 0a                	jmp    9d9 <malloc+0x49>
+ 9cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9d2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9d5:	39 f9                	cmp    %edi,%ecx
+ 9d7:	73 47                	jae    a20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9d9:	89 c2                	mov    %eax,%edx
+ 9db:	39 05 14 0e 00 00    	cmp    %eax,0xe14
+ 9e1:	75 ed                	jne    9d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	56                   	push   %esi
+ 9e7:	e8 4f fc ff ff       	call   63b <sbrk>
+  if(p == (char*)-1)
+ 9ec:	83 c4 10             	add    $0x10,%esp
+ 9ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9f2:	74 1c                	je     a10 <malloc+0x80>
+  hp->s.size = nu;
+ 9f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9f7:	83 ec 0c             	sub    $0xc,%esp
+ 9fa:	83 c0 08             	add    $0x8,%eax
+ 9fd:	50                   	push   %eax
+ 9fe:	e8 fd fe ff ff       	call   900 <free>
+  return freep;
+ a03:	8b 15 14 0e 00 00    	mov    0xe14,%edx
+      if((p = morecore(nunits)) == 0)
+ a09:	83 c4 10             	add    $0x10,%esp
+ a0c:	85 d2                	test   %edx,%edx
+ a0e:	75 c0                	jne    9d0 <malloc+0x40>
+        return 0;
+  }
+}
+ a10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a13:	31 c0                	xor    %eax,%eax
+}
+ a15:	5b                   	pop    %ebx
+ a16:	5e                   	pop    %esi
+ a17:	5f                   	pop    %edi
+ a18:	5d                   	pop    %ebp
+ a19:	c3                   	ret
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a20:	39 cf                	cmp    %ecx,%edi
+ a22:	74 4c                	je     a70 <malloc+0xe0>
+        p->s.size -= nunits;
+ a24:	29 f9                	sub    %edi,%ecx
+ a26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a2f:	89 15 14 0e 00 00    	mov    %edx,0xe14
+}
+ a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a38:	83 c0 08             	add    $0x8,%eax
+}
+ a3b:	5b                   	pop    %ebx
+ a3c:	5e                   	pop    %esi
+ a3d:	5f                   	pop    %edi
+ a3e:	5d                   	pop    %ebp
+ a3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a40:	c7 05 14 0e 00 00 18 	movl   $0xe18,0xe14
+ a47:	0e 00 00 
+    base.s.size = 0;
+ a4a:	b8 18 0e 00 00       	mov    $0xe18,%eax
+    base.s.ptr = freep = prevp = &base;
+ a4f:	c7 05 18 0e 00 00 18 	movl   $0xe18,0xe18
+ a56:	0e 00 00 
+    base.s.size = 0;
+ a59:	c7 05 1c 0e 00 00 00 	movl   $0x0,0xe1c
+ a60:	00 00 00 
+    if(p->s.size >= nunits){
+ a63:	e9 54 ff ff ff       	jmp    9bc <malloc+0x2c>
+ a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a70:	8b 08                	mov    (%eax),%ecx
+ a72:	89 0a                	mov    %ecx,(%edx)
+ a74:	eb b9                	jmp    a2f <malloc+0x9f>
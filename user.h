@@ -39,6 +39,11 @@ int symlink(char*, char*);
 //JTM - Add in system call for lseek
 int lseek(int, int);
 
+// Reserve space in an extent file without writing it
+int fallocate(int, int, int);
+int iostats(void);
+int fsync(int);
+
 // ulib.c
 int stat(const char*, struct stat*);
 char* strcpy(char*, const char*);
@@ -0,0 +1,376 @@
+// Driver for a virtio block device, which QEMU can provide in
+// place of IDE disk 1 (see "make qemu VIRTIO=1").  It speaks the
+// legacy PCI interface of the virtio 0.9.5 spec; ide.c hands it
+// the requests for disk 1 when virtioinit() finds the device.
+//
+// While the device is busy, new bufs wait on a pending list,
+// kept in block order.  Each interrupt retires every finished
+// request and passes the pending bufs to the device in one
+// batch, a run of consecutive blocks as one request with a
+// descriptor per buf.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+
+#define VIRTIO_VENDOR  0x1af4
+#define VIRTIO_BLKDEV  0x1001  // transitional block device
+
+// Legacy registers, offsets into the I/O space in BAR0.
+#define VIO_HOSTFEAT   0x00
+#define VIO_GUESTFEAT  0x04
+#define VIO_QPFN       0x08
+#define VIO_QSIZE      0x0c
+#define VIO_QSEL       0x0e
+#define VIO_QNOTIFY    0x10
+#define VIO_STATUS     0x12
+#define VIO_ISR        0x13
+#define VIO_CONFIG     0x14  // device config, since MSI-X is off
+
+#define VIO_ST_ACK     0x01
+#define VIO_ST_DRIVER  0x02
+#define VIO_ST_OK      0x04
+#define VIO_ST_FAILED  0x80
+
+#define VRING_F_NEXT   1     // descriptor continues in next
+#define VRING_F_WRITE  2     // device writes, rather than reads
+#define VRING_F_NO_NOTIFY 1  // in used->flags: no need to kick
+
+#define VIO_BLK_T_IN   0
+#define VIO_BLK_T_OUT  1
+
+#define VIO_NDESC      256   // largest queue we have room for
+#define VIO_MAXSEG     64    // bufs in one request
+#define SECTOR_SIZE    512
+
+struct vdesc {
+  uint addr;
+  uint addrhi;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+
+struct vavail {
+  ushort flags;
+  ushort idx;
+  ushort ring[];
+};
+
+struct vused {
+  ushort flags;
+  ushort idx;
+  struct {
+    uint id;    // head descriptor of the finished request
+    uint len;
+  } ring[];
+};
+
+// The header that starts each request.
+struct vblkhdr {
+  uint type;
+  uint reserved;
+  uint sector;
+  uint sectorhi;
+};
+
+int virtioirq;
+
+static struct {
+  struct spinlock lock;
+  ushort iobase;
+  int n;                      // descriptors in the queue
+  struct vdesc *desc;
+  struct vavail *avail;
+  volatile struct vused *used;
+  ushort usedidx;             // used entries retired so far
+  int free;                   // free descriptors, linked by next
+  int nfree;
+  uint nblock;                // size of the device
+  struct buf *pending;        // bufs not yet given to the device
+  int nbusy;                  // requests the device has
+
+  // For each request, indexed by its head descriptor.
+  struct {
+    struct vblkhdr hdr;
+    uchar status;
+    struct buf *b;            // its bufs, linked by qnext
+  } req[VIO_NDESC];
+
+  // Counters for virtiostats().
+  uint nreq;
+  uint ncmd;
+  uint nintr;
+  uint wait;
+  uint maxwait;
+} vdisk;
+
+// The queue's rings; the device finds them by page number.
+static char vring[3*PGSIZE] __attribute__((aligned(PGSIZE)));
+
+// Bytes of ring for a queue of n descriptors, laid out as the
+// legacy interface requires.
+static uint
+vringused(int n)
+{
+  return PGROUNDUP(16*n + 6 + 2*n);
+}
+
+static uint
+vringsize(int n)
+{
+  return vringused(n) + PGROUNDUP(6 + 8*n);
+}
+
+// Look for the device and set up its queue.
+// Returns 1 if it is there and ready to use.
+int
+virtioinit(void)
+{
+  uint tag, bar;
+  ushort io;
+  int i, n;
+
+  if((tag = pcifind(VIRTIO_VENDOR, VIRTIO_BLKDEV)) == 0)
+    return 0;
+  bar = pciread(tag, 0x10);
+  if((bar & 1) == 0)
+    return 0;  // legacy registers are in I/O space
+  pcienable(tag);
+  io = bar & 0xfffc;
+
+  outb(io + VIO_STATUS, 0);  // reset
+  outb(io + VIO_STATUS, VIO_ST_ACK);
+  outb(io + VIO_STATUS, VIO_ST_ACK | VIO_ST_DRIVER);
+  inl(io + VIO_HOSTFEAT);
+  outl(io + VIO_GUESTFEAT, 0);  // no optional features
+
+  outw(io + VIO_QSEL, 0);
+  n = inw(io + VIO_QSIZE);
+  if(n < 3 || n > VIO_NDESC || vringsize(n) > sizeof(vring)){
+    cprintf("virtio: unusable queue size %d\n", n);
+    outb(io + VIO_STATUS, VIO_ST_FAILED);
+    return 0;
+  }
+
+  initlock(&vdisk.lock, "virtio");
+  vdisk.iobase = io;
+  vdisk.n = n;
+  memset(vring, 0, sizeof(vring));
+  vdisk.desc = (struct vdesc*)vring;
+  vdisk.avail = (struct vavail*)(vring + 16*n);
+  vdisk.used = (struct vused*)(vring + vringused(n));
+  for(i = 0; i < n; i++)
+    vdisk.desc[i].next = i + 1;
+  vdisk.free = 0;
+  vdisk.nfree = n;
+  outl(io + VIO_QPFN, V2P(vring) / PGSIZE);
+
+  vdisk.nblock = inl(io + VIO_CONFIG) / (BSIZE/SECTOR_SIZE);
+  if(inl(io + VIO_CONFIG + 4) != 0)
+    vdisk.nblock = FSSIZE;
+  virtioirq = pciread(tag, 0x3c) & 0xff;
+  ioapicenable(virtioirq, ncpu - 1);
+
+  outb(io + VIO_STATUS, VIO_ST_ACK | VIO_ST_DRIVER | VIO_ST_OK);
+  cprintf("virtio: block device of %d blocks, queue of %d, irq %d\n",
+          vdisk.nblock, n, virtioirq);
+  return 1;
+}
+
+// Take a free descriptor for len bytes at va and chain it after
+// prev, if prev >= 0.  Caller must hold vdisk.lock.
+static int
+vchain(int prev, void *va, uint len, int flags)
+{
+  struct vdesc *d;
+  int i;
+
+  if(vdisk.nfree == 0)
+    panic("vchain");
+  i = vdisk.free;
+  d = &vdisk.desc[i];
+  vdisk.free = d->next;
+  vdisk.nfree--;
+
+  d->addr = V2P(va);
+  d->addrhi = 0;
+  d->len = len;
+  d->flags = flags;
+  d->next = 0;
+  if(prev >= 0){
+    vdisk.desc[prev].flags |= VRING_F_NEXT;
+    vdisk.desc[prev].next = i;
+  }
+  return i;
+}
+
+// Free the chain of descriptors starting at i.
+static void
+vunchain(int i)
+{
+  int next, more;
+
+  for(;;){
+    more = vdisk.desc[i].flags & VRING_F_NEXT;
+    next = vdisk.desc[i].next;
+    vdisk.desc[i].next = vdisk.free;
+    vdisk.free = i;
+    vdisk.nfree++;
+    if(!more)
+      break;
+    i = next;
+  }
+}
+
+// Give the device the pending bufs, each run of consecutive
+// blocks in the same direction as one request, and kick it once.
+// Stops early if the queue runs out of descriptors.
+// Caller must hold vdisk.lock.
+static void
+vstart(void)
+{
+  struct buf *b, *e;
+  int nbuf, head, d, added;
+
+  added = 0;
+  while((b = vdisk.pending) != 0){
+    nbuf = 1;
+    for(e = b; e->qnext != 0; e = e->qnext){
+      // A request also takes a header and a status descriptor, so
+      // on a small queue a run must be shorter to fit at all.
+      if(nbuf == VIO_MAXSEG || nbuf == vdisk.n - 2 ||
+         e->qnext->blockno != e->blockno + 1 ||
+         (e->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+        break;
+      nbuf++;
+    }
+    if(vdisk.nfree < nbuf + 2)
+      break;
+    vdisk.pending = e->qnext;
+    e->qnext = 0;
+
+    head = vdisk.free;  // vchain() will take it
+    vdisk.req[head].hdr.type = (b->flags & B_DIRTY) ? VIO_BLK_T_OUT : VIO_BLK_T_IN;
+    vdisk.req[head].hdr.reserved = 0;
+    vdisk.req[head].hdr.sector = b->blockno * (BSIZE/SECTOR_SIZE);
+    vdisk.req[head].hdr.sectorhi = 0;
+    vdisk.req[head].status = 0xff;
+    vdisk.req[head].b = b;
+
+    d = vchain(-1, &vdisk.req[head].hdr, sizeof(struct vblkhdr), 0);
+    for(e = b; e != 0; e = e->qnext)
+      d = vchain(d, e->data, BSIZE, (b->flags & B_DIRTY) ? 0 : VRING_F_WRITE);
+    vchain(d, &vdisk.req[head].status, 1, VRING_F_WRITE);
+
+    vdisk.avail->ring[vdisk.avail->idx % vdisk.n] = head;
+    __sync_synchronize();
+    vdisk.avail->idx++;
+    vdisk.nbusy++;
+    vdisk.ncmd++;
+    added++;
+  }
+
+  __sync_synchronize();
+  if(added && (vdisk.used->flags & VRING_F_NO_NOTIFY) == 0)
+    outw(vdisk.iobase + VIO_QNOTIFY, 0);
+}
+
+// Interrupt handler: finish every request the device is done
+// with, then start the ones that came in meanwhile.
+void
+virtiointr(void)
+{
+  struct buf *b, *next;
+  void (*done)(struct buf*);
+  int id;
+
+  acquire(&vdisk.lock);
+  inb(vdisk.iobase + VIO_ISR);  // acknowledge
+  vdisk.nintr++;
+
+  while(vdisk.usedidx != vdisk.used->idx){
+    __sync_synchronize();
+    id = vdisk.used->ring[vdisk.usedidx % vdisk.n].id;
+    vdisk.usedidx++;
+    if(vdisk.req[id].status != 0)
+      panic("virtio: I/O error");
+
+    for(b = vdisk.req[id].b; b != 0; b = next){
+      next = b->qnext;
+      vdisk.nreq++;
+      vdisk.wait += ticks - b->qtime;
+      if(ticks - b->qtime > vdisk.maxwait)
+        vdisk.maxwait = ticks - b->qtime;
+
+      // Wake process waiting for this buf.
+      b->flags |= B_VALID;
+      b->flags &= ~B_DIRTY;
+      wakeup(b);
+      if((done = b->done) != 0){
+        b->done = 0;
+        done(b);
+      }
+    }
+    vdisk.req[id].b = 0;
+    vunchain(id);
+    vdisk.nbusy--;
+  }
+
+  vstart();
+  release(&vdisk.lock);
+}
+
+// Queue b for the device, as ide_submit() does for IDE.
+void
+virtio_submit(struct buf *b)
+{
+  struct buf **pp;
+
+  if(!holdingsleep(&b->lock))
+    panic("virtio_submit: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("virtio_submit: nothing to do");
+  if(b->flags & B_DELAY)
+    panic("virtio_submit: no disk block");
+  if(b->blockno >= vdisk.nblock)
+    panic("virtio_submit: block out of range");
+
+  acquire(&vdisk.lock);
+  b->qtime = ticks;
+  for(pp = &vdisk.pending; *pp && (*pp)->blockno < b->blockno; pp = &(*pp)->qnext)
+    ;
+  b->qnext = *pp;
+  *pp = b;
+  if(vdisk.nbusy == 0)
+    vstart();
+  release(&vdisk.lock);
+}
+
+// Wait for b, queued with virtio_submit(), to finish.
+void
+virtio_wait(struct buf *b)
+{
+  acquire(&vdisk.lock);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+    sleep(b, &vdisk.lock);
+  }
+  release(&vdisk.lock);
+}
+
+// Print queue counters.
+void
+virtiostats(void)
+{
+  cprintf("virtio: %d requests in %d commands, %d interrupts; "
+          "queued %d ticks in all, %d at most\n", vdisk.nreq,
+          vdisk.ncmd, vdisk.nintr, vdisk.wait, vdisk.maxwait);
+}